@@ -30,7 +30,8 @@ public class FPSCore : ModuleRules
 			new string[]
 			{
 				"Slate",
-				"SlateCore"
+				"SlateCore",
+				"RenderCore"
 			}
 		);
 	}
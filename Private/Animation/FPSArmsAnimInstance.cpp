@@ -0,0 +1,337 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Animation/FPSArmsAnimInstance.h"
+
+// ============================================
+// ANIM INSTANCE
+// ============================================
+
+void UFPSArmsAnimInstance::SetProceduralInput(const FFPSProceduralArmsInput& Input)
+{
+	// GAME THREAD - snapshot copied before Arms mesh tick dispatches worker update
+	const bool bPendingReset = PendingInput.bResetState;
+	PendingInput = Input;
+	PendingInput.bResetState |= bPendingReset;
+}
+
+void UFPSArmsAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
+{
+	Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+
+	// WORKER THREAD - operate on snapshot only
+	if (PendingInput.bResetState)
+	{
+		ProceduralState.Reset(PendingInput.ControlRotation);
+		PendingInput.bResetState = false;
+	}
+
+	ProceduralState.Update(PendingInput, DeltaSeconds);
+
+	// ============================================
+	// ROOT BONE OFFSET (component space)
+	// ============================================
+	// Previously: Arms->SetRelativeLocation(Final) under a moved Camera component
+	// Now: Arms/Camera components stay put, root bone reproduces the same world transform
+	//   Desired arms (camera space) = (ArmsRotation, FinalArmsOffset) * AppliedCameraOffset
+	//   RootBone * ArmsRelativeTransform = Desired → RootBone = Desired * ArmsRelative^-1
+	const FTransform DesiredArmsTransform(PendingInput.ArmsRelativeTransform.GetRotation(), ProceduralState.FinalArmsOffset);
+	const FTransform RootBoneTransform = DesiredArmsTransform * PendingInput.AppliedCameraOffset * PendingInput.ArmsRelativeTransform.Inverse();
+
+	ArmsRootTranslation = RootBoneTransform.GetTranslation();
+	ArmsRootRotation = RootBoneTransform.Rotator();
+}
+
+// ============================================
+// PROCEDURAL STATE
+// ============================================
+
+void FFPSProceduralArmsState::Update(const FFPSProceduralArmsInput& Input, float DeltaTime)
+{
+	if (DeltaTime <= 0.0f)
+	{
+		return;
+	}
+
+	LeanVector = CalculateLeanVector(Input, DeltaTime);
+	BreathingVector = CalculateBreathing(Input, DeltaTime);
+
+	// Combine aiming offset + weapon lean/sway + breathing
+	FinalArmsOffset = Input.ArmsOffset + LeanVector + BreathingVector;
+
+	// Breathing rotation + leaning position applied to camera during ADS only
+	CameraOffset = Input.bIsAiming
+		? FTransform(CalculateBreathingRotation(BreathingVector), LeanVector)
+		: FTransform::Identity;
+}
+
+void FFPSProceduralArmsState::Reset(const FRotator& ControlRotation)
+{
+	LeanVector = FVector::ZeroVector;
+	BreathingVector = FVector::ZeroVector;
+	RawMouseDelta = 0.0f;
+	FinalArmsOffset = FVector::ZeroVector;
+	CameraOffset = FTransform::Identity;
+
+	LeanState_CurrentLean = FVector::ZeroVector;
+	LeanState_WalkCycleTime = 0.0f;
+	LeanState_PreviousControlRotation = ControlRotation;
+	LeanState_MouseLagOffset = FVector2D::ZeroVector;
+
+	BreathingState_CurrentBreathing = FVector::ZeroVector;
+	BreathingState_IdleSwayTime = 0.0f;
+	BreathingState_IdleActivation = 0.0f;
+}
+
+// ============================================
+// LEANING SYSTEM IMPLEMENTATION (Postprocess Offset)
+// ============================================
+//
+// Calculates weapon sway based on movement
+// All parameters are hardcoded for simplicity
+// Returns 3D offset: X = forward/back (cm), Y = lateral left/right (cm), Z = vertical up/down (cm)
+
+FVector FFPSProceduralArmsState::CalculateLeanVector(const FFPSProceduralArmsInput& Input, float DeltaTime)
+{
+	// ============================================
+	// HARDCODED PARAMETERS (REALISTIC VALUES)
+	// ============================================
+	// Based on research: Insurgency, Escape from Tarkov, Ready or Not, CS:GO
+	// TUNED: Refined values for smoother forward/backward and lateral movement
+
+	// Velocity-based lean (weapon follows movement direction)
+	const float MaxLateralOffset = 3.8f;        // cm - lateral sway (tuned: was 4.5, original 1.2)
+	const float MaxForwardOffset = 1.2f;        // cm - forward sway (tuned: was 2.5, original 0.6)
+
+	// Walking bob (perpendicular oscillation)
+	const float BobAmplitudeHorizontal = 2.4f;  // cm - horizontal bob (tuned: was 2.8, original 0.8)
+	const float BobAmplitudeVertical = 3.5f;    // cm - vertical bob (not returned)
+	const float BobFrequency = 8.0f;            // cycles per jog speed
+
+	// Mouse input influence (weapon tilt/lag)
+	const float MouseTiltStrength = 7.0f;       // cm - tilt effect (tuned: was 12.0, more controlled)
+	const float MouseLagSpeed = 6.0f;           // spring damping (tuned: was 5.0, faster response)
+
+	// Interpolation speed
+	const float LeanInterpSpeed = 8.0f;         // velocity-based lean smoothing
+
+	// ============================================
+	// GET VELOCITY (local space)
+	// ============================================
+	FVector WorldVelocity = Input.Velocity;
+	WorldVelocity.Z = 0.0f; // Ignore vertical movement
+
+	// Transform to local space (X=forward, Y=right)
+	FVector LocalVelocity = Input.ActorQuat.Inverse().RotateVector(WorldVelocity);
+	float VelocityMag = LocalVelocity.Size();
+
+	// ============================================
+	// UPDATE WALK CYCLE TIME (for bob phase)
+	// ============================================
+	if (VelocityMag > 10.0f)
+	{
+		float NormalizedSpeed = VelocityMag / 450.0f; // Normalize to jog speed
+		LeanState_WalkCycleTime += DeltaTime * BobFrequency * NormalizedSpeed;
+	}
+	// Don't reset when stopping - preserves phase, prevents jarring snap
+
+	// ============================================
+	// CALCULATE VELOCITY-BASED LEAN (follow movement direction)
+	// ============================================
+	float VelLateral = FMath::Clamp(LocalVelocity.Y / 450.0f, -1.0f, 1.0f);  // Normalize
+	float VelForward = FMath::Clamp(LocalVelocity.X / 450.0f, -1.0f, 1.0f);  // Normalize
+
+	// Lean follows velocity (moving RIGHT → lean RIGHT, moving FORWARD → lean FORWARD)
+	float VelocityLateralLean = VelLateral * MaxLateralOffset;
+	float VelocityForwardLean = VelForward * MaxForwardOffset;
+
+	// ============================================
+	// CALCULATE PERPENDICULAR BOB (walking cycle)
+	// ============================================
+	// Bob perpendicular to movement direction (creates natural "swagger")
+	float BobHorizontal = 0.0f;
+	float BobForward = 0.0f;
+
+	if (VelocityMag > 10.0f)
+	{
+		// Normalize velocity direction
+		FVector2D VelDir;
+		VelDir.X = LocalVelocity.X / VelocityMag;  // Forward component
+		VelDir.Y = LocalVelocity.Y / VelocityMag;  // Right component
+
+		// Forward movement (W) → horizontal bob (left-right swing)
+		BobHorizontal = FMath::Sin(LeanState_WalkCycleTime) * BobAmplitudeHorizontal;
+		BobHorizontal *= FMath::Abs(VelDir.X); // Scale by forward component
+
+		// Strafe movement (A/D) → horizontal bob (perpendicular to strafe)
+		// FIX: Both forward AND strafe create horizontal bob (not forward bob)
+		float StrafeBobHorizontal = FMath::Sin(LeanState_WalkCycleTime) * BobAmplitudeHorizontal * 0.7f;
+		StrafeBobHorizontal *= FMath::Abs(VelDir.Y); // Scale by strafe component
+		BobHorizontal += StrafeBobHorizontal;
+
+		// Vertical bob component (subtle forward/back during walk cycle)
+		// TUNED: Reduced from 0.3 to 0.15 for gentler forward/back oscillation
+		BobForward = FMath::Cos(LeanState_WalkCycleTime * 2.0f) * (BobAmplitudeHorizontal * 0.15f);
+	}
+
+	// ============================================
+	// CALCULATE VERTICAL BOB (Z-axis)
+	// ============================================
+	// Primary component: Up/down bounce during walk cycle
+	// Frequency: 1× horizontal bob (one full cycle per walk cycle)
+	// TUNED: Reduced from 2.0× to 1.0× for slower, more natural rhythm
+	float VerticalBob = 0.0f;
+
+	if (VelocityMag > 10.0f)
+	{
+		// Sin wave at same frequency as horizontal bob (smooth, slow bounce)
+		// Always positive (weapon goes DOWN, not up - realistic foot impact)
+		float NormalizedSpeed = FMath::Clamp(VelocityMag / 450.0f, 0.0f, 1.0f);
+		VerticalBob = FMath::Abs(FMath::Sin(LeanState_WalkCycleTime * 1.0f)) * BobAmplitudeVertical;
+		VerticalBob *= NormalizedSpeed;  // Scale by movement speed
+
+		// Invert to negative (weapon drops DOWN on step)
+		VerticalBob = -VerticalBob;
+	}
+
+	// ============================================
+	// CALCULATE MOUSE INPUT INFLUENCE (weapon tilt/lag)
+	// ============================================
+	FVector2D MouseTiltOffset = FVector2D::ZeroVector;
+
+	if (Input.bHasController)
+	{
+		const FRotator CurrentRotation = Input.ControlRotation;
+
+		// Calculate mouse delta (angular velocity)
+		FRotator DeltaRotation = CurrentRotation - LeanState_PreviousControlRotation;
+		DeltaRotation.Normalize(); // Clamp to ±180°
+
+		// Convert angular velocity to tilt offset
+		// Yaw (horizontal mouse) → lateral offset (weapon lags left/right)
+		// Pitch (vertical mouse) → forward offset (weapon lags up/down)
+		float MouseYawDelta = DeltaRotation.Yaw / DeltaTime;   // degrees per second
+		float MousePitchDelta = DeltaRotation.Pitch / DeltaTime; // degrees per second
+
+		// Store RAW mouse delta magnitude for crosshair alpha
+		// Combine yaw and pitch for total angular velocity
+		RawMouseDelta = FMath::Sqrt(MouseYawDelta * MouseYawDelta + MousePitchDelta * MousePitchDelta);
+
+		// Target tilt based on mouse speed
+		FVector2D TargetMouseTilt;
+		TargetMouseTilt.X = FMath::Clamp(MousePitchDelta * 0.002f, -1.0f, 1.0f) * MouseTiltStrength;
+		TargetMouseTilt.Y = FMath::Clamp(-MouseYawDelta * 0.002f, -1.0f, 1.0f) * MouseTiltStrength;
+
+		// Spring interpolation (weapon lags behind camera)
+		LeanState_MouseLagOffset = FMath::Vector2DInterpTo(LeanState_MouseLagOffset, TargetMouseTilt, DeltaTime, MouseLagSpeed);
+		MouseTiltOffset = LeanState_MouseLagOffset;
+
+		// Store rotation for next frame
+		LeanState_PreviousControlRotation = CurrentRotation;
+	}
+
+	// ============================================
+	// COMBINE ALL OFFSETS INTO TARGET
+	// ============================================
+	// NOTE: Breathing sway is calculated separately in CalculateBreathing()
+	// This keeps leaning (movement-based) separate from breathing (idle-based)
+	FVector TargetOffset;
+	TargetOffset.X = VelocityForwardLean + BobForward + MouseTiltOffset.X;
+	TargetOffset.Y = VelocityLateralLean + BobHorizontal + MouseTiltOffset.Y;
+	TargetOffset.Z = VerticalBob;  // Z = vertical bob only
+
+	// Apply aiming scale (reduces all sway during ADS)
+	TargetOffset *= Input.LeaningScale;
+
+	// ============================================
+	// SMOOTH INTERPOLATION (final spring damping)
+	// ============================================
+	LeanState_CurrentLean = FMath::VInterpTo(LeanState_CurrentLean, TargetOffset, DeltaTime, LeanInterpSpeed);
+
+	return LeanState_CurrentLean;
+}
+
+// ============================================
+// BREATHING SYSTEM IMPLEMENTATION
+// ============================================
+//
+// Uses BreathingScale from input (hip-fire idle breathing → ADS sight breathing)
+//
+FVector FFPSProceduralArmsState::CalculateBreathing(const FFPSProceduralArmsInput& Input, float DeltaTime)
+{
+	// ============================================
+	// HARDCODED PARAMETERS
+	// ============================================
+	const float IdleSwayAmplitude = 0.4f;       // cm - breathing amplitude
+	const float IdleSwayFrequencyX = 0.45f;     // Hz - breathing rate X (27 cycles/min, 1 cycle per 2.2 sec)
+	const float IdleSwayFrequencyY = 0.55f;     // Hz - breathing rate Y (33 cycles/min, 1 cycle per 1.8 sec)
+	const float IdleSwayFrequencyZ = 0.35f;     // Hz - breathing rate Z (21 cycles/min, 1 cycle per 2.9 sec)
+	const float IdleBlendSpeed = 3.0f;          // idle sway activation blend
+	const float LeanInterpSpeed = 8.0f;         // smooth interpolation
+
+	// ============================================
+	// GET VELOCITY
+	// ============================================
+	FVector WorldVelocity = Input.Velocity;
+	WorldVelocity.Z = 0.0f; // Ignore vertical movement
+	float VelocityMag = WorldVelocity.Size();
+
+	// ============================================
+	// IDLE SWAY ACTIVATION (blend based on velocity)
+	// ============================================
+	// When stationary: IdleActivation = 1.0 (full idle sway)
+	// When moving: IdleActivation = 0.0 (disable idle sway)
+	float TargetIdleActivation = (VelocityMag < 50.0f) ? 1.0f : 0.0f;
+	BreathingState_IdleActivation = FMath::FInterpTo(BreathingState_IdleActivation, TargetIdleActivation, DeltaTime, IdleBlendSpeed);
+
+	// ============================================
+	// UPDATE IDLE SWAY TIME (always running)
+	// ============================================
+	BreathingState_IdleSwayTime += DeltaTime;
+
+	// ============================================
+	// CALCULATE IDLE SWAY (breathing/tremor)
+	// ============================================
+	FVector TargetBreathing = FVector::ZeroVector;
+
+	if (BreathingState_IdleActivation > 0.01f)
+	{
+		// Sine waves at different frequencies (creates figure-8 pattern in XY, subtle Z breathing)
+		float IdleX = FMath::Sin(BreathingState_IdleSwayTime * IdleSwayFrequencyX * 2.0f * PI);
+		float IdleY = FMath::Sin(BreathingState_IdleSwayTime * IdleSwayFrequencyY * 2.0f * PI);
+		float IdleZ = FMath::Cos(BreathingState_IdleSwayTime * IdleSwayFrequencyZ * 2.0f * PI);  // Slower breathing rate
+
+		TargetBreathing.X = IdleX * IdleSwayAmplitude * BreathingState_IdleActivation;
+		TargetBreathing.Y = IdleY * IdleSwayAmplitude * BreathingState_IdleActivation;
+		TargetBreathing.Z = IdleZ * (IdleSwayAmplitude * 0.75f) * BreathingState_IdleActivation;  // 75% amplitude for Z
+
+		// Apply breathing scale (interpolates hip → ADS)
+		TargetBreathing *= Input.BreathingScale;
+	}
+
+	// ============================================
+	// SMOOTH INTERPOLATION (final spring damping)
+	// ============================================
+	BreathingState_CurrentBreathing = FMath::VInterpTo(BreathingState_CurrentBreathing, TargetBreathing, DeltaTime, LeanInterpSpeed);
+
+	return BreathingState_CurrentBreathing;
+}
+
+// ============================================
+// BREATHING ROTATION CALCULATION (Camera sway)
+// ============================================
+//
+// Converts breathing offset (cm) to camera rotation (degrees)
+// Used for realistic aim wobble during ADS
+//
+FRotator FFPSProceduralArmsState::CalculateBreathingRotation(const FVector& InBreathingVector)
+{
+	const float OffsetToRotationScale = 0.8f;   // degrees per cm (tuned for realistic wobble)
+
+	// BreathingVector.Y (lateral offset, cm) → Yaw (horizontal rotation, degrees)
+	// BreathingVector.Z (vertical offset, cm) → Pitch (vertical rotation, degrees)
+	// Invert Z for natural pitch direction (positive Z up → negative Pitch down)
+	float BreathingYaw = InBreathingVector.Y * OffsetToRotationScale;
+	float BreathingPitch = -InBreathingVector.Z * OffsetToRotationScale;
+
+	return FRotator(BreathingPitch, BreathingYaw, 0.0f);
+}
@@ -0,0 +1,61 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Animation/FPSCharacterAnimInstance.h"
+#include "FPSCharacter.h"
+
+// ============================================
+// SPINE AIM OFFSET
+// ============================================
+
+FFPSSpineAimOffset FFPSSpineAimOffset::FromSpinePitch(float SpinePitch)
+{
+	FFPSSpineAimOffset Result;
+	Result.Spine03 = SpinePitch * 0.4f;
+	Result.Spine04 = SpinePitch * 0.5f;
+	Result.Spine05 = SpinePitch * 0.6f;
+	Result.Neck01 = SpinePitch * 0.2f;
+	return Result;
+}
+
+float FFPSSpineAimOffset::SpinePitchFromViewPitch(float ViewPitch)
+{
+	// Spine chain calculation: spine_03(40%) + spine_04(50%) + spine_05(60%) + neck_01(20%)
+	// These are RELATIVE rotations, so they accumulate: ~170% amplification (empirical)
+	// Inverse: camera_pitch / 1.7 ≈ spine pitch
+	//
+	// NOTE: Tune this multiplier empirically by comparing local vs proxy AimOffset max range
+	// Goal: Proxy reaches max AimOffset (6) at same visual angle as local client
+	const float ProxyAimOffsetCompensation = 0.588f; // 1 / 1.7 ≈ 0.588
+
+	return FMath::Clamp(ViewPitch * ProxyAimOffsetCompensation, -45.0f, 45.0f);
+}
+
+// ============================================
+// ANIM INSTANCE
+// ============================================
+
+void UFPSCharacterAnimInstance::NativeInitializeAnimation()
+{
+	Super::NativeInitializeAnimation();
+
+	// Framework-level cast: Body AnimBP is FPSCharacter-specific
+	OwningCharacter = Cast<AFPSCharacter>(TryGetPawnOwner());
+}
+
+void UFPSCharacterAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
+{
+	Super::NativeUpdateAnimation(DeltaSeconds);
+
+	// GAME THREAD - copy single float, everything else happens on worker thread
+	if (const AFPSCharacter* Character = OwningCharacter.Get())
+	{
+		SpinePitch = Character->LocalPitchAccumulator;
+	}
+}
+
+void UFPSCharacterAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
+{
+	Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+
+	SpineAimOffset = FFPSSpineAimOffset::FromSpinePitch(SpinePitch);
+}
@@ -15,6 +15,19 @@
 #include "Interfaces/MagazineMeshProviderInterface.h"
 #include "Interfaces/SightMeshProviderInterface.h"
 #include "NiagaraComponent.h"
+#include "Core/FPSCoreStats.h"
+#include "Core/FPSImpactEffectSubsystem.h"
+#include "Core/FPSDecalSubsystem.h"
+#include "Materials/MaterialInterface.h"
+#include "Core/FPSTracerSubsystem.h"
+#include "Core/FPSCharacterSignificanceSubsystem.h"
+#include "Engine/StaticMesh.h"
+#include "Components/DroppedItemComponent.h"
+#include "Data/AmmoTypeDataAsset.h"
+#include "Animation/AnimMontage.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/SCS_Node.h"
+#include "Engine/SimpleConstructionScript.h"
 
 ABaseWeapon::ABaseWeapon()
 {
@@ -45,6 +58,8 @@ ABaseWeapon::ABaseWeapon()
 	TPSMesh->SetGenerateOverlapEvents(false);
 	// Performance optimizations
 	TPSMesh->bEnableUpdateRateOptimizations = true;
+	// Owner never renders TPSMesh - montages (bolt / pump) keep advancing, pose skipped
+	TPSMesh->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
 	TPSMesh->bComponentUseFixedSkelBounds = true;
 
 	FPSMesh = CreateDefaultSubobject<USkeletalMeshComponent>(TEXT("FPSMesh"));
@@ -55,6 +70,8 @@ ABaseWeapon::ABaseWeapon()
 	// Performance optimizations
 	FPSMesh->bComponentUseFixedSkelBounds = true;
 	FPSMesh->SetGenerateOverlapEvents(false);
+	// Only the owner renders FPSMesh - same montage-only ticking everywhere else
+	FPSMesh->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
 
 	// NOTE: BallisticsComponent is NOT created here - child classes create their own
 	// (e.g., SPAS12 creates UShotgunBallisticsComponent, others use UBallisticsComponent)
@@ -72,6 +89,35 @@ ABaseWeapon::ABaseWeapon()
 	SightComponent = CreateDefaultSubobject<UChildActorComponent>(TEXT("SightComponent"));
 	SightComponent->SetupAttachment(FPSMesh);
 	SightComponent->SetIsReplicated(false);  // CurrentSight (actor pointer) is replicated instead
+
+	DroppedItemComponent = CreateDefaultSubobject<UDroppedItemComponent>(TEXT("DroppedItemComponent"));
+}
+
+void ABaseWeapon::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+#if WITH_EDITORONLY_DATA
+	// Native CDO: deprecated tuning mirrors the built-in definition, so Blueprints saved before
+	// WeaponDefinition existed load their deltas against the same values the constructors used to set
+	if (HasAnyFlags(RF_ClassDefaultObject) && GetClass()->HasAnyClassFlags(CLASS_Native))
+	{
+		CopyDefinitionToDeprecated(GetBuiltInDefinition());
+	}
+#endif
+}
+
+void ABaseWeapon::PostLoad()
+{
+	Super::PostLoad();
+
+#if WITH_EDITORONLY_DATA
+	// Tuning is EditDefaultsOnly - only Blueprint CDOs can carry old values
+	if (HasAnyFlags(RF_ClassDefaultObject))
+	{
+		MigrateDeprecatedTuning();
+	}
+#endif
 }
 
 void ABaseWeapon::PostInitializeComponents()
@@ -98,10 +144,192 @@ void ABaseWeapon::PostInitializeComponents()
 	}
 }
 
+// ============================================
+// WEAPON DEFINITION
+// ============================================
+
+const FWeaponDefinition& ABaseWeapon::GetDefinitionFor(const AActor* Actor)
+{
+	if (const ABaseWeapon* Weapon = Cast<ABaseWeapon>(Actor))
+	{
+		return Weapon->GetDefinition();
+	}
+
+	static const FWeaponDefinition DefaultDefinition = MakeDefaultDefinition();
+	return DefaultDefinition;
+}
+
+const FWeaponDefinition& ABaseWeapon::GetBuiltInDefinition() const
+{
+	static const FWeaponDefinition Definition = MakeDefaultDefinition();
+	return Definition;
+}
+
+#if WITH_EDITORONLY_DATA
+namespace
+{
+	/** Tuning component on a weapon CDO - native subobject or Blueprint-added (SCS template) */
+	template<typename ComponentType>
+	ComponentType* FindTuningComponent(const ABaseWeapon* WeaponCDO, ComponentType* Assigned)
+	{
+		if (Assigned)
+		{
+			return Assigned;
+		}
+
+		if (ComponentType* Native = WeaponCDO->FindComponentByClass<ComponentType>())
+		{
+			return Native;
+		}
+
+		for (UBlueprintGeneratedClass* Class = Cast<UBlueprintGeneratedClass>(WeaponCDO->GetClass()); Class; Class = Cast<UBlueprintGeneratedClass>(Class->GetSuperClass()))
+		{
+			if (!Class->SimpleConstructionScript)
+			{
+				continue;
+			}
+
+			for (USCS_Node* Node : Class->SimpleConstructionScript->GetAllNodes())
+			{
+				if (ComponentType* Template = Node ? Cast<ComponentType>(Node->ComponentTemplate) : nullptr)
+				{
+					return Template;
+				}
+			}
+		}
+
+		return nullptr;
+	}
+}
+
+void ABaseWeapon::MigrateDeprecatedTuning()
+{
+	// Authored asset wins - deprecated values are ignored
+	if (WeaponDefinition && WeaponDefinition->IsAsset())
+	{
+		return;
+	}
+
+	// Already migrated and saved with this Blueprint - mirror it back so child Blueprints
+	// compare their own deltas against it, not against the native defaults
+	if (WeaponDefinition && WeaponDefinition->GetOuter() == this)
+	{
+		CopyDefinitionToDeprecated(WeaponDefinition->Definition);
+		return;
+	}
+
+	// Inherited record: parent Blueprint's generated definition or class built-in
+	const FWeaponDefinition& Inherited = GetDefinition();
+
+	FWeaponDefinition Migrated = Inherited;
+	CopyDeprecatedToDefinition(Migrated);
+
+	if (FWeaponDefinition::StaticStruct()->CompareScriptStruct(&Migrated, &Inherited, PPF_None))
+	{
+		return;
+	}
+
+	// Subobject of the CDO: saved with the Blueprint, referenced (not copied) by every instance
+	UWeaponDefinitionAsset* Generated = NewObject<UWeaponDefinitionAsset>(this, TEXT("MigratedWeaponDefinition"), RF_Public);
+	Generated->Definition = MoveTemp(Migrated);
+	WeaponDefinition = Generated;
+}
+
+void ABaseWeapon::CopyDefinitionToDeprecated(const FWeaponDefinition& Definition)
+{
+	AimFOV_DEPRECATED = Definition.AimFOV;
+	AimLookSpeed_DEPRECATED = Definition.AimLookSpeed;
+	LeaningScale_DEPRECATED = Definition.LeaningScale;
+	BreathingScale_DEPRECATED = Definition.BreathingScale;
+	AcceptedCaliberType_DEPRECATED = Definition.AcceptedCaliberType;
+	AnimLayer_DEPRECATED = Definition.AnimLayer;
+	ShootMontage_DEPRECATED = Definition.ShootMontage;
+	EquipMontage_DEPRECATED = Definition.EquipMontage;
+	UnequipMontage_DEPRECATED = Definition.UnequipMontage;
+	CharacterAttachSocket_DEPRECATED = Definition.CharacterAttachSocket;
+	ReloadAttachSocket_DEPRECATED = Definition.ReloadAttachSocket;
+
+	if (UFireComponent* Fire = FindTuningComponent<UFireComponent>(this, FireComponent))
+	{
+		Fire->FireRate_DEPRECATED = Definition.FireRate;
+		Fire->SpreadScale_DEPRECATED = Definition.SpreadScale;
+		Fire->RecoilScale_DEPRECATED = Definition.RecoilScale;
+	}
+
+	if (UReloadComponent* Reload = FindTuningComponent<UReloadComponent>(this, ReloadComponent))
+	{
+		Reload->ReloadMontage_DEPRECATED = Definition.ReloadMontage;
+	}
+
+	if (UBallisticsComponent* Ballistics = FindTuningComponent<UBallisticsComponent>(this, BallisticsComponent))
+	{
+		Ballistics->CaliberDataMap_DEPRECATED = Definition.CaliberDataMap;
+	}
+}
+
+void ABaseWeapon::CopyDeprecatedToDefinition(FWeaponDefinition& Definition) const
+{
+	Definition.AimFOV = AimFOV_DEPRECATED;
+	Definition.AimLookSpeed = AimLookSpeed_DEPRECATED;
+	Definition.LeaningScale = LeaningScale_DEPRECATED;
+	Definition.BreathingScale = BreathingScale_DEPRECATED;
+	Definition.AcceptedCaliberType = AcceptedCaliberType_DEPRECATED;
+	Definition.AnimLayer = AnimLayer_DEPRECATED;
+	Definition.ShootMontage = ShootMontage_DEPRECATED;
+	Definition.EquipMontage = EquipMontage_DEPRECATED;
+	Definition.UnequipMontage = UnequipMontage_DEPRECATED;
+	Definition.CharacterAttachSocket = CharacterAttachSocket_DEPRECATED;
+	Definition.ReloadAttachSocket = ReloadAttachSocket_DEPRECATED;
+
+	if (const UFireComponent* Fire = FindTuningComponent<UFireComponent>(this, FireComponent))
+	{
+		Definition.FireRate = Fire->FireRate_DEPRECATED;
+		Definition.SpreadScale = Fire->SpreadScale_DEPRECATED;
+		Definition.RecoilScale = Fire->RecoilScale_DEPRECATED;
+	}
+
+	if (const UReloadComponent* Reload = FindTuningComponent<UReloadComponent>(this, ReloadComponent))
+	{
+		Definition.ReloadMontage = Reload->ReloadMontage_DEPRECATED;
+	}
+
+	if (const UBallisticsComponent* Ballistics = FindTuningComponent<UBallisticsComponent>(this, BallisticsComponent))
+	{
+		Definition.CaliberDataMap = Ballistics->CaliberDataMap_DEPRECATED;
+	}
+}
+#endif
+
+FWeaponDefinition ABaseWeapon::MakeDefaultDefinition()
+{
+	FWeaponDefinition Definition;
+
+	// 5.56x45mm NATO - M4A1, M16, SCAR-L, HK416
+	Definition.CaliberDataMap.Add(EAmmoCaliberType::NATO_556x45mm, TSoftObjectPtr<UAmmoTypeDataAsset>(FSoftObjectPath(TEXT("/Script/FPSCore.AmmoTypeDataAsset'/FPSCore/Blueprints/Weapons/AmmoTypes/AmmoType_5_56x45mm_NATO.AmmoType_5_56x45mm_NATO'"))));
+
+	// 7.62x51mm NATO / .308 Win - Sako 85, G3, FAL, M14, SR-25
+	Definition.CaliberDataMap.Add(EAmmoCaliberType::NATO_762x51mm, TSoftObjectPtr<UAmmoTypeDataAsset>(FSoftObjectPath(TEXT("/Script/FPSCore.AmmoTypeDataAsset'/FPSCore/Blueprints/Weapons/AmmoTypes/AmmoType_7_62x51mm_NATO.AmmoType_7_62x51mm_NATO'"))));
+
+	// 9x19mm Parabellum - VP9, Glock, MP5, UZI
+	Definition.CaliberDataMap.Add(EAmmoCaliberType::Parabellum_9x19mm, TSoftObjectPtr<UAmmoTypeDataAsset>(FSoftObjectPath(TEXT("/Script/FPSCore.AmmoTypeDataAsset'/FPSCore/Blueprints/Weapons/AmmoTypes/AmmoType_9mm.AmmoType_9mm'"))));
+
+	// 12 Gauge Buckshot - SPAS-12, Remington 870, Benelli M4
+	Definition.CaliberDataMap.Add(EAmmoCaliberType::Gauge_12, TSoftObjectPtr<UAmmoTypeDataAsset>(FSoftObjectPath(TEXT("/Script/FPSCore.AmmoTypeDataAsset'/FPSCore/Blueprints/Weapons/AmmoTypes/AmmoType_12_Gauge_Buckshot.AmmoType_12_Gauge_Buckshot'"))));
+
+	return Definition;
+}
+
 void ABaseWeapon::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// Persistent muzzle flash emitters (no rendering on dedicated server)
+	if (GetNetMode() != NM_DedicatedServer)
+	{
+		FPSMuzzleFlashComp = CreateMuzzleFlashComponent(FPSMesh);
+		TPSMuzzleFlashComp = CreateMuzzleFlashComponent(TPSMesh);
+	}
+
 	// SERVER ONLY: Link FireComponent to BallisticsComponent
 	if (HasAuthority() && FireComponent && BallisticsComponent)
 	{
@@ -127,6 +355,8 @@ void ABaseWeapon::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifet
 
 void ABaseWeapon::OnRep_CurrentMagazine()
 {
+	FPSCORE_SCOPE_ONREP(ABaseWeapon_OnRep_CurrentMagazine);
+
 	if (CurrentMagazine)
 	{
 		if (BallisticsComponent)
@@ -147,6 +377,8 @@ void ABaseWeapon::SetOwner(AActor* NewOwner)
 
 void ABaseWeapon::OnRep_Owner()
 {
+	FPSCORE_SCOPE_ONREP(ABaseWeapon_OnRep_Owner);
+
 	Super::OnRep_Owner();
 	PropagateOwnerToChildActors(GetOwner());
 }
@@ -180,6 +412,8 @@ void ABaseWeapon::UseStop_Implementation(const FUseContext& Ctx)
 
 void ABaseWeapon::Server_Shoot_Implementation(bool bPressed)
 {
+	FPSCORE_SCOPE_RPC(ABaseWeapon_Server_Shoot);
+
 	if (!FireComponent) return;
 
 	if (bPressed)
@@ -299,87 +533,100 @@ UPrimitiveComponent* ABaseWeapon::GetTPSMeshComponent_Implementation() const
 
 FName ABaseWeapon::GetAttachSocket_Implementation() const
 {
-	return CharacterAttachSocket;
+	return GetDefinition().CharacterAttachSocket;
 }
 
 FName ABaseWeapon::GetReloadAttachSocket_Implementation() const
 {
-	return ReloadAttachSocket;
+	return GetDefinition().ReloadAttachSocket;
 }
 
 TSubclassOf<UAnimInstance> ABaseWeapon::GetAnimLayer_Implementation() const
 {
-	return AnimLayer;
+	return GetDefinition().AnimLayer;
 }
 
 float ABaseWeapon::GetLeaningScale_Implementation() const
 {
-	return LeaningScale;
+	return GetDefinition().LeaningScale;
 }
 
 float ABaseWeapon::GetBreathingScale_Implementation() const
 {
-	return BreathingScale;
+	return GetDefinition().BreathingScale;
 }
 
 void ABaseWeapon::HandleShotFired_Implementation(
 	FVector_NetQuantize MuzzleLocation,
-	FVector_NetQuantizeNormal Direction)
+	FVector_NetQuantizeNormal Direction,
+	float TraceDistance)
 {
 	if (HasAuthority())
 	{
 		// Single Multicast handles all visual effects
 		// Each client locally determines what to render based on IsLocallyControlled()
-		Multicast_PlayShootEffects();
+		Multicast_PlayShootEffects(MuzzleLocation, Direction, TraceDistance);
 	}
 }
 
 void ABaseWeapon::HandleImpactDetected_Implementation(
 	const TSoftObjectPtr<UNiagaraSystem>& ImpactVFX,
+	const TSoftObjectPtr<UMaterialInterface>& ImpactDecal,
 	FVector_NetQuantize Location,
 	FVector_NetQuantizeNormal Normal)
 {
 	if (HasAuthority())
 	{
-		Multicast_SpawnImpactEffect(ImpactVFX, Location, Normal);
+		Multicast_SpawnImpactEffect(ImpactVFX, ImpactDecal, Location, Normal);
 	}
 }
 
-void ABaseWeapon::SpawnMuzzleFlashOnMesh(USkeletalMeshComponent* Mesh, bool bIsFirstPerson)
+UNiagaraComponent* ABaseWeapon::CreateMuzzleFlashComponent(USkeletalMeshComponent* Mesh)
 {
 	if (!MuzzleFlashNiagara || !Mesh)
 	{
-		return;
+		return nullptr;
 	}
 
-	UNiagaraComponent* NiagaraComp = UNiagaraFunctionLibrary::SpawnSystemAttached(
-		MuzzleFlashNiagara,
-		Mesh,
-		FName("barrel"),
-		FVector::ZeroVector,
-		FRotator::ZeroRotator,
-		EAttachLocation::SnapToTarget,
-		true,
-		true,
-		ENCPoolMethod::AutoRelease
-	);
+	UNiagaraComponent* NiagaraComp = NewObject<UNiagaraComponent>(this);
+	NiagaraComp->SetAsset(MuzzleFlashNiagara);
+	NiagaraComp->SetAutoActivate(false);
+	NiagaraComp->SetupAttachment(Mesh, GetMuzzleFlashSocket());
+	NiagaraComp->RegisterComponent();
 
-	// Niagara visibility is handled by spawning on the correct mesh:
+	// Pre-warm: system instance created now, first shot only resets it
+	NiagaraComp->InitializeSystem();
+
+	// Niagara visibility is handled by attaching to the correct mesh:
 	// - FPSMesh has OnlyOwnerSee=true (only local player sees)
 	// - TPSMesh has OwnerNoSee=true (only other players see)
-	// No need to set visibility flags on Niagara - it inherits from attachment context
-	//
-	// NOTE: SetOnlyOwnerSee on Niagara doesn't work correctly because the Owner
-	// of dynamically spawned components is the Weapon actor, not the Pawn.
-	(void)NiagaraComp;
+	// PlayMuzzleFlash only ever triggers the emitter matching the local perspective
+	return NiagaraComp;
 }
 
-void ABaseWeapon::Multicast_PlayShootEffects_Implementation()
+void ABaseWeapon::PlayMuzzleFlash(bool bIsFirstPerson)
 {
+	UNiagaraComponent* NiagaraComp = bIsFirstPerson ? FPSMuzzleFlashComp : TPSMuzzleFlashComp;
+	if (!NiagaraComp)
+	{
+		return;
+	}
+
+	// Restart in place - same component, attachment and system instance every round
+	NiagaraComp->Activate(true);
+}
+
+void ABaseWeapon::Multicast_PlayShootEffects_Implementation(
+	FVector_NetQuantize TracerOrigin,
+	FVector_NetQuantizeNormal TracerDirection,
+	float TracerDistance)
+{
+	FPSCORE_SCOPE_RPC(ABaseWeapon_Multicast_PlayShootEffects);
+
 	// ============================================
 	// STEP 1: EARLY OUT FOR DEDICATED SERVER
 	// ============================================
-	// Dedicated servers don't render - skip particle spawning
+	// Dedicated servers don't render - skip muzzle flash
 	// BUT keep animations running for physics/hitbox updates
 	const bool bIsDedicatedServer = (GetNetMode() == NM_DedicatedServer);
 
@@ -390,20 +637,29 @@ void ABaseWeapon::Multicast_PlayShootEffects_Implementation()
 	APawn* OwnerPawn = WeaponOwner ? Cast<APawn>(WeaponOwner) : nullptr;
 	const bool bIsLocallyControlled = OwnerPawn && OwnerPawn->IsLocallyControlled();
 
+	// Remote proxies: cosmetic detail from significance (Full on server / own pawn)
+	UFPSCharacterSignificanceSubsystem::NotifyCombatEventFor(WeaponOwner);
+	const EFPSProxyDetail ProxyDetail = UFPSCharacterSignificanceSubsystem::GetDetailFor(WeaponOwner);
+
 	// ============================================
 	// STEP 3: MUZZLE FLASH VFX (Skip on dedicated server)
 	// ============================================
 	if (!bIsDedicatedServer)
 	{
-		if (bIsLocallyControlled)
+		// FPS VIEW: FPSMesh emitter (OnlyOwnerSee), TPS VIEW: TPSMesh emitter (OwnerNoSee)
+		// Far / off-screen proxies skip the flash (tracer below stays - it may fly past the viewer)
+		if (ProxyDetail != EFPSProxyDetail::Minimal)
 		{
-			// FPS VIEW: Spawn on FPSMesh (OnlyOwnerSee)
-			SpawnMuzzleFlashOnMesh(FPSMesh, true);
+			PlayMuzzleFlash(bIsLocallyControlled);
 		}
-		else
+
+		// Tracer: pooled ring buffer, view/distance culled (all perspectives)
+		if (TracerMesh && TracerDistance > 0.0f)
 		{
-			// TPS VIEW: Spawn on TPSMesh (OwnerNoSee)
-			SpawnMuzzleFlashOnMesh(TPSMesh, false);
+			if (UFPSTracerSubsystem* Tracers = GetWorld()->GetSubsystem<UFPSTracerSubsystem>())
+			{
+				Tracers->AddTracer(TracerMesh, TracerOrigin, TracerDirection, TracerDistance);
+			}
 		}
 	}
 
@@ -414,6 +670,7 @@ void ABaseWeapon::Multicast_PlayShootEffects_Implementation()
 	// Reason: Animation drives physics, hitboxes, IK, and gameplay state
 	// Visibility is handled by mesh settings (OwnerNoSee, OnlyOwnerSee)
 
+	UAnimMontage* ShootMontage = GetDefinition().ShootMontage;
 	if (!ShootMontage || !WeaponOwner)
 	{
 		return;
@@ -441,8 +698,9 @@ void ABaseWeapon::Multicast_PlayShootEffects_Implementation()
 	// --- TPS ANIMATIONS (All machines for remote view) ---
 	// Body/Legs have OwnerNoSee, so owning client won't see them rendering
 	// But animation still plays for physics synchronization and remote clients
+	// Proxies: Body skipped when far / off-screen
 	USkeletalMeshComponent* BodyMesh = ICharacterMeshProviderInterface::Execute_GetBodyMesh(WeaponOwner);
-	if (BodyMesh)
+	if (BodyMesh && ProxyDetail != EFPSProxyDetail::Minimal)
 	{
 		if (UAnimInstance* AnimInst = BodyMesh->GetAnimInstance())
 		{
@@ -462,25 +720,37 @@ void ABaseWeapon::Multicast_PlayShootEffects_Implementation()
 
 void ABaseWeapon::Multicast_SpawnImpactEffect_Implementation(
 	const TSoftObjectPtr<UNiagaraSystem>& ImpactVFX,
+	const TSoftObjectPtr<UMaterialInterface>& ImpactDecal,
 	FVector_NetQuantize Location,
 	FVector_NetQuantizeNormal Normal)
 {
+	FPSCORE_SCOPE_RPC(ABaseWeapon_Multicast_SpawnImpactEffect);
+
+	// Dedicated servers don't render - skip load + submission
+	if (GetNetMode() == NM_DedicatedServer)
+	{
+		return;
+	}
+
+	// Batched per VFX asset, budgeted and distance culled (see UFPSImpactEffectSubsystem)
 	UNiagaraSystem* VFX = ImpactVFX.LoadSynchronous();
+	UFPSImpactEffectSubsystem* ImpactEffects = GetWorld()->GetSubsystem<UFPSImpactEffectSubsystem>();
+
+	if (VFX && ImpactEffects)
+	{
+		ImpactEffects->AddImpact(VFX, Location, Normal);
+	}
 
-	if (VFX)
+	// Bullet hole: ring buffer per decal material, placed once per frame (see UFPSDecalSubsystem)
+	if (!ImpactDecal.IsNull())
 	{
-		FRotator ImpactRotation = FRotationMatrix::MakeFromZ(Normal).Rotator();
+		UMaterialInterface* DecalMaterial = ImpactDecal.LoadSynchronous();
+		UFPSDecalSubsystem* Decals = GetWorld()->GetSubsystem<UFPSDecalSubsystem>();
 
-		UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-			GetWorld(),
-			VFX,
-			Location,
-			ImpactRotation,
-			FVector(1.0f),
-			true,
-			true,
-			ENCPoolMethod::AutoRelease
-		);
+		if (DecalMaterial && Decals)
+		{
+			Decals->AddDecal(DecalMaterial, Location, Normal);
+		}
 	}
 }
 
@@ -597,6 +867,8 @@ void ABaseWeapon::AttachSightMeshes()
 
 void ABaseWeapon::OnRep_CurrentSight()
 {
+	FPSCORE_SCOPE_ONREP(ABaseWeapon_OnRep_CurrentSight);
+
 	if (CurrentSight)
 	{
 		CurrentSight->SetOwner(GetOwner());
@@ -705,7 +977,7 @@ float ABaseWeapon::GetAimingFOV_Implementation() const
 			return SightFOV;
 		}
 	}
-	return AimFOV;
+	return GetDefinition().AimFOV;
 }
 
 float ABaseWeapon::GetAimLookSpeed_Implementation() const
@@ -714,7 +986,7 @@ float ABaseWeapon::GetAimLookSpeed_Implementation() const
 	{
 		return ISightInterface::Execute_GetAimLookSpeed(CurrentSight);
 	}
-	return AimLookSpeed;
+	return GetDefinition().AimLookSpeed;
 }
 
 float ABaseWeapon::GetAimLeaningScale_Implementation() const
@@ -784,12 +1056,31 @@ bool ABaseWeapon::CanBeUnequipped_Implementation() const
 
 UAnimMontage* ABaseWeapon::GetEquipMontage_Implementation() const
 {
-	return EquipMontage;
+	return GetDefinition().EquipMontage;
 }
 
 UAnimMontage* ABaseWeapon::GetUnequipMontage_Implementation() const
 {
-	return UnequipMontage;
+	return GetDefinition().UnequipMontage;
+}
+
+void ABaseWeapon::GetPreloadAssets_Implementation(TArray<FSoftObjectPath>& OutAssets) const
+{
+	const FWeaponDefinition& Definition = GetDefinition();
+	OutAssets.Add(FSoftObjectPath(Definition.ShootMontage));
+	OutAssets.Add(FSoftObjectPath(Definition.ReloadMontage));
+
+	const bool bIncludeCosmetics = GetNetMode() != NM_DedicatedServer;
+	if (bIncludeCosmetics)
+	{
+		OutAssets.Add(FSoftObjectPath(MuzzleFlashNiagara));
+		OutAssets.Add(FSoftObjectPath(TracerMesh));
+	}
+
+	if (BallisticsComponent)
+	{
+		BallisticsComponent->GetPreloadAssets(OutAssets, bIncludeCosmetics);
+	}
 }
 
 bool ABaseWeapon::IsEquipping_Implementation() const
@@ -1,46 +1,47 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Components/BallisticsComponent.h"
+#include "BaseWeapon.h"
 #include "Data/AmmoTypeDataAsset.h"
 #include "Kismet/GameplayStatics.h"
 #include "NiagaraSystem.h"
+#include "Components/SkinnedMeshComponent.h"
+#include "Materials/MaterialInterface.h"
 #include "DrawDebugHelpers.h"
 #include "Interfaces/BallisticsHandlerInterface.h"
+#include "Core/FPSCoreStats.h"
+#include "Core/FPSTelemetrySubsystem.h"
+#include "Core/FPSCombatReplaySubsystem.h"
+#include "Core/FPSHitboxSubsystem.h"
+#include "Core/FPSBallisticsSubsystem.h"
 
 UBallisticsComponent::UBallisticsComponent()
 {
 	PrimaryComponentTick.bCanEverTick = false;
 	SetIsReplicatedByDefault(false);
 	CurrentAmmoType = nullptr;
-
-	// 5.56x45mm NATO - M4A1, M16, SCAR-L, HK416
-	TSoftObjectPtr<UAmmoTypeDataAsset> AmmoType_556NATO(FSoftObjectPath(TEXT("/Script/FPSCore.AmmoTypeDataAsset'/FPSCore/Blueprints/Weapons/AmmoTypes/AmmoType_5_56x45mm_NATO.AmmoType_5_56x45mm_NATO'")));
-	CaliberDataMap.Add(EAmmoCaliberType::NATO_556x45mm, AmmoType_556NATO);
-
-	// 7.62x51mm NATO / .308 Win - Sako 85, G3, FAL, M14, SR-25
-	TSoftObjectPtr<UAmmoTypeDataAsset> AmmoType_762NATO(FSoftObjectPath(TEXT("/Script/FPSCore.AmmoTypeDataAsset'/FPSCore/Blueprints/Weapons/AmmoTypes/AmmoType_7_62x51mm_NATO.AmmoType_7_62x51mm_NATO'")));
-	CaliberDataMap.Add(EAmmoCaliberType::NATO_762x51mm, AmmoType_762NATO);
-
-	// 9x19mm Parabellum - VP9, Glock, MP5, UZI
-	TSoftObjectPtr<UAmmoTypeDataAsset> AmmoType_9mm(FSoftObjectPath(TEXT("/Script/FPSCore.AmmoTypeDataAsset'/FPSCore/Blueprints/Weapons/AmmoTypes/AmmoType_9mm.AmmoType_9mm'")));
-	CaliberDataMap.Add(EAmmoCaliberType::Parabellum_9x19mm, AmmoType_9mm);
-
-	// 12 Gauge Buckshot - SPAS-12, Remington 870, Benelli M4
-	TSoftObjectPtr<UAmmoTypeDataAsset> AmmoType_12Gauge(FSoftObjectPath(TEXT("/Script/FPSCore.AmmoTypeDataAsset'/FPSCore/Blueprints/Weapons/AmmoTypes/AmmoType_12_Gauge_Buckshot.AmmoType_12_Gauge_Buckshot'")));
-	CaliberDataMap.Add(EAmmoCaliberType::Gauge_12, AmmoType_12Gauge);
-
-	// Pre-load all ammo types into cache (small data assets, safe to sync load in constructor)
-	PreloadAmmoTypes();
 }
 
 void UBallisticsComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// Unseeded Shoot() calls still get varied pellet patterns
+	ShotRandom.GenerateNewSeed();
+
+	PreloadAmmoTypes();
 }
 
 void UBallisticsComponent::PreloadAmmoTypes()
 {
-	for (auto& Pair : CaliberDataMap)
+	// Small data assets, usually already resident from pickup preload - resolved here so
+	// the first shot never hits a sync load
+	if (LoadedAmmoTypes.Num() > 0)
+	{
+		return;
+	}
+
+	for (const TPair<EAmmoCaliberType, TSoftObjectPtr<UAmmoTypeDataAsset>>& Pair : ABaseWeapon::GetDefinitionFor(GetOwner()).CaliberDataMap)
 	{
 		if (!Pair.Value.IsNull())
 		{
@@ -52,8 +53,29 @@ void UBallisticsComponent::PreloadAmmoTypes()
 	}
 }
 
+void UBallisticsComponent::ShootWithSeed(const FVector& Location, const FVector& Direction, int32 Seed)
+{
+	ShotRandom.Initialize(Seed);
+	ShotSeed = Seed;
+
+	// Live shots only - replayed shots must not be re-recorded
+	if (!ReplayOutcomes)
+	{
+		if (UFPSCombatReplaySubsystem* Recorder = GetWorld()->GetSubsystem<UFPSCombatReplaySubsystem>())
+		{
+			Recorder->RecordShot(this, Location, Direction, Seed);
+		}
+	}
+
+	Shoot(Location, Direction);
+
+	ShotSeed = 0;
+}
+
 void UBallisticsComponent::Shoot(FVector Location, FVector Direction)
 {
+	FPSCORE_SCOPE_CYCLE(STAT_FPSCore_Shoot);
+
 	if (!GetOwner()->HasAuthority())
 	{
 		return;
@@ -64,153 +86,283 @@ void UBallisticsComponent::Shoot(FVector Location, FVector Direction)
 		return;
 	}
 
-	// ✅ Notify owner via IBallisticsHandlerInterface
-	// This allows BaseWeapon to spawn muzzle flash immediately
-	AActor* OwnerActor = GetOwner();
-	if (OwnerActor && OwnerActor->Implements<UBallisticsHandlerInterface>())
+	INC_DWORD_STAT(STAT_FPSCore_ShotsFired);
+	RecordTelemetryShot(Location, Direction);
+
+	FVector End = Location + (Direction * MaxTraceDistance);
+
+	TArray<FHitResult> HitResults;
+	const bool bHit = TraceShot(Location, End, HitResults);
+
+	// ✅ Notify owner via IBallisticsHandlerInterface (muzzle flash + tracer to first impact)
+	NotifyShotFired(Location, Direction, bHit ? HitResults[0].Distance : MaxTraceDistance);
+
+	if (!bHit)
 	{
-		IBallisticsHandlerInterface::Execute_HandleShotFired(
-			OwnerActor,
-			FVector_NetQuantize(Location),
-			FVector_NetQuantizeNormal(Direction)
-		);
+		return;
 	}
 
-	FVector End = Location + (Direction * MaxTraceDistance);
+	SubmitTrace(Location, Direction, MoveTemp(HitResults));
+}
 
-	FCollisionQueryParams TraceParams;
-	TraceParams.bTraceComplex = true;
-	TraceParams.bReturnPhysicalMaterial = true;
-	TraceParams.AddIgnoredActor(GetOwner());
-	if (GetOwner()->GetOwner())
+// ============================================
+// HIT PROCESSING
+// ============================================
+
+// Damage / impulse reference energy (J) - a hit at this KE deals the ammo's base Damage
+static constexpr float ReferenceKineticEnergy = 1500.0f;
+
+void UBallisticsComponent::SubmitTrace(const FVector& Location, const FVector& Direction, TArray<FHitResult>&& Hits)
+{
+	FBallisticsTrace Trace;
+	Trace.Ballistics = this;
+	Trace.AmmoType = CurrentAmmoType;
+	Trace.Ammo.MuzzleVelocity = CurrentAmmoType->MuzzleVelocity;
+	Trace.Ammo.ProjectileMass = CurrentAmmoType->ProjectileMass;
+	Trace.Ammo.PenetrationPower = CurrentAmmoType->PenetrationPower;
+	Trace.Ammo.DragCoefficient = CurrentAmmoType->DragCoefficient;
+	Trace.Ammo.Damage = CurrentAmmoType->Damage;
+	Trace.Location = Location;
+	Trace.Direction = Direction;
+	Trace.Hits = MoveTemp(Hits);
+
+	// Resolve everything UObject-backed now - the solve may run on worker threads
+	Trace.Surfaces.SetNum(Trace.Hits.Num());
+	for (int32 HitIndex = 0; HitIndex < Trace.Hits.Num(); HitIndex++)
 	{
-		TraceParams.AddIgnoredActor(GetOwner()->GetOwner());
+		const FHitResult& Hit = Trace.Hits[HitIndex];
+		FBallisticsHitSurface& Surface = Trace.Surfaces[HitIndex];
+		Surface.bHasActor = Hit.GetActor() != nullptr;
+		Surface.bIsThin = IsThinMaterial(Hit.PhysMaterial.Get(), Surface.MaterialName);
 	}
 
-	TArray<FHitResult> HitResults;
-	bool bHit = GetWorld()->LineTraceMultiByChannel(
-		HitResults,
-		Location,
-		End,
-		ECC_GameTraceChannel2,
-		TraceParams
-	);
-
-	if (HitResults.Num() == 0)
+	Trace.TelemetryShotId = CurrentTelemetryShotId;
+
+	// Replay times and reads outcomes per shot - no deferral
+	UFPSBallisticsSubsystem* Batch = ReplayOutcomes ? nullptr : GetWorld()->GetSubsystem<UFPSBallisticsSubsystem>();
+	if (Batch)
 	{
+		Batch->QueueTrace(MoveTemp(Trace));
 		return;
 	}
 
-	float Speed = CurrentAmmoType->MuzzleVelocity;
-	float Mass = CurrentAmmoType->ProjectileMass;
-	float Penetration = CurrentAmmoType->PenetrationPower;
-	float DropFactor = CurrentAmmoType->DragCoefficient;
+	SolveTrace(Trace);
+	ApplyHitCommands(Trace);
+}
+
+void UBallisticsComponent::SolveTrace(FBallisticsTrace& Trace)
+{
+	FPSCORE_SCOPE_CYCLE(STAT_FPSCore_SolveHits);
+
+	float Speed = Trace.Ammo.MuzzleVelocity;
+	float Mass = Trace.Ammo.ProjectileMass;
+	float Penetration = Trace.Ammo.PenetrationPower;
+	const float DropFactor = Trace.Ammo.DragCoefficient;
 	float KineticEnergy = 0.0f;
-	FVector LastHitLocation = Location;
+	FVector LastHitLocation = Trace.Location;
+
+	Trace.Commands.Reset();
 
-	for (int32 HitIndex = 0; HitIndex < HitResults.Num(); HitIndex++)
+	for (int32 HitIndex = 0; HitIndex < Trace.Hits.Num(); HitIndex++)
 	{
-		const FHitResult& Hit = HitResults[HitIndex];
-		bool bContinue = ProcessHit(Hit, HitIndex, Speed, Mass, Penetration, DropFactor, KineticEnergy, Direction, LastHitLocation);
+		const FBallisticsHitSurface& Surface = Trace.Surfaces[HitIndex];
+		const FVector ImpactPoint = Trace.Hits[HitIndex].ImpactPoint;
 
-		if (!bContinue)
+		if (!Surface.bHasActor)
+		{
+			LastHitLocation = ImpactPoint;
+			continue;
+		}
+
+		if (HitIndex == 0)
+		{
+			KineticEnergy = 0.5f * (Mass / 1000.0f) * Speed * Speed;
+		}
+
+		// Distance decay
+		const float DistanceTraveled = (ImpactPoint - LastHitLocation).Size();
+		ApplyDistanceDecay(Speed, Mass, DropFactor, KineticEnergy, DistanceTraveled);
+
+		FBallisticsHitCommand& Command = Trace.Commands.AddDefaulted_GetRef();
+		Command.HitIndex = HitIndex;
+		Command.MaterialName = Surface.MaterialName;
+		Command.Damage = Trace.Ammo.Damage * (KineticEnergy / ReferenceKineticEnergy);
+		Command.Speed = Speed;
+		Command.KineticEnergy = KineticEnergy;
+
+		// Momentum (kg * cm/s) scaled by sqrt of relative KE
+		const float Momentum = (Mass / 1000.0f) * (Speed * 100.0f);
+		Command.ImpulseMagnitude = Momentum * FMath::Sqrt(KineticEnergy / ReferenceKineticEnergy);
+
+		Command.bPenetrated = ApplyPenetrationLoss(Speed, Mass, Penetration, DropFactor, KineticEnergy, Surface.bIsThin);
+		if (!Command.bPenetrated)
 		{
 			break;
 		}
 
-		LastHitLocation = Hit.ImpactPoint;
+		LastHitLocation = ImpactPoint;
 	}
 }
 
-bool UBallisticsComponent::ProcessHit(
-	const FHitResult& Hit,
-	int32 HitIndex,
-	float& Speed,
-	float& Mass,
-	float& Penetration,
-	float DropFactor,
-	float& KineticEnergy,
-	const FVector& Direction,
-	const FVector& LastHitLocation)
+void UBallisticsComponent::ApplyHitCommands(const FBallisticsTrace& Trace)
 {
-	AActor* HitActor = Hit.GetActor();
-	FVector ImpactPoint = Hit.ImpactPoint;
-	FVector ImpactNormal = Hit.ImpactNormal;
-	UPhysicalMaterial* PhysMaterial = Hit.PhysMaterial.Get();
-	FName BoneName = Hit.BoneName;
+	FPSCORE_SCOPE_CYCLE(STAT_FPSCore_ApplyHits);
+
+	AActor* Weapon = GetOwner();  // BaseWeapon
+	AActor* Character = Weapon ? Weapon->GetOwner() : nullptr;  // FPSCharacter (weapon's owner)
+	const UAmmoTypeDataAsset* AmmoType = Trace.AmmoType.Get();
+	UFPSTelemetrySubsystem* Telemetry = Trace.TelemetryShotId != 0 ? GetWorld()->GetSubsystem<UFPSTelemetrySubsystem>() : nullptr;
 
-	if (!HitActor)
+	for (const FBallisticsHitCommand& Command : Trace.Commands)
 	{
-		return true;
+		INC_DWORD_STAT(STAT_FPSCore_HitsProcessed);
+
+		const FHitResult& Hit = Trace.Hits[Command.HitIndex];
+		const FName BoneName = Hit.BoneName;
+
+		// Destroyed between trace and apply (earlier shot in the same batch)
+		AActor* HitActor = Hit.GetActor();
+		if (!HitActor)
+		{
+			continue;
+		}
+
+		// Notify owner via IBallisticsHandlerInterface for impact VFX + bullet hole
+		UNiagaraSystem* ImpactVFX = AmmoType ? AmmoType->GetImpactVFX(Command.MaterialName) : nullptr;
+
+		// Decals only on surfaces that never move: skeletal meshes animate, movable bodies would leave the hole floating
+		TSoftObjectPtr<UMaterialInterface> ImpactDecal;
+		const UPrimitiveComponent* ImpactComponent = Hit.GetComponent();
+		if (AmmoType && ImpactComponent && !ImpactComponent->IsA<USkinnedMeshComponent>() && ImpactComponent->Mobility != EComponentMobility::Movable)
+		{
+			ImpactDecal = AmmoType->GetImpactDecal(Command.MaterialName);
+		}
+
+		if ((ImpactVFX || !ImpactDecal.IsNull()) && !ReplayOutcomes)
+		{
+			if (Weapon && Weapon->Implements<UBallisticsHandlerInterface>())
+			{
+				IBallisticsHandlerInterface::Execute_HandleImpactDetected(
+					Weapon,
+					ImpactVFX,
+					ImpactDecal,
+					FVector_NetQuantize(Hit.ImpactPoint),
+					FVector_NetQuantizeNormal(Hit.ImpactNormal)
+				);
+			}
+		}
+
+		// Replay: capture outcome, skip all side effects (damage, impulse)
+		if (ReplayOutcomes)
+		{
+			FBallisticsHitOutcome& Outcome = ReplayOutcomes->AddDefaulted_GetRef();
+			Outcome.HitActor = HitActor;
+			Outcome.BoneName = BoneName;
+			Outcome.Damage = FMath::Max(Command.Damage, 0.0f);
+			Outcome.KineticEnergy = Command.KineticEnergy;
+			continue;
+		}
+
+		if (Command.Damage > 0.0f)
+		{
+			UGameplayStatics::ApplyPointDamage(
+				HitActor,
+				Command.Damage,
+				Trace.Direction,
+				Hit,
+				Weapon ? Weapon->GetInstigatorController() : nullptr,
+				Character,  // DamageCauser = FPSCharacter who fired the weapon
+				UDamageType::StaticClass()
+			);
+		}
+
+		if (Telemetry)
+		{
+			Telemetry->RecordHit(Trace.TelemetryShotId, HitActor, BoneName, Command.MaterialName, Command.Speed, Command.KineticEnergy, FMath::Max(Command.Damage, 0.0f));
+		}
+
+		UPrimitiveComponent* HitComponent = Hit.GetComponent();
+		if (HitComponent && HitComponent->IsSimulatingPhysics(BoneName))
+		{
+			HitComponent->AddImpulseAtLocation(Trace.Direction * Command.ImpulseMagnitude, Hit.ImpactPoint, BoneName);
+		}
+
+		if (Command.bPenetrated)
+		{
+			INC_DWORD_STAT(STAT_FPSCore_Penetrations);
+		}
 	}
+}
 
-	if (HitIndex == 0)
+void UBallisticsComponent::NotifyShotFired(const FVector& Location, const FVector& Direction, float TraceDistance)
+{
+	AActor* OwnerActor = GetOwner();
+	if (!ReplayOutcomes && OwnerActor && OwnerActor->Implements<UBallisticsHandlerInterface>())
 	{
-		KineticEnergy = 0.5f * (Mass / 1000.0f) * Speed * Speed;
+		IBallisticsHandlerInterface::Execute_HandleShotFired(
+			OwnerActor,
+			FVector_NetQuantize(Location),
+			FVector_NetQuantizeNormal(Direction),
+			TraceDistance
+		);
 	}
+}
 
-	// Distance decay
-	float DistanceTraveled = (ImpactPoint - LastHitLocation).Size();
-	ApplyDistanceDecay(Speed, Mass, DropFactor, KineticEnergy, DistanceTraveled);
+bool UBallisticsComponent::TraceShot(const FVector& Start, const FVector& End, TArray<FHitResult>& OutHits) const
+{
+	AActor* Weapon = GetOwner();
+	AActor* Shooter = Weapon ? Weapon->GetOwner() : nullptr;
 
-	// Notify owner via IBallisticsHandlerInterface for impact VFX
-	FName MaterialName;
-	bool bIsThin = IsThinMaterial(PhysMaterial, MaterialName);
-	UNiagaraSystem* ImpactVFX = CurrentAmmoType->GetImpactVFX(MaterialName);
+	FCollisionQueryParams TraceParams;
+	TraceParams.bTraceComplex = true;
+	TraceParams.bReturnPhysicalMaterial = true;
+	TraceParams.AddIgnoredActor(Weapon);
+	if (Shooter)
+	{
+		TraceParams.AddIgnoredActor(Shooter);
+	}
 
-	if (ImpactVFX)
+	// Characters come from the hitbox layer - physics trace skips their body object type
+	FCollisionResponseParams ResponseParams;
+	UFPSHitboxSubsystem* Hitboxes = GetWorld()->GetSubsystem<UFPSHitboxSubsystem>();
+	if (Hitboxes)
 	{
-		AActor* OwnerActor = GetOwner();
-		if (OwnerActor && OwnerActor->Implements<UBallisticsHandlerInterface>())
-		{
-			IBallisticsHandlerInterface::Execute_HandleImpactDetected(
-				OwnerActor,
-				ImpactVFX,
-				FVector_NetQuantize(ImpactPoint),
-				FVector_NetQuantizeNormal(ImpactNormal)
-			);
-		}
+		Hitboxes->ExcludeHitboxBodies(ResponseParams);
 	}
 
-	const float ReferenceKE = 1500.0f;
-	float KE_Multiplier = KineticEnergy / ReferenceKE;
-	float FinalDamage = CurrentAmmoType->Damage * KE_Multiplier;
+	GetWorld()->LineTraceMultiByChannel(OutHits, Start, End, ECC_GameTraceChannel2, TraceParams, ResponseParams);
 
-	if (FinalDamage > 0.0f)
+	if (Hitboxes)
 	{
-		AActor* Weapon = GetOwner();  // BaseWeapon
-		AActor* Character = Weapon ? Weapon->GetOwner() : nullptr;  // FPSCharacter (weapon's owner)
-
-		UGameplayStatics::ApplyPointDamage(
-			HitActor,
-			FinalDamage,
-			Direction,
-			Hit,
-			Weapon ? Weapon->GetInstigatorController() : nullptr,
-			Character,  // DamageCauser = FPSCharacter who fired the weapon
-			UDamageType::StaticClass()
-		);
+		// Characters behind the blocking world hit are unreachable
+		const FVector CharacterEnd = (OutHits.Num() > 0 && OutHits.Last().bBlockingHit) ? OutHits.Last().Location : End;
+		const AActor* IgnoredActors[] = { Weapon, Shooter };
+
+		if (Hitboxes->Raycast(Start, CharacterEnd, IgnoredActors, OutHits) > 0)
+		{
+			OutHits.StableSort([](const FHitResult& A, const FHitResult& B) { return A.Distance < B.Distance; });
+		}
 	}
 
-	UPrimitiveComponent* HitComponent = Hit.GetComponent();
+	return OutHits.Num() > 0;
+}
 
-	if (HitComponent && HitComponent->IsSimulatingPhysics(BoneName))
+void UBallisticsComponent::RecordTelemetryShot(const FVector& Location, const FVector& Direction)
+{
+	CurrentTelemetryShotId = 0;
+
+	UFPSTelemetrySubsystem* Telemetry = GetWorld()->GetSubsystem<UFPSTelemetrySubsystem>();
+	if (!Telemetry || !Telemetry->IsRecording())
 	{
-		float MassKg = Mass / 1000.0f;
-		float SpeedCmPerSec = Speed * 100.0f;
-		float Momentum = MassKg * SpeedCmPerSec;
-		float KE_ImpulseMultiplier = FMath::Sqrt(KineticEnergy / ReferenceKE);
-		float ImpulseMagnitude = Momentum * KE_ImpulseMultiplier;
-		FVector Impulse = Direction * ImpulseMagnitude;
-
-		HitComponent->AddImpulseAtLocation(Impulse, ImpactPoint, BoneName);
+		return;
 	}
 
-	bool bCanContinue = ApplyPenetrationLoss(Speed, Mass, Penetration, DropFactor, KineticEnergy, PhysMaterial);
-	return bCanContinue;
+	AActor* Weapon = GetOwner();
+	AActor* Shooter = Weapon ? Weapon->GetOwner() : nullptr;
+	CurrentTelemetryShotId = Telemetry->RecordShot(Shooter, Weapon, Location, Direction, ShotSeed);
 }
 
-bool UBallisticsComponent::IsThinMaterial(UPhysicalMaterial* PhysMaterial, FName& OutMaterialName) const
+bool UBallisticsComponent::IsThinMaterial(const UPhysicalMaterial* PhysMaterial, FName& OutMaterialName)
 {
 	if (!PhysMaterial)
 	{
@@ -248,11 +400,8 @@ bool UBallisticsComponent::ApplyPenetrationLoss(
 	float& Penetration,
 	float DropFactor,
 	float& KineticEnergy,
-	UPhysicalMaterial* PhysMaterial)
+	bool bIsThin)
 {
-	FName MaterialName;
-	bool bIsThin = IsThinMaterial(PhysMaterial, MaterialName);
-
 	// SOLID: Block bullet
 	if (!bIsThin)
 	{
@@ -316,6 +465,12 @@ float UBallisticsComponent::CalculateKineticEnergy() const
 
 bool UBallisticsComponent::InitAmmoType(EAmmoCaliberType CaliberType)
 {
+	// Client OnRep_CurrentMagazine can arrive before BeginPlay
+	if (LoadedAmmoTypes.Num() == 0)
+	{
+		PreloadAmmoTypes();
+	}
+
 	// O(1) lookup from pre-loaded cache
 	if (UAmmoTypeDataAsset** CachedAsset = LoadedAmmoTypes.Find(CaliberType))
 	{
@@ -335,9 +490,36 @@ UAmmoTypeDataAsset* UBallisticsComponent::GetAmmoDataForCaliber(EAmmoCaliberType
 		return const_cast<UAmmoTypeDataAsset*>(*CachedAsset);
 	}
 
+	// Not initialized yet - only return if already resident (no load from const query)
+	if (const TSoftObjectPtr<UAmmoTypeDataAsset>* AmmoTypePtr = ABaseWeapon::GetDefinitionFor(GetOwner()).CaliberDataMap.Find(CaliberType))
+	{
+		return AmmoTypePtr->Get();
+	}
+
 	return nullptr;
 }
 
+void UBallisticsComponent::GetPreloadAssets(TArray<FSoftObjectPath>& OutAssets, bool bIncludeCosmetics) const
+{
+	OutAssets.Add(CaliberDataAsset.ToSoftObjectPath());
+
+	for (const TPair<EAmmoCaliberType, TSoftObjectPtr<UAmmoTypeDataAsset>>& Pair : ABaseWeapon::GetDefinitionFor(GetOwner()).CaliberDataMap)
+	{
+		OutAssets.Add(Pair.Value.ToSoftObjectPath());
+
+		// Effects are soft references inside the data asset - only reachable once it is loaded
+		if (const UAmmoTypeDataAsset* AmmoType = Pair.Value.Get())
+		{
+			AmmoType->GetPreloadAssets(OutAssets, bIncludeCosmetics);
+		}
+	}
+
+	if (const UAmmoTypeDataAsset* AmmoType = CaliberDataAsset.Get())
+	{
+		AmmoType->GetPreloadAssets(OutAssets, bIncludeCosmetics);
+	}
+}
+
 void UBallisticsComponent::DebugPrintCaliberData() const
 {
 }
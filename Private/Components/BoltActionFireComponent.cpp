@@ -8,6 +8,7 @@
 #include "Interfaces/AmmoConsumerInterface.h"
 #include "Animation/AnimInstance.h"
 #include "Net/UnrealNetwork.h"
+#include "Core/FPSCoreStats.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogBoltActionFire, Log, All);
 
@@ -15,11 +16,6 @@ UBoltActionFireComponent::UBoltActionFireComponent()
 {
 	PrimaryComponentTick.bCanEverTick = false;
 	SetIsReplicatedByDefault(true);
-
-	// Bolt-action defaults
-	FireRate = 40.0f;  // ~40 RPM theoretical max (bolt-action limited)
-	SpreadScale = 0.3f;  // High accuracy (sniper rifle)
-	RecoilScale = 1.5f;  // Higher recoil (high-powered rifle)
 }
 
 void UBoltActionFireComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -36,6 +32,8 @@ void UBoltActionFireComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProper
 
 void UBoltActionFireComponent::OnRep_IsCyclingBolt()
 {
+	FPSCORE_SCOPE_ONREP(UBoltActionFireComponent_OnRep_IsCyclingBolt);
+
 	UE_LOG(LogBoltActionFire, Log, TEXT("[Client] OnRep_IsCyclingBolt: %s"), bIsCyclingBolt ? TEXT("true") : TEXT("false"));
 
 	PropagateStateToAnimInstances();
@@ -55,6 +53,8 @@ void UBoltActionFireComponent::OnRep_IsCyclingBolt()
 
 void UBoltActionFireComponent::OnRep_ChamberEmpty()
 {
+	FPSCORE_SCOPE_ONREP(UBoltActionFireComponent_OnRep_ChamberEmpty);
+
 	PropagateStateToAnimInstances();
 }
 
@@ -0,0 +1,194 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Components/BotDriverComponent.h"
+#include "FPSCharacter.h"
+#include "EnhancedInputSubsystems.h"
+#include "InputAction.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/LocalPlayer.h"
+
+UBotDriverComponent::UBotDriverComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+
+	// Input must be injected before PlayerController processes input this frame
+	PrimaryComponentTick.TickGroup = TG_PrePhysics;
+
+	// NOT replicated - drives local input only
+	SetIsReplicatedByDefault(false);
+}
+
+void UBotDriverComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	DecisionTimer = 0.0f;
+	FireTimer = 0.0f;
+}
+
+void UBotDriverComponent::SetSeed(int32 Seed)
+{
+	Stream.Initialize(Seed);
+}
+
+// ============================================
+// TICK
+// ============================================
+
+void UBotDriverComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	const APlayerController* PC = Cast<APlayerController>(GetOwner());
+	if (!PC || !PC->IsLocalController())
+	{
+		return;
+	}
+
+	// Framework-level cast: bot reads the pawn's input action assets (same bindings as a human)
+	const AFPSCharacter* Character = Cast<AFPSCharacter>(PC->GetPawn());
+	if (!Character)
+	{
+		// Dead / not yet possessed - drop held state so nothing stays pressed across respawn
+		MoveInput = FVector2D::ZeroVector;
+		LookRate = FVector2D::ZeroVector;
+		bHoldSprint = bHoldCrouch = bHoldAim = false;
+		FireTimer = 0.0f;
+		PendingTaps.Reset();
+		return;
+	}
+
+	DecisionTimer -= DeltaTime;
+	if (DecisionTimer <= 0.0f)
+	{
+		MakeDecision(Character);
+		DecisionTimer = Stream.FRandRange(DecisionInterval.X, DecisionInterval.Y);
+	}
+
+	// Held actions - re-injected every frame (Started on first frame, Completed when injection stops)
+	if (!MoveInput.IsNearlyZero())
+	{
+		Inject(Character->IA_Move, FInputActionValue(MoveInput));
+	}
+
+	if (!LookRate.IsNearlyZero())
+	{
+		Inject(Character->IA_Look_Yaw, FInputActionValue(LookRate.X * DeltaTime));
+		Inject(Character->IA_Look_Pitch, FInputActionValue(LookRate.Y * DeltaTime));
+	}
+
+	if (bHoldSprint)
+	{
+		Inject(Character->IA_Sprint, FInputActionValue(true));
+	}
+
+	if (bHoldCrouch)
+	{
+		Inject(Character->IA_Crouch, FInputActionValue(true));
+	}
+
+	if (bHoldAim)
+	{
+		Inject(Character->IA_Aim, FInputActionValue(true));
+	}
+
+	if (FireTimer > 0.0f)
+	{
+		FireTimer -= DeltaTime;
+		Inject(Character->IA_Shoot, FInputActionValue(true));
+	}
+
+	// One-shot actions - single frame
+	for (const UInputAction* Action : PendingTaps)
+	{
+		Inject(Action, FInputActionValue(true));
+	}
+	PendingTaps.Reset();
+}
+
+// ============================================
+// SCRIPT
+// ============================================
+
+void UBotDriverComponent::MakeDecision(const AFPSCharacter* Character)
+{
+	// Movement: random direction, occasionally stand still
+	if (Stream.FRand() < 0.2f)
+	{
+		MoveInput = FVector2D::ZeroVector;
+	}
+	else
+	{
+		const float Angle = Stream.FRandRange(0.0f, 2.0f * PI);
+		MoveInput = FVector2D(FMath::Sin(Angle), FMath::Cos(Angle));
+	}
+
+	// Look: yaw sweeps freely, pitch rate biased small (stays inside ±45° spine range)
+	LookRate.X = Stream.FRandRange(-MaxLookRate, MaxLookRate);
+	LookRate.Y = Stream.FRandRange(-MaxLookRate, MaxLookRate) * 0.25f;
+
+	// Stance toggles
+	if (Stream.FRand() < StanceChance)
+	{
+		bHoldSprint = !bHoldSprint;
+		bHoldCrouch = false;
+	}
+	if (Stream.FRand() < StanceChance)
+	{
+		bHoldCrouch = !bHoldCrouch && !bHoldSprint;
+	}
+	if (Stream.FRand() < StanceChance)
+	{
+		bHoldAim = !bHoldAim;
+	}
+
+	// Fire burst (full-auto weapons keep firing, semi-auto fires once per burst)
+	if (FireTimer <= 0.0f && Stream.FRand() < FireChance)
+	{
+		FireTimer = Stream.FRandRange(FireDuration.X, FireDuration.Y);
+	}
+
+	if (Stream.FRand() < ReloadChance)
+	{
+		PendingTaps.Add(Character->IA_Reload);
+	}
+
+	if (Stream.FRand() < JumpChance)
+	{
+		PendingTaps.Add(Character->IA_Jump);
+	}
+
+	if (Stream.FRand() < SwapChance)
+	{
+		const UInputAction* ItemActions[] = { Character->IA_Item_1, Character->IA_Item_2, Character->IA_Item_3, Character->IA_Item_4 };
+		PendingTaps.Add(ItemActions[Stream.RandRange(0, UE_ARRAY_COUNT(ItemActions) - 1)]);
+	}
+}
+
+// ============================================
+// HELPERS
+// ============================================
+
+void UBotDriverComponent::Inject(const UInputAction* Action, const FInputActionValue& Value)
+{
+	if (!Action)
+	{
+		return;
+	}
+
+	if (UEnhancedInputLocalPlayerSubsystem* Subsystem = GetInputSubsystem())
+	{
+		Subsystem->InjectInputForAction(Action, Value, {}, {});
+	}
+}
+
+UEnhancedInputLocalPlayerSubsystem* UBotDriverComponent::GetInputSubsystem() const
+{
+	const APlayerController* PC = Cast<APlayerController>(GetOwner());
+	if (!PC)
+	{
+		return nullptr;
+	}
+
+	return ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PC->GetLocalPlayer());
+}
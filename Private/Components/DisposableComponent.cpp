@@ -6,6 +6,7 @@
 #include "Animation/AnimInstance.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "GameFramework/Pawn.h"
+#include "Core/FPSCoreStats.h"
 
 UDisposableComponent::UDisposableComponent()
 {
@@ -44,6 +45,8 @@ void UDisposableComponent::StartDropSequence()
 
 void UDisposableComponent::Multicast_PlayDropMontage_Implementation()
 {
+	FPSCORE_SCOPE_RPC(UDisposableComponent_Multicast_PlayDropMontage);
+
 	PlayDropMontageOnCharacter();
 }
 
@@ -0,0 +1,64 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Components/DroppedItemComponent.h"
+#include "Core/FPSDroppedItemSubsystem.h"
+#include "Core/FPSCoreStats.h"
+#include "Engine/World.h"
+#include "Net/UnrealNetwork.h"
+
+UDroppedItemComponent::UDroppedItemComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+	SetIsReplicatedByDefault(true);
+}
+
+void UDroppedItemComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(UDroppedItemComponent, RestState);
+}
+
+void UDroppedItemComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Loose in the world from the start (level-placed, spawned as loot)
+	// Level-placed pickups are designer content - rest/dormancy only, never evicted by the item cap
+	AActor* Item = GetOwner();
+	if (Item && Item->HasAuthority() && Item->GetOwner() == nullptr)
+	{
+		if (UFPSDroppedItemSubsystem* DroppedItems = GetWorld()->GetSubsystem<UFPSDroppedItemSubsystem>())
+		{
+			DroppedItems->RegisterDroppedItem(Item, !Item->IsNetStartupActor());
+		}
+	}
+}
+
+void UDroppedItemComponent::SetRestState(const FTransform& RestTransform)
+{
+	RestState.bAtRest = true;
+	RestState.Location = RestTransform.GetLocation();
+	RestState.Rotation = RestTransform.Rotator();
+}
+
+void UDroppedItemComponent::ClearRestState()
+{
+	RestState.bAtRest = false;
+}
+
+void UDroppedItemComponent::OnRep_RestState()
+{
+	FPSCORE_SCOPE_ONREP(UDroppedItemComponent_OnRep_RestState);
+
+	if (!RestState.bAtRest)
+	{
+		// Wake is driven by pickup (PerformPickup → UnregisterItem)
+		return;
+	}
+
+	if (UFPSDroppedItemSubsystem* DroppedItems = GetWorld() ? GetWorld()->GetSubsystem<UFPSDroppedItemSubsystem>() : nullptr)
+	{
+		DroppedItems->ApplyRestState(GetOwner(), GetRestTransform());
+	}
+}
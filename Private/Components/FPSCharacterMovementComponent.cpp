@@ -0,0 +1,153 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Components/FPSCharacterMovementComponent.h"
+#include "FPSCharacter.h"
+
+UFPSCharacterMovementComponent::UFPSCharacterMovementComponent()
+{
+	bWantsToSprint = false;
+	bWantsToWalk = false;
+	bWantsToAim = false;
+}
+
+void UFPSCharacterMovementComponent::ClearMovementIntent()
+{
+	bWantsToSprint = false;
+	bWantsToWalk = false;
+	bWantsToAim = false;
+}
+
+// ============================================
+// PREDICTION
+// ============================================
+
+void UFPSCharacterMovementComponent::UpdateFromCompressedFlags(uint8 Flags)
+{
+	Super::UpdateFromCompressedFlags(Flags);
+
+	bWantsToSprint = (Flags & FSavedMove_Character::FLAG_Custom_0) != 0;
+	bWantsToWalk = (Flags & FSavedMove_Character::FLAG_Custom_1) != 0;
+	bWantsToAim = (Flags & FSavedMove_Character::FLAG_Custom_2) != 0;
+}
+
+FNetworkPredictionData_Client* UFPSCharacterMovementComponent::GetPredictionData_Client() const
+{
+	if (!ClientPredictionData)
+	{
+		UFPSCharacterMovementComponent* MutableThis = const_cast<UFPSCharacterMovementComponent*>(this);
+		MutableThis->ClientPredictionData = new FNetworkPredictionData_Client_FPSCharacter(*this);
+	}
+
+	return ClientPredictionData;
+}
+
+void UFPSCharacterMovementComponent::UpdateCharacterStateBeforeMovement(float DeltaSeconds)
+{
+	Super::UpdateCharacterStateBeforeMovement(DeltaSeconds);
+
+	AFPSCharacter* FPSCharacter = Cast<AFPSCharacter>(CharacterOwner);
+	if (!FPSCharacter)
+	{
+		return;
+	}
+
+	// Priority: Crouch > Sprint > Walk > Jog (same resolution on client and server)
+	EFPSMovementMode Mode = EFPSMovementMode::Jog;
+	if (bWantsToCrouch || IsCrouching())
+	{
+		Mode = EFPSMovementMode::Crouch;
+	}
+	else if (bWantsToSprint)
+	{
+		Mode = EFPSMovementMode::Sprint;
+	}
+	else if (bWantsToWalk)
+	{
+		Mode = EFPSMovementMode::Walk;
+	}
+
+	FPSCharacter->ApplyPredictedMovementState(Mode, bWantsToAim);
+}
+
+// ============================================
+// SAVED MOVE
+// ============================================
+
+void FSavedMove_FPSCharacter::Clear()
+{
+	Super::Clear();
+
+	bSavedWantsToSprint = false;
+	bSavedWantsToWalk = false;
+	bSavedWantsToAim = false;
+}
+
+uint8 FSavedMove_FPSCharacter::GetCompressedFlags() const
+{
+	uint8 Result = Super::GetCompressedFlags();
+
+	if (bSavedWantsToSprint)
+	{
+		Result |= FLAG_Custom_0;
+	}
+	if (bSavedWantsToWalk)
+	{
+		Result |= FLAG_Custom_1;
+	}
+	if (bSavedWantsToAim)
+	{
+		Result |= FLAG_Custom_2;
+	}
+
+	return Result;
+}
+
+bool FSavedMove_FPSCharacter::CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const
+{
+	const FSavedMove_FPSCharacter* NewFPSMove = static_cast<const FSavedMove_FPSCharacter*>(NewMove.Get());
+
+	// Intent change = speed change, must reach server as its own move
+	if (bSavedWantsToSprint != NewFPSMove->bSavedWantsToSprint
+		|| bSavedWantsToWalk != NewFPSMove->bSavedWantsToWalk
+		|| bSavedWantsToAim != NewFPSMove->bSavedWantsToAim)
+	{
+		return false;
+	}
+
+	return Super::CanCombineWith(NewMove, InCharacter, MaxDelta);
+}
+
+void FSavedMove_FPSCharacter::SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData)
+{
+	Super::SetMoveFor(C, InDeltaTime, NewAccel, ClientData);
+
+	if (const UFPSCharacterMovementComponent* Movement = Cast<UFPSCharacterMovementComponent>(C->GetCharacterMovement()))
+	{
+		bSavedWantsToSprint = Movement->bWantsToSprint;
+		bSavedWantsToWalk = Movement->bWantsToWalk;
+		bSavedWantsToAim = Movement->bWantsToAim;
+	}
+}
+
+void FSavedMove_FPSCharacter::PrepMoveFor(ACharacter* C)
+{
+	Super::PrepMoveFor(C);
+
+	// Replay after correction: restore intent the move was recorded with
+	if (UFPSCharacterMovementComponent* Movement = Cast<UFPSCharacterMovementComponent>(C->GetCharacterMovement()))
+	{
+		Movement->bWantsToSprint = bSavedWantsToSprint;
+		Movement->bWantsToWalk = bSavedWantsToWalk;
+		Movement->bWantsToAim = bSavedWantsToAim;
+	}
+}
+
+FNetworkPredictionData_Client_FPSCharacter::FNetworkPredictionData_Client_FPSCharacter(const UCharacterMovementComponent& ClientMovement)
+	: Super(ClientMovement)
+{
+}
+
+FSavedMovePtr FNetworkPredictionData_Client_FPSCharacter::AllocateNewMove()
+{
+	return FSavedMovePtr(new FSavedMove_FPSCharacter());
+}
@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Components/FireComponent.h"
+#include "BaseWeapon.h"
 #include "Components/BallisticsComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Kismet/KismetMathLibrary.h"
@@ -10,6 +11,7 @@
 #include "Interfaces/RecoilHandlerInterface.h"
 #include "Interfaces/CharacterMeshProviderInterface.h"
 #include "Animation/AnimInstance.h"
+#include "Core/FPSCoreStats.h"
 
 UFireComponent::UFireComponent()
 {
@@ -42,6 +44,8 @@ void UFireComponent::TriggerReleased()
 
 bool UFireComponent::CanFire() const
 {
+	FPSCORE_SCOPE_CYCLE(STAT_FPSCore_CanFire);
+
 	if (!BallisticsComponent)
 	{
 		return false;
@@ -93,6 +97,12 @@ bool UFireComponent::CanFire() const
 // FIRE HELPERS
 // ============================================
 
+float UFireComponent::GetTimeBetweenShots() const
+{
+	const float FireRate = ABaseWeapon::GetDefinitionFor(GetOwner()).FireRate;
+	return FireRate > 0.0f ? 60.0f / FireRate : 0.0f;
+}
+
 FVector UFireComponent::ApplySpread(FVector Direction) const
 {
 	// Normalize input direction
@@ -164,7 +174,7 @@ FVector UFireComponent::ApplySpread(FVector Direction) const
 	// - Sprint, Hip, no shots:   (0.5 + rand) * 3.0 * 1.0 * SpreadScale
 	// - Standing, Hip, 8 shots:  (0.5 + rand) * 1.0 * 2.5 * SpreadScale
 	// - Sprint, Hip, 8 shots:    (0.5 + rand) * 3.0 * 2.5 * SpreadScale = 7.5x multiplier!
-	float TotalSpread = (BaseSpread + RandomSpread) * MovementPenalty * RecoilPenalty * SpreadScale;
+	float TotalSpread = (BaseSpread + RandomSpread) * MovementPenalty * RecoilPenalty * ABaseWeapon::GetDefinitionFor(GetOwner()).SpreadScale;
 
 	// Convert total spread from degrees to radians
 	float SpreadRadians = FMath::DegreesToRadians(TotalSpread);
@@ -182,6 +192,8 @@ FVector UFireComponent::ApplySpread(FVector Direction) const
 
 void UFireComponent::Fire()
 {
+	FPSCORE_SCOPE_CYCLE(STAT_FPSCore_Fire);
+
 	if (!GetOwner()->HasAuthority())
 	{
 		return;
@@ -242,7 +254,8 @@ void UFireComponent::Fire()
 
 	if (BallisticsComponent)
 	{
-		BallisticsComponent->Shoot(ViewLocation, SpreadDirection);
+		// Fresh seed per shot - recorded by telemetry / combat recorder for reproducible replays
+		BallisticsComponent->ShootWithSeed(ViewLocation, SpreadDirection, FMath::Rand());
 	}
 
 	// 4. Apply recoil
@@ -270,6 +283,6 @@ void UFireComponent::ApplyRecoil()
 
 	if (WeaponOwner->Implements<URecoilHandlerInterface>())
 	{
-		IRecoilHandlerInterface::Execute_ApplyRecoilKick(WeaponOwner, RecoilScale);
+		IRecoilHandlerInterface::Execute_ApplyRecoilKick(WeaponOwner, ABaseWeapon::GetDefinitionFor(WeaponActor).RecoilScale);
 	}
 }
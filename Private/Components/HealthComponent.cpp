@@ -3,6 +3,7 @@
 #include "Components/HealthComponent.h"
 #include "Net/UnrealNetwork.h"
 #include "Engine/DamageEvents.h"
+#include "Core/FPSCoreStats.h"
 
 UHealthComponent::UHealthComponent()
 {
@@ -107,7 +108,7 @@ float UHealthComponent::ApplyDamage(float DamageAmount, FDamageEvent const& Dama
 		HitDirection = PointDamageEvent->ShotDirection;
 
 		// Get bone multiplier and apply to damage
-		BoneMultiplier = GetBoneDamageMultiplier(HitBoneName);
+		BoneMultiplier = GetHitDamageMultiplier(PointDamageEvent->HitInfo);
 		ActualDamage *= BoneMultiplier;
 	}
 
@@ -138,6 +139,28 @@ float UHealthComponent::GetBoneDamageMultiplier(FName BoneName) const
 	return Multiplier ? *Multiplier : 1.0f;
 }
 
+void UHealthComponent::CompileBodyDamageMultipliers(const TArray<FName>& BodyBoneNames)
+{
+	CompiledBodyBoneNames = BodyBoneNames;
+	CompiledBodyMultipliers.Reset(BodyBoneNames.Num());
+
+	for (const FName& BoneName : BodyBoneNames)
+	{
+		CompiledBodyMultipliers.Add(GetBoneDamageMultiplier(BoneName));
+	}
+}
+
+float UHealthComponent::GetHitDamageMultiplier(const FHitResult& HitInfo) const
+{
+	// Item = physics body index (hitbox hits and skeletal physics hits), bone name guards against other meshes
+	if (CompiledBodyMultipliers.IsValidIndex(HitInfo.Item) && CompiledBodyBoneNames[HitInfo.Item] == HitInfo.BoneName)
+	{
+		return CompiledBodyMultipliers[HitInfo.Item];
+	}
+
+	return GetBoneDamageMultiplier(HitInfo.BoneName);
+}
+
 void UHealthComponent::ResetHealthState()
 {
 	AActor* Owner = GetOwner();
@@ -153,11 +176,15 @@ void UHealthComponent::ResetHealthState()
 
 void UHealthComponent::OnRep_Health()
 {
+	FPSCORE_SCOPE_ONREP(UHealthComponent_OnRep_Health);
+
 	OnHealthChanged.Broadcast(Health);
 }
 
 void UHealthComponent::OnRep_IsDeath()
 {
+	FPSCORE_SCOPE_ONREP(UHealthComponent_OnRep_IsDeath);
+
 	if (bIsDeath)
 	{
 		OnDeath.Broadcast();
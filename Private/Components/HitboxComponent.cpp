@@ -0,0 +1,392 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Components/HitboxComponent.h"
+#include "Components/HealthComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "PhysicsEngine/PhysicsAsset.h"
+#include "PhysicsEngine/SkeletalBodySetup.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "Interfaces/CharacterMeshProviderInterface.h"
+#include "Core/FPSHitboxSubsystem.h"
+#include "Core/FPSCoreStats.h"
+
+namespace
+{
+	/** Sphere entry distance along unit ray, false if missed or origin inside */
+	bool IntersectRaySphere(const FVector3f& Origin, const FVector3f& Direction, const FVector3f& Center, float RadiusSq, float& OutT)
+	{
+		const FVector3f OC = Origin - Center;
+		const float B = OC | Direction;
+		const float C = (OC | OC) - RadiusSq;
+		const float H = B * B - C;
+		if (H < 0.0f)
+		{
+			return false;
+		}
+
+		OutT = -B - FMath::Sqrt(H);
+		return OutT >= 0.0f;
+	}
+
+	/** Capsule entry distance along unit ray: cylinder body, then both end caps */
+	bool IntersectRayCapsule(const FVector3f& Origin, const FVector3f& Direction, const FVector3f& A, const FVector3f& B, float Radius, float& OutT)
+	{
+		const float RadiusSq = Radius * Radius;
+		const FVector3f BA = B - A;
+		const FVector3f OA = Origin - A;
+		const float BaBa = BA | BA;
+		const float BaRd = BA | Direction;
+		const float BaOa = BA | OA;
+
+		bool bHit = false;
+		OutT = MAX_flt;
+
+		// Infinite cylinder, accepted only between the end planes
+		const float QA = BaBa - BaRd * BaRd;
+		if (QA > KINDA_SMALL_NUMBER)
+		{
+			const float QB = BaBa * (Direction | OA) - BaOa * BaRd;
+			const float QC = BaBa * (OA | OA) - BaOa * BaOa - RadiusSq * BaBa;
+			const float H = QB * QB - QA * QC;
+			if (H >= 0.0f)
+			{
+				const float T = (-QB - FMath::Sqrt(H)) / QA;
+				const float Y = BaOa + T * BaRd;
+				if (T >= 0.0f && Y > 0.0f && Y < BaBa)
+				{
+					OutT = T;
+					bHit = true;
+				}
+			}
+		}
+
+		// End caps (also covers spheres and rays parallel to the axis)
+		float CapT;
+		if (IntersectRaySphere(Origin, Direction, A, RadiusSq, CapT) && CapT < OutT)
+		{
+			OutT = CapT;
+			bHit = true;
+		}
+		if (IntersectRaySphere(Origin, Direction, B, RadiusSq, CapT) && CapT < OutT)
+		{
+			OutT = CapT;
+			bHit = true;
+		}
+
+		return bHit;
+	}
+}
+
+UHitboxComponent::UHitboxComponent()
+{
+	// Refreshed lazily on first query per frame - no tick
+	PrimaryComponentTick.bCanEverTick = false;
+	SetIsReplicatedByDefault(false);
+}
+
+void UHitboxComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	BuildHitboxes();
+
+	if (UFPSHitboxSubsystem* Hitboxes = GetWorld()->GetSubsystem<UFPSHitboxSubsystem>())
+	{
+		// Physics bullet traces skip this object type - the hitbox layer answers for the body instead
+		BodyObjectType = Hitboxes->BodyObjectType;
+		if (BodyMesh)
+		{
+			BodyMesh->SetCollisionObjectType(BodyObjectType);
+		}
+
+		Hitboxes->RegisterHitbox(this);
+	}
+}
+
+void UHitboxComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UFPSHitboxSubsystem* Hitboxes = World->GetSubsystem<UFPSHitboxSubsystem>())
+		{
+			Hitboxes->UnregisterHitbox(this);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+// ============================================
+// BUILD
+// ============================================
+
+USkeletalMeshComponent* UHitboxComponent::ResolveBodyMesh() const
+{
+	AActor* Owner = GetOwner();
+	if (!Owner || !Owner->Implements<UCharacterMeshProviderInterface>())
+	{
+		return nullptr;
+	}
+
+	return ICharacterMeshProviderInterface::Execute_GetBodyMesh(Owner);
+}
+
+void UHitboxComponent::BuildHitboxes()
+{
+	Capsules.Reset();
+	BodyBoneNames.Reset();
+	BodyMaterials.Reset();
+	LastUpdateFrame = MAX_uint64;
+
+	BodyMesh = ResolveBodyMesh();
+	UPhysicsAsset* PhysicsAsset = BodyMesh ? BodyMesh->GetPhysicsAsset() : nullptr;
+	BuiltPhysicsAsset = PhysicsAsset;
+
+	if (!PhysicsAsset)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("HitboxComponent::BuildHitboxes() - %s has no body mesh physics asset, no hitboxes"), *GetNameSafe(GetOwner()));
+		return;
+	}
+
+	for (int32 BodyIndex = 0; BodyIndex < PhysicsAsset->SkeletalBodySetups.Num(); ++BodyIndex)
+	{
+		const USkeletalBodySetup* BodySetup = PhysicsAsset->SkeletalBodySetups[BodyIndex];
+		BodyBoneNames.Add(BodySetup ? BodySetup->BoneName : NAME_None);
+		BodyMaterials.Add(BodySetup ? BodySetup->PhysMaterial.Get() : nullptr);
+
+		const int32 BoneIndex = BodySetup ? BodyMesh->GetBoneIndex(BodySetup->BoneName) : INDEX_NONE;
+		if (BoneIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		// Segment along LocalAxis of element frame, bone space
+		auto AddCapsule = [this, BoneIndex, BodyIndex](const FTransform& ElemTM, const FVector& LocalAxis, float HalfLength, float Radius)
+		{
+			FHitboxCapsule& Capsule = Capsules.AddDefaulted_GetRef();
+			Capsule.BoneIndex = BoneIndex;
+			Capsule.BodyIndex = BodyIndex;
+			Capsule.LocalA = FVector3f(ElemTM.TransformPosition(-LocalAxis * HalfLength));
+			Capsule.LocalB = FVector3f(ElemTM.TransformPosition(LocalAxis * HalfLength));
+			Capsule.Radius = Radius;
+		};
+
+		const FKAggregateGeom& Geom = BodySetup->AggGeom;
+
+		for (const FKSphylElem& Elem : Geom.SphylElems)
+		{
+			AddCapsule(Elem.GetTransform(), FVector::UpVector, Elem.Length * 0.5f, Elem.Radius);
+		}
+
+		for (const FKTaperedCapsuleElem& Elem : Geom.TaperedCapsuleElems)
+		{
+			AddCapsule(Elem.GetTransform(), FVector::UpVector, Elem.Length * 0.5f, FMath::Max(Elem.Radius0, Elem.Radius1));
+		}
+
+		for (const FKSphereElem& Elem : Geom.SphereElems)
+		{
+			AddCapsule(FTransform(Elem.Center), FVector::UpVector, 0.0f, Elem.Radius);
+		}
+
+		// Box → capsule along longest axis, radius = larger of the other two half extents
+		for (const FKBoxElem& Elem : Geom.BoxElems)
+		{
+			const FVector HalfExtents(Elem.X * 0.5f, Elem.Y * 0.5f, Elem.Z * 0.5f);
+			const int32 Axis = HalfExtents.X >= HalfExtents.Y ? (HalfExtents.X >= HalfExtents.Z ? 0 : 2) : (HalfExtents.Y >= HalfExtents.Z ? 1 : 2);
+			const float Radius = FMath::Max(HalfExtents[(Axis + 1) % 3], HalfExtents[(Axis + 2) % 3]);
+
+			FVector LocalAxis = FVector::ZeroVector;
+			LocalAxis[Axis] = 1.0f;
+
+			AddCapsule(Elem.GetTransform(), LocalAxis, FMath::Max(HalfExtents[Axis] - Radius, 0.0f), Radius);
+		}
+	}
+
+	// World-space storage, cull arrays padded to SIMD width
+	const int32 NumPadded = Align(Capsules.Num(), 4);
+	CullX.SetNumZeroed(NumPadded);
+	CullY.SetNumZeroed(NumPadded);
+	CullZ.SetNumZeroed(NumPadded);
+	CullRadiusSq.Init(-1.0f, NumPadded);
+
+	WorldA.SetNumZeroed(Capsules.Num());
+	WorldB.SetNumZeroed(Capsules.Num());
+	WorldRadius.SetNumZeroed(Capsules.Num());
+
+	// Precompiled per-body multipliers (no bone name map lookup per hit)
+	if (UHealthComponent* HealthComp = GetOwner()->FindComponentByClass<UHealthComponent>())
+	{
+		HealthComp->CompileBodyDamageMultipliers(BodyBoneNames);
+	}
+}
+
+// ============================================
+// PER-FRAME UPDATE
+// ============================================
+
+void UHitboxComponent::UpdateHitboxes()
+{
+	// Mesh / physics asset swapped at runtime
+	if (!BodyMesh || BodyMesh->GetPhysicsAsset() != BuiltPhysicsAsset.Get())
+	{
+		BuildHitboxes();
+	}
+
+	if (LastUpdateFrame == GFrameCounter || !BodyMesh)
+	{
+		return;
+	}
+	LastUpdateFrame = GFrameCounter;
+
+	FPSCORE_SCOPE_CYCLE(STAT_FPSCore_HitboxUpdate);
+
+	const FTransform& ComponentTM = BodyMesh->GetComponentTransform();
+	const TArray<FTransform>& ComponentSpaceTMs = BodyMesh->GetComponentSpaceTransforms();
+
+	for (int32 Index = 0; Index < Capsules.Num(); ++Index)
+	{
+		const FHitboxCapsule& Capsule = Capsules[Index];
+
+		// No pose yet (mesh not registered) - lane never hits
+		if (!ComponentSpaceTMs.IsValidIndex(Capsule.BoneIndex))
+		{
+			CullRadiusSq[Index] = -1.0f;
+			continue;
+		}
+
+		const FTransform BoneTM = ComponentSpaceTMs[Capsule.BoneIndex] * ComponentTM;
+		const FVector3f A(BoneTM.TransformPosition(FVector(Capsule.LocalA)));
+		const FVector3f B(BoneTM.TransformPosition(FVector(Capsule.LocalB)));
+		const float Radius = Capsule.Radius * BoneTM.GetMaximumAxisScale();
+
+		WorldA[Index] = A;
+		WorldB[Index] = B;
+		WorldRadius[Index] = Radius;
+
+		const FVector3f Center = (A + B) * 0.5f;
+		const float CullRadius = (B - A).Size() * 0.5f + Radius;
+		CullX[Index] = Center.X;
+		CullY[Index] = Center.Y;
+		CullZ[Index] = Center.Z;
+		CullRadiusSq[Index] = CullRadius * CullRadius;
+	}
+}
+
+// ============================================
+// QUERY
+// ============================================
+
+bool UHitboxComponent::IsQueryable() const
+{
+	const AActor* Owner = GetOwner();
+	return Owner && Owner->GetActorEnableCollision()
+		&& BodyMesh && BodyMesh->IsCollisionEnabled()
+		&& BodyMesh->GetCollisionObjectType() == BodyObjectType
+		&& BodyMesh->GetCollisionResponseToChannel(ECC_GameTraceChannel2) != ECR_Ignore;
+}
+
+FBoxSphereBounds UHitboxComponent::GetQueryBounds() const
+{
+	return BodyMesh ? BodyMesh->Bounds : FBoxSphereBounds(ForceInit);
+}
+
+bool UHitboxComponent::Raycast(const FVector& Start, const FVector& Direction, float MaxDistance, FHitResult& OutHit)
+{
+	if (!IsQueryable())
+	{
+		return false;
+	}
+
+	UpdateHitboxes();
+
+	if (Capsules.Num() == 0)
+	{
+		return false;
+	}
+
+	FPSCORE_SCOPE_CYCLE(STAT_FPSCore_HitboxRaycast);
+
+	const FVector3f Origin(Start);
+	const FVector3f Dir(Direction);
+
+	// ============================================
+	// 4-WIDE CULL (closest point on ray segment vs capsule bounding sphere)
+	// ============================================
+
+	const VectorRegister4Float OriginX = VectorSetFloat1(Origin.X);
+	const VectorRegister4Float OriginY = VectorSetFloat1(Origin.Y);
+	const VectorRegister4Float OriginZ = VectorSetFloat1(Origin.Z);
+	const VectorRegister4Float DirX = VectorSetFloat1(Dir.X);
+	const VectorRegister4Float DirY = VectorSetFloat1(Dir.Y);
+	const VectorRegister4Float DirZ = VectorSetFloat1(Dir.Z);
+	const VectorRegister4Float Length = VectorSetFloat1(MaxDistance);
+	const VectorRegister4Float Zero = VectorZeroFloat();
+
+	float BestT = MaxDistance;
+	int32 BestCapsule = INDEX_NONE;
+
+	for (int32 Base = 0; Base < CullX.Num(); Base += 4)
+	{
+		const VectorRegister4Float ToCenterX = VectorSubtract(VectorLoad(&CullX[Base]), OriginX);
+		const VectorRegister4Float ToCenterY = VectorSubtract(VectorLoad(&CullY[Base]), OriginY);
+		const VectorRegister4Float ToCenterZ = VectorSubtract(VectorLoad(&CullZ[Base]), OriginZ);
+
+		VectorRegister4Float T = VectorMultiply(ToCenterX, DirX);
+		T = VectorMultiplyAdd(ToCenterY, DirY, T);
+		T = VectorMultiplyAdd(ToCenterZ, DirZ, T);
+		T = VectorMin(VectorMax(T, Zero), Length);
+
+		const VectorRegister4Float OffsetX = VectorNegateMultiplyAdd(T, DirX, ToCenterX);
+		const VectorRegister4Float OffsetY = VectorNegateMultiplyAdd(T, DirY, ToCenterY);
+		const VectorRegister4Float OffsetZ = VectorNegateMultiplyAdd(T, DirZ, ToCenterZ);
+
+		VectorRegister4Float DistSq = VectorMultiply(OffsetX, OffsetX);
+		DistSq = VectorMultiplyAdd(OffsetY, OffsetY, DistSq);
+		DistSq = VectorMultiplyAdd(OffsetZ, OffsetZ, DistSq);
+
+		uint32 Mask = VectorMaskBits(VectorCompareLE(DistSq, VectorLoad(&CullRadiusSq[Base])));
+
+		// Exact test on surviving lanes only (typically 0-2 per character)
+		while (Mask)
+		{
+			const int32 Index = Base + FMath::CountTrailingZeros(Mask);
+			Mask &= Mask - 1;
+
+			float HitT;
+			if (IntersectRayCapsule(Origin, Dir, WorldA[Index], WorldB[Index], WorldRadius[Index], HitT) && HitT < BestT)
+			{
+				BestT = HitT;
+				BestCapsule = Index;
+			}
+		}
+	}
+
+	if (BestCapsule == INDEX_NONE)
+	{
+		return false;
+	}
+
+	// ============================================
+	// BUILD HIT RESULT (same fields hit solve / damage read from physics hits)
+	// ============================================
+
+	const FVector3f& A = WorldA[BestCapsule];
+	const FVector3f BA = WorldB[BestCapsule] - A;
+	const FVector3f HitPoint = Origin + Dir * BestT;
+	const float BaBa = BA | BA;
+	const float Segment = BaBa > 0.0f ? FMath::Clamp(((HitPoint - A) | BA) / BaBa, 0.0f, 1.0f) : 0.0f;
+	const FVector HitNormal = FVector(HitPoint - (A + BA * Segment)).GetSafeNormal();
+	const int32 BodyIndex = Capsules[BestCapsule].BodyIndex;
+
+	OutHit = FHitResult(GetOwner(), BodyMesh, FVector(HitPoint), HitNormal);
+	OutHit.TraceStart = Start;
+	OutHit.TraceEnd = Start + Direction * MaxDistance;
+	OutHit.Distance = BestT;
+	OutHit.Time = MaxDistance > 0.0f ? BestT / MaxDistance : 0.0f;
+	OutHit.BoneName = BodyBoneNames[BodyIndex];
+	OutHit.Item = BodyIndex;
+	OutHit.PhysMaterial = BodyMaterials[BodyIndex];
+	OutHit.bBlockingHit = false;
+
+	return true;
+}
@@ -9,6 +9,7 @@
 #include "Interfaces/ReloadableInterface.h"
 #include "Animation/AnimInstance.h"
 #include "Net/UnrealNetwork.h"
+#include "Core/FPSCoreStats.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogPumpActionFire, Log, All);
 
@@ -16,11 +17,6 @@ UPumpActionFireComponent::UPumpActionFireComponent()
 {
 	PrimaryComponentTick.bCanEverTick = false;
 	SetIsReplicatedByDefault(true);
-
-	// Pump-action defaults (SPAS-12 semi-auto mode)
-	FireRate = 220.0f;  // ~220 RPM theoretical max (pump-action limited)
-	SpreadScale = 1.5f;  // Wider spread (shotgun buckshot)
-	RecoilScale = 2.0f;  // Higher recoil (12 gauge)
 }
 
 void UPumpActionFireComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -37,6 +33,8 @@ void UPumpActionFireComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProper
 
 void UPumpActionFireComponent::OnRep_IsPumping()
 {
+	FPSCORE_SCOPE_ONREP(UPumpActionFireComponent_OnRep_IsPumping);
+
 	UE_LOG(LogPumpActionFire, Log, TEXT("[Client] OnRep_IsPumping: %s"), bIsPumping ? TEXT("true") : TEXT("false"));
 
 	PropagateStateToAnimInstances();
@@ -56,6 +54,8 @@ void UPumpActionFireComponent::OnRep_IsPumping()
 
 void UPumpActionFireComponent::OnRep_ChamberEmpty()
 {
+	FPSCORE_SCOPE_ONREP(UPumpActionFireComponent_OnRep_ChamberEmpty);
+
 	PropagateStateToAnimInstances();
 }
 
@@ -9,6 +9,7 @@
 #include "Animation/AnimInstance.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Net/UnrealNetwork.h"
+#include "Core/FPSCoreStats.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogPumpActionReload, Log, All);
 
@@ -34,12 +35,16 @@ void UPumpActionReloadComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProp
 
 void UPumpActionReloadComponent::OnRep_ChamberEmpty()
 {
+	FPSCORE_SCOPE_ONREP(UPumpActionReloadComponent_OnRep_ChamberEmpty);
+
 	UE_LOG(LogPumpActionReload, Log, TEXT("[Client] OnRep_ChamberEmpty: %s"),
 		bChamberEmpty ? TEXT("true") : TEXT("false"));
 }
 
 void UPumpActionReloadComponent::OnRep_IsPumping()
 {
+	FPSCORE_SCOPE_ONREP(UPumpActionReloadComponent_OnRep_IsPumping);
+
 	UE_LOG(LogPumpActionReload, Log, TEXT("[Client] OnRep_IsPumping: %s"),
 		bIsPumping ? TEXT("true") : TEXT("false"));
 
@@ -58,6 +63,8 @@ void UPumpActionReloadComponent::OnRep_IsPumping()
 
 void UPumpActionReloadComponent::OnRep_NeedsPumpAfterReload()
 {
+	FPSCORE_SCOPE_ONREP(UPumpActionReloadComponent_OnRep_NeedsPumpAfterReload);
+
 	UE_LOG(LogPumpActionReload, Log, TEXT("[Client] OnRep_NeedsPumpAfterReload: %s"),
 		bNeedsPumpAfterReload ? TEXT("true") : TEXT("false"));
 }
@@ -3,12 +3,11 @@
 #include "Components/RecoilComponent.h"
 #include "Interfaces/RecoilHandlerInterface.h"
 #include "GameFramework/PlayerController.h"
-#include "Kismet/KismetMathLibrary.h"
 
 URecoilComponent::URecoilComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
-	PrimaryComponentTick.bStartWithTickEnabled = false; // Disabled by default, enabled when recoil active
+	// No tick - recovery is evaluated in closed form from LastShotTime
+	PrimaryComponentTick.bCanEverTick = false;
 
 	// NOT replicated - local state tracking on each machine
 	SetIsReplicatedByDefault(false);
@@ -19,55 +18,12 @@ void URecoilComponent::BeginPlay()
 	Super::BeginPlay();
 
 	// Initialize state
-	CurrentRecoilPitch = 0.0f;
-	CurrentRecoilYaw = 0.0f;
-	ShotCount = 0;
+	AnchorRecoilPitch = 0.0f;
+	AnchorRecoilYaw = 0.0f;
+	AnchorShotCount = 0.0f;
 	LastShotTime = 0.0f;
 }
 
-void URecoilComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
-{
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-	// Early out if no active recoil
-	if (FMath::Abs(CurrentRecoilPitch) < KINDA_SMALL_NUMBER &&
-		FMath::Abs(CurrentRecoilYaw) < KINDA_SMALL_NUMBER &&
-		ShotCount == 0)
-	{
-		// Disable tick when fully recovered
-		SetComponentTickEnabled(false);
-		return;
-	}
-
-	// Check if recovery delay has passed
-	float CurrentTime = GetWorld()->GetTimeSeconds();
-	float TimeSinceLastShot = CurrentTime - LastShotTime;
-
-	if (TimeSinceLastShot > RecoveryDelay)
-	{
-		// Recovery interpolation (smooth return to center)
-		CurrentRecoilPitch = FMath::FInterpTo(
-			CurrentRecoilPitch,
-			0.0f,
-			DeltaTime,
-			RecoverySpeed
-		);
-
-		CurrentRecoilYaw = FMath::FInterpTo(
-			CurrentRecoilYaw,
-			0.0f,
-			DeltaTime,
-			RecoverySpeed
-		);
-
-		// Decay shot count (exponential decay)
-		// Decay rate: 5 shots per second
-		float DecayRate = 5.0f;
-		int32 DecayAmount = FMath::CeilToInt(DeltaTime * DecayRate);
-		ShotCount = FMath::Max(0, ShotCount - DecayAmount);
-	}
-}
-
 // ============================================
 // RECOIL APPLICATION
 // ============================================
@@ -77,16 +33,10 @@ void URecoilComponent::AddRecoil(float Scale)
 	// SERVER ONLY - state tracking for accumulation
 	// This does NOT apply visual feedback (that happens in Multicast RPC)
 
-	// Update shot count
-	ShotCount++;
+	// Server has no camera offset to track - accumulation only
+	RecordShot(0.0f, 0.0f);
 
-	// Update last shot time (for recovery delay)
-	LastShotTime = GetWorld()->GetTimeSeconds();
-
-	// Enable tick for recovery interpolation
-	SetComponentTickEnabled(true);
-
-	UE_LOG(LogTemp, Verbose, TEXT("RecoilComponent::AddRecoil() - Scale=%.2f, ShotCount=%d"), Scale, ShotCount);
+	UE_LOG(LogTemp, Verbose, TEXT("RecoilComponent::AddRecoil() - Scale=%.2f, AccumulatedShots=%.2f"), Scale, AnchorShotCount);
 }
 
 void URecoilComponent::ApplyRecoilToCamera(float Scale)
@@ -113,7 +63,7 @@ void URecoilComponent::ApplyRecoilToCamera(float Scale)
 		ADSModifier = ADSRecoilMultiplier; // 0.5 = 50% recoil when aiming
 	}
 
-	// Get accumulation multiplier (1.0x → 2.0x based on shot count)
+	// Get accumulation multiplier (1.0x → 1.4x based on accumulated shots)
 	float AccumulationMultiplier = GetAccumulationMultiplier();
 
 	// Calculate vertical kick (upward pitch)
@@ -129,15 +79,7 @@ void URecoilComponent::ApplyRecoilToCamera(float Scale)
 	IRecoilHandlerInterface::Execute_ApplyCameraYawKick(OwnerActor, HorizontalKick);
 
 	// Track accumulated recoil for recovery
-	CurrentRecoilPitch += VerticalKick;
-	CurrentRecoilYaw += HorizontalKick;
-
-	// Update state
-	ShotCount++;
-	LastShotTime = GetWorld()->GetTimeSeconds();
-
-	// Enable tick for recovery
-	SetComponentTickEnabled(true);
+	RecordShot(VerticalKick, HorizontalKick);
 
 	UE_LOG(LogTemp, Verbose, TEXT("RecoilComponent::ApplyRecoilToCamera() - Vertical=%.2f, Horizontal=%.2f, Accumulation=%.2f, ADS=%.2f"),
 		VerticalKick, HorizontalKick, AccumulationMultiplier, ADSModifier);
@@ -172,37 +114,100 @@ void URecoilComponent::ApplyRecoilToWeapon(float Scale)
 	// 3. Physics impulse on weapon mesh
 
 	// Track state for accumulation logic
-	ShotCount++;
-	LastShotTime = GetWorld()->GetTimeSeconds();
-
-	// Enable tick for state decay
-	SetComponentTickEnabled(true);
+	RecordShot(0.0f, 0.0f);
 
-	UE_LOG(LogTemp, Verbose, TEXT("RecoilComponent::ApplyRecoilToWeapon() - Scale=%.2f, ShotCount=%d (TPS animation handled by ShootMontage)"), Scale, ShotCount);
+	UE_LOG(LogTemp, Verbose, TEXT("RecoilComponent::ApplyRecoilToWeapon() - Scale=%.2f, AccumulatedShots=%.2f (TPS animation handled by ShootMontage)"), Scale, AnchorShotCount);
 }
 
 void URecoilComponent::ResetRecoil()
 {
 	// Clear all recoil state
-	CurrentRecoilPitch = 0.0f;
-	CurrentRecoilYaw = 0.0f;
-	ShotCount = 0;
+	AnchorRecoilPitch = 0.0f;
+	AnchorRecoilYaw = 0.0f;
+	AnchorShotCount = 0.0f;
 	LastShotTime = 0.0f;
 
-	// Disable tick
-	SetComponentTickEnabled(false);
-
 	UE_LOG(LogTemp, Log, TEXT("RecoilComponent::ResetRecoil() - Recoil state cleared"));
 }
 
+// ============================================
+// EVALUATION (CLOSED FORM)
+// ============================================
+// Recovery model (t = seconds since RecoveryDelay elapsed after last shot):
+//   Offset(t) = AnchorOffset * exp(-RecoverySpeed * t)   (continuous FInterpTo)
+//   Shots(t)  = max(0, AnchorShotCount - ShotDecayRate * t)
+// Pure functions of time - same result regardless of frame rate or query rate.
+
+float URecoilComponent::GetRecoveryTime() const
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return 0.0f;
+	}
+
+	const float TimeSinceLastShot = World->GetTimeSeconds() - LastShotTime;
+	return FMath::Max(0.0f, TimeSinceLastShot - RecoveryDelay);
+}
+
+float URecoilComponent::GetAccumulatedShots() const
+{
+	if (AnchorShotCount <= 0.0f)
+	{
+		return 0.0f;
+	}
+
+	return FMath::Max(0.0f, AnchorShotCount - ShotDecayRate * GetRecoveryTime());
+}
+
+float URecoilComponent::GetRecoilFactor() const
+{
+	if (MaxAccumulation <= 0.0f)
+	{
+		return 0.0f;
+	}
+
+	return FMath::Min(GetAccumulatedShots() / MaxAccumulation, 1.0f);
+}
+
+float URecoilComponent::GetCurrentRecoilPitch() const
+{
+	if (FMath::IsNearlyZero(AnchorRecoilPitch))
+	{
+		return 0.0f;
+	}
+
+	return AnchorRecoilPitch * FMath::Exp(-RecoverySpeed * GetRecoveryTime());
+}
+
+float URecoilComponent::GetCurrentRecoilYaw() const
+{
+	if (FMath::IsNearlyZero(AnchorRecoilYaw))
+	{
+		return 0.0f;
+	}
+
+	return AnchorRecoilYaw * FMath::Exp(-RecoverySpeed * GetRecoveryTime());
+}
+
+void URecoilComponent::RecordShot(float PitchKick, float YawKick)
+{
+	// Fold recovery elapsed since previous shot into the anchors BEFORE moving LastShotTime
+	AnchorRecoilPitch = GetCurrentRecoilPitch() + PitchKick;
+	AnchorRecoilYaw = GetCurrentRecoilYaw() + YawKick;
+	AnchorShotCount = GetAccumulatedShots() + 1.0f;
+
+	LastShotTime = GetWorld()->GetTimeSeconds();
+}
+
 // ============================================
 // HELPERS
 // ============================================
 
 float URecoilComponent::GetAccumulationMultiplier() const
 {
-	// Calculate accumulation factor (0.0 → 1.0 based on shot count)
-	float AccumulationFactor = FMath::Min(static_cast<float>(ShotCount) / MaxAccumulation, 1.0f);
+	// Calculate accumulation factor (0.0 → 1.0 based on accumulated shots)
+	float AccumulationFactor = GetRecoilFactor();
 
 	// Apply accumulation curve (1.0x → 1.4x) - REDUCED for controllable recoil
 	// First shot: 1.0x (base recoil)
@@ -1,11 +1,13 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Components/ReloadComponent.h"
+#include "BaseWeapon.h"
 #include "Interfaces/AmmoConsumerInterface.h"
 #include "Interfaces/CharacterMeshProviderInterface.h"
 #include "Interfaces/HoldableInterface.h"
 #include "Animation/AnimInstance.h"
 #include "Net/UnrealNetwork.h"
+#include "Core/FPSCoreStats.h"
 
 UReloadComponent::UReloadComponent()
 {
@@ -75,6 +77,8 @@ bool UReloadComponent::CanReload_Internal() const
 
 void UReloadComponent::Server_StartReload_Implementation(const FUseContext& Ctx)
 {
+	FPSCORE_SCOPE_RPC(UReloadComponent_Server_StartReload);
+
 	if (!CanReload_Internal()) return;
 
 	bIsReloading = true;
@@ -87,6 +91,8 @@ void UReloadComponent::Server_StartReload_Implementation(const FUseContext& Ctx)
 
 void UReloadComponent::Server_CancelReload_Implementation()
 {
+	FPSCORE_SCOPE_RPC(UReloadComponent_Server_CancelReload);
+
 	if (!bIsReloading) return;
 
 	StopReloadMontages();
@@ -95,6 +101,8 @@ void UReloadComponent::Server_CancelReload_Implementation()
 
 void UReloadComponent::OnRep_IsReloading()
 {
+	FPSCORE_SCOPE_ONREP(UReloadComponent_OnRep_IsReloading);
+
 	if (bIsReloading)
 	{
 		PlayReloadMontages();
@@ -109,6 +117,9 @@ void UReloadComponent::PlayReloadMontages()
 {
 	AActor* CharacterActor = GetOwnerCharacterActor();
 	if (!CharacterActor || !CharacterActor->Implements<UCharacterMeshProviderInterface>()) return;
+
+	// Reload montage (shared by Body, Arms, Legs, slot "DefaultGroup.UpperBody") - from weapon definition
+	UAnimMontage* ReloadMontage = ABaseWeapon::GetDefinitionFor(GetOwner()).ReloadMontage;
 	if (!ReloadMontage) return;
 
 	USkeletalMeshComponent* BodyMesh = ICharacterMeshProviderInterface::Execute_GetBodyMesh(CharacterActor);
@@ -150,6 +161,7 @@ void UReloadComponent::PlayReloadMontages()
 void UReloadComponent::StopReloadMontages()
 {
 	AActor* CharacterActor = GetOwnerCharacterActor();
+	UAnimMontage* ReloadMontage = ABaseWeapon::GetDefinitionFor(GetOwner()).ReloadMontage;
 	if (!CharacterActor || !CharacterActor->Implements<UCharacterMeshProviderInterface>() || !ReloadMontage) return;
 
 	USkeletalMeshComponent* BodyMesh = ICharacterMeshProviderInterface::Execute_GetBodyMesh(CharacterActor);
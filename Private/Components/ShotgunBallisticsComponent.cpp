@@ -4,7 +4,7 @@
 #include "Data/AmmoTypeDataAsset.h"
 #include "Kismet/GameplayStatics.h"
 #include "NiagaraSystem.h"
-#include "Interfaces/BallisticsHandlerInterface.h"
+#include "Core/FPSCoreStats.h"
 
 UShotgunBallisticsComponent::UShotgunBallisticsComponent()
 {
@@ -15,6 +15,8 @@ UShotgunBallisticsComponent::UShotgunBallisticsComponent()
 
 void UShotgunBallisticsComponent::Shoot(FVector Location, FVector Direction)
 {
+	FPSCORE_SCOPE_CYCLE(STAT_FPSCore_Shoot);
+
 	// Server authority check
 	if (!GetOwner()->HasAuthority())
 	{
@@ -26,30 +28,32 @@ void UShotgunBallisticsComponent::Shoot(FVector Location, FVector Direction)
 		return;
 	}
 
-	// ============================================
-	// SINGLE NOTIFICATION (One muzzle flash per shot)
-	// ============================================
-	// Notify owner ONCE via IBallisticsHandlerInterface
-	// This triggers single muzzle flash for all pellets
-	AActor* OwnerActor = GetOwner();
-	if (OwnerActor && OwnerActor->Implements<UBallisticsHandlerInterface>())
-	{
-		IBallisticsHandlerInterface::Execute_HandleShotFired(
-			OwnerActor,
-			FVector_NetQuantize(Location),
-			FVector_NetQuantizeNormal(Direction)
-		);
-	}
-
 	// ============================================
 	// FIRE MULTIPLE PELLETS
 	// ============================================
 	// Each pellet gets independent spread and line trace
+	FVector TracerDirection = Direction;
+	float TracerDistance = MaxTraceDistance;
+
 	for (int32 PelletIndex = 0; PelletIndex < PelletCount; PelletIndex++)
 	{
 		FVector PelletDirection = ApplyPelletSpread(Direction);
-		ShootPellet(Location, PelletDirection);
+		const float PelletDistance = ShootPellet(Location, PelletDirection);
+
+		// First pellet is the representative tracer
+		if (PelletIndex == 0)
+		{
+			TracerDirection = PelletDirection;
+			TracerDistance = PelletDistance;
+		}
 	}
+
+	// ============================================
+	// SINGLE NOTIFICATION (One muzzle flash + tracer per shot)
+	// ============================================
+	// Notify owner ONCE via IBallisticsHandlerInterface
+	// This triggers single muzzle flash for all pellets
+	NotifyShotFired(Location, TracerDirection, TracerDistance);
 }
 
 FVector UShotgunBallisticsComponent::ApplyPelletSpread(const FVector& Direction) const
@@ -64,8 +68,9 @@ FVector UShotgunBallisticsComponent::ApplyPelletSpread(const FVector& Direction)
 
 	// Random point on unit sphere within cone
 	// Use uniform distribution within cone for realistic spread pattern
-	float RandomAngle = FMath::FRand() * 2.0f * PI;  // Azimuth [0, 2π]
-	float RandomRadius = FMath::Sqrt(FMath::FRand()) * FMath::Sin(HalfAngleRad);  // Polar radius
+	// Seeded per shot (ShotRandom) - pellet pattern reproducible from recorded seed
+	float RandomAngle = ShotRandom.FRand() * 2.0f * PI;  // Azimuth [0, 2π]
+	float RandomRadius = FMath::Sqrt(ShotRandom.FRand()) * FMath::Sin(HalfAngleRad);  // Polar radius
 
 	// Create offset in local space (Direction = forward)
 	FVector Right = FVector::CrossProduct(FVector::UpVector, Direction).GetSafeNormal();
@@ -83,63 +88,25 @@ FVector UShotgunBallisticsComponent::ApplyPelletSpread(const FVector& Direction)
 	return (Direction + Offset).GetSafeNormal();
 }
 
-void UShotgunBallisticsComponent::ShootPellet(const FVector& Location, const FVector& Direction)
+float UShotgunBallisticsComponent::ShootPellet(const FVector& Location, const FVector& Direction)
 {
-	// Pellet line trace (reuses base class logic pattern)
-	FVector End = Location + (Direction * MaxTraceDistance);
+	// One pellet = one shot for stats (one trace each)
+	INC_DWORD_STAT(STAT_FPSCore_ShotsFired);
+	RecordTelemetryShot(Location, Direction);
 
-	FCollisionQueryParams TraceParams;
-	TraceParams.bTraceComplex = true;
-	TraceParams.bReturnPhysicalMaterial = true;
-	TraceParams.AddIgnoredActor(GetOwner());
-	if (GetOwner()->GetOwner())
-	{
-		TraceParams.AddIgnoredActor(GetOwner()->GetOwner());
-	}
+	// Pellet trace (base class world + hitbox query)
+	FVector End = Location + (Direction * MaxTraceDistance);
 
 	TArray<FHitResult> HitResults;
-	bool bHit = GetWorld()->LineTraceMultiByChannel(
-		HitResults,
-		Location,
-		End,
-		ECC_GameTraceChannel2,
-		TraceParams
-	);
-
-	if (HitResults.Num() == 0)
+	if (!TraceShot(Location, End, HitResults))
 	{
-		return;
+		return MaxTraceDistance;
 	}
 
-	// Initialize pellet ballistic state from ammo type
-	float Speed = CurrentAmmoType->MuzzleVelocity;
-	float Mass = CurrentAmmoType->ProjectileMass;
-	float Penetration = CurrentAmmoType->PenetrationPower;
-	float DropFactor = CurrentAmmoType->DragCoefficient;
-	float KineticEnergy = 0.0f;
-	FVector LastHitLocation = Location;
+	const float FirstHitDistance = HitResults[0].Distance;
 
-	// Process hits using base class protected method
-	for (int32 HitIndex = 0; HitIndex < HitResults.Num(); HitIndex++)
-	{
-		const FHitResult& Hit = HitResults[HitIndex];
-		bool bContinue = ProcessHit(
-			Hit,
-			HitIndex,
-			Speed,
-			Mass,
-			Penetration,
-			DropFactor,
-			KineticEnergy,
-			Direction,
-			LastHitLocation
-		);
-
-		if (!bContinue)
-		{
-			break;
-		}
+	// Pellets of one shot land in the same frame batch - solved in parallel
+	SubmitTrace(Location, Direction, MoveTemp(HitResults));
 
-		LastHitLocation = Hit.ImpactPoint;
-	}
+	return FirstHitDistance;
 }
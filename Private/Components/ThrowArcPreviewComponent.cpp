@@ -0,0 +1,272 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Components/ThrowArcPreviewComponent.h"
+#include "Components/SphereComponent.h"
+#include "Interfaces/ThrowableInterface.h"
+#include "Engine/World.h"
+#include "Core/FPSCoreStats.h"
+
+// Below this after a bounce the projectile only rolls / settles - path ends (cm/s)
+static constexpr float PreviewRestSpeed = 100.0f;
+
+UThrowArcPreviewComponent::UThrowArcPreviewComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	// Hands / camera final for this frame (launch point from Arms socket)
+	PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+
+	// Instances are stored in world space - component stays at identity
+	SetUsingAbsoluteLocation(true);
+	SetUsingAbsoluteRotation(true);
+	SetUsingAbsoluteScale(true);
+
+	SetOnlyOwnerSee(true);
+	SetCastShadow(false);
+	SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	SetGenerateOverlapEvents(false);
+	SetCanEverAffectNavigation(false);
+	bReceivesDecals = false;
+	SetHiddenInGame(true);
+}
+
+// ============================================
+// API
+// ============================================
+
+void UThrowArcPreviewComponent::ShowPreview(TSubclassOf<AActor> InProjectileClass)
+{
+	const AGrenadeProjectile* Projectile = InProjectileClass ? Cast<AGrenadeProjectile>(InProjectileClass->GetDefaultObject()) : nullptr;
+	if (!Projectile || !GetStaticMesh())
+	{
+		HidePreview();
+		return;
+	}
+
+	ProjectileClass = Projectile->GetClass();
+	SimulationDuration = FMath::Min(MaxSimulationTime, Projectile->GetFuseTime());
+
+	// Sweep with the projectile's own collision (channel, responses, radius)
+	if (const UPrimitiveComponent* Root = Cast<UPrimitiveComponent>(Projectile->GetRootComponent()))
+	{
+		SweepChannel = Root->GetCollisionObjectType();
+		SweepResponse = FCollisionResponseParams(Root->GetCollisionResponseToChannels());
+	}
+
+	if (const USphereComponent* Sphere = Cast<USphereComponent>(Projectile->GetRootComponent()))
+	{
+		SweepRadius = Sphere->GetScaledSphereRadius();
+	}
+
+	SetWorldTransform(FTransform::Identity);
+	bHasCachedLaunch = false;
+	bHasPendingLaunch = false;
+	SetComponentTickEnabled(true);
+}
+
+void UThrowArcPreviewComponent::HidePreview()
+{
+	SetComponentTickEnabled(false);
+	SetHiddenInGame(true);
+
+	bSimulating = false;
+	bHasCachedLaunch = false;
+	bHasPendingLaunch = false;
+	PathPoints.Reset();
+
+	if (GetInstanceCount() > 0)
+	{
+		ClearInstances();
+	}
+}
+
+// ============================================
+// TICK
+// ============================================
+
+void UThrowArcPreviewComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	FPSCORE_SCOPE_CYCLE(STAT_FPSCore_ThrowArcPreview);
+
+	AActor* Throwable = GetOwner();
+	if (!ProjectileClass || !Throwable || !Throwable->Implements<UThrowableInterface>())
+	{
+		return;
+	}
+
+	FVector LaunchLocation;
+	FVector LaunchDirection;
+	IThrowableInterface::Execute_GetThrowLaunch(Throwable, LaunchLocation, LaunchDirection);
+
+	// Aim steady (or back within thresholds) - keep current path, nothing pending
+	bHasPendingLaunch = !bHasCachedLaunch
+		|| FVector::DistSquared(LaunchLocation, CachedLaunchLocation) > FMath::Square(LocationThreshold)
+		|| FVector::DotProduct(LaunchDirection, CachedLaunchDirection) < FMath::Cos(FMath::DegreesToRadians(AngleThreshold));
+
+	if (bHasPendingLaunch)
+	{
+		PendingLaunchLocation = LaunchLocation;
+		PendingLaunchDirection = LaunchDirection;
+	}
+
+	// Path in progress always completes (continuous aim would otherwise restart it forever)
+	// Restart from the latest launch once it does, with the larger budget meanwhile
+	const int32 SweepBudget = bHasPendingLaunch ? FMath::Max(PendingSweepsPerFrame, MaxSweepsPerFrame) : MaxSweepsPerFrame;
+	for (int32 Sweep = 0; Sweep < SweepBudget; ++Sweep)
+	{
+		if (!bSimulating)
+		{
+			if (!bHasPendingLaunch)
+			{
+				break;
+			}
+
+			bHasPendingLaunch = false;
+			RestartSimulation(PendingLaunchLocation, PendingLaunchDirection);
+		}
+
+		StepSimulation();
+	}
+}
+
+// ============================================
+// SIMULATION
+// ============================================
+
+void UThrowArcPreviewComponent::RestartSimulation(const FVector& Location, const FVector& Direction)
+{
+	CachedLaunchLocation = Location;
+	CachedLaunchDirection = Direction;
+	bHasCachedLaunch = true;
+
+	SimState = ProjectileClass->GetDefaultObject<AGrenadeProjectile>()->MakeLaunchState(Location, Direction);
+	SimLocation = Location;
+	SimVelocity = SimState.Velocity;
+	SimTime = 0.0f;
+	SimBounces = 0;
+	bSimulating = true;
+
+	PathPoints.Reset();
+	PathPoints.Add(Location);
+}
+
+void UThrowArcPreviewComponent::StepSimulation()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		bSimulating = false;
+		return;
+	}
+
+	const FVector Gravity(0.0f, 0.0f, World->GetGravityZ() * SimState.GravityScale);
+	const float Dt = FMath::Min(StepTime, SimulationDuration - SimTime);
+
+	// Constant acceleration over the step - same move delta as UProjectileMovementComponent::ComputeMoveDelta
+	const FVector End = SimLocation + SimVelocity * Dt + Gravity * (0.5f * Dt * Dt);
+
+	// Ignore the held item and whoever holds it
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ThrowArcPreview), false, GetOwner());
+	if (AActor* Holder = GetOwner() ? GetOwner()->GetOwner() : nullptr)
+	{
+		QueryParams.AddIgnoredActor(Holder);
+	}
+
+	FHitResult Hit;
+	const bool bHit = World->SweepSingleByChannel(Hit, SimLocation, End, FQuat::Identity, SweepChannel,
+		FCollisionShape::MakeSphere(SweepRadius), QueryParams, SweepResponse);
+
+	if (!bHit)
+	{
+		SimLocation = End;
+		SimVelocity += Gravity * Dt;
+		SimTime += Dt;
+		PathPoints.Add(SimLocation);
+	}
+	else
+	{
+		const float HitDt = Dt * Hit.Time;
+		SimLocation = Hit.Location;
+		SimVelocity = ComputeBounceVelocity(SimVelocity + Gravity * HitDt, Hit.ImpactNormal);
+		SimTime += HitDt;
+		PathPoints.Add(SimLocation);
+
+		// Launched inside geometry / settled - nothing further to show
+		if (Hit.bStartPenetrating || ++SimBounces > MaxBounces || SimVelocity.SizeSquared() < FMath::Square(PreviewRestSpeed))
+		{
+			FinishSimulation();
+			return;
+		}
+	}
+
+	if (SimTime >= SimulationDuration)
+	{
+		FinishSimulation();
+	}
+}
+
+FVector UThrowArcPreviewComponent::ComputeBounceVelocity(const FVector& InVelocity, const FVector& Normal) const
+{
+	FVector Velocity = InVelocity;
+	const float VDotNormal = FVector::DotProduct(Velocity, Normal);
+	if (VDotNormal > 0.0f)
+	{
+		return Velocity;
+	}
+
+	const FVector ProjectedNormal = Normal * -VDotNormal;
+
+	// Tangential part keeps (1 - Friction), normal part reflected with Bounciness
+	Velocity += ProjectedNormal;
+	Velocity *= FMath::Clamp(1.0f - SimState.Friction, 0.0f, 1.0f);
+	Velocity += ProjectedNormal * FMath::Max(SimState.Bounciness, 0.0f);
+	return Velocity;
+}
+
+void UThrowArcPreviewComponent::FinishSimulation()
+{
+	bSimulating = false;
+
+	// Resample polyline at MarkerSpacing
+	MarkerTransforms.Reset();
+	const float Spacing = FMath::Max(MarkerSpacing, 1.0f);
+	float DistanceToNext = 0.0f;
+
+	for (int32 Index = 1; Index < PathPoints.Num() && MarkerTransforms.Num() < MaxMarkers; ++Index)
+	{
+		const FVector SegmentStart = PathPoints[Index - 1];
+		const FVector Segment = PathPoints[Index] - SegmentStart;
+		const float SegmentLength = Segment.Size();
+		if (SegmentLength <= KINDA_SMALL_NUMBER)
+		{
+			continue;
+		}
+
+		const FVector SegmentDirection = Segment / SegmentLength;
+		const FQuat Rotation = SegmentDirection.ToOrientationQuat();
+
+		float Distance = DistanceToNext;
+		for (; Distance <= SegmentLength && MarkerTransforms.Num() < MaxMarkers; Distance += Spacing)
+		{
+			MarkerTransforms.Emplace(Rotation, SegmentStart + SegmentDirection * Distance);
+		}
+
+		DistanceToNext = Distance - SegmentLength;
+	}
+
+	// One instance buffer update per completed path
+	if (GetInstanceCount() == MarkerTransforms.Num())
+	{
+		BatchUpdateInstancesTransforms(0, MarkerTransforms, true, true);
+	}
+	else
+	{
+		ClearInstances();
+		AddInstances(MarkerTransforms, false, true);
+	}
+
+	SetHiddenInGame(MarkerTransforms.Num() == 0);
+}
@@ -0,0 +1,172 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/FPSAssetPreloadSubsystem.h"
+#include "Core/FPSCoreStats.h"
+#include "Interfaces/HoldableInterface.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+
+bool UFPSAssetPreloadSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFPSAssetPreloadSubsystem::Deinitialize()
+{
+	for (TPair<TWeakObjectPtr<AActor>, FItemPreload>& Pair : Preloads)
+	{
+		ReleaseHandles(Pair.Value);
+	}
+
+	Preloads.Empty();
+
+	Super::Deinitialize();
+}
+
+// ============================================
+// API
+// ============================================
+
+void UFPSAssetPreloadSubsystem::PreloadItem(AActor* Item)
+{
+	if (!IsValid(Item) || !Item->Implements<UHoldableInterface>() || Preloads.Contains(Item))
+	{
+		return;
+	}
+
+	// Destroyed items never call ReleaseItem - prune while we're here
+	for (auto It = Preloads.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			ReleaseHandles(It.Value());
+			It.RemoveCurrent();
+		}
+	}
+
+	FItemPreload& Preload = Preloads.Add(Item);
+
+	TArray<FSoftObjectPath> Assets;
+	GatherUnloadedAssets(Item, Assets);
+
+	if (Assets.Num() == 0)
+	{
+		// Everything resident - still run nested pass (data assets may reference unloaded effects)
+		OnPreloadComplete(Item);
+		return;
+	}
+
+	Preload.Handle = StreamableManager.RequestAsyncLoad(
+		MoveTemp(Assets),
+		FStreamableDelegate::CreateUObject(this, &UFPSAssetPreloadSubsystem::OnPreloadComplete, TWeakObjectPtr<AActor>(Item)),
+		FStreamableManager::AsyncLoadHighPriority
+	);
+}
+
+void UFPSAssetPreloadSubsystem::ReleaseItem(AActor* Item)
+{
+	FItemPreload Preload;
+	if (Preloads.RemoveAndCopyValue(Item, Preload))
+	{
+		ReleaseHandles(Preload);
+	}
+}
+
+bool UFPSAssetPreloadSubsystem::NotifyEquip(AActor* Item)
+{
+	if (!IsValid(Item))
+	{
+		return true;
+	}
+
+	// Equipped without pickup (spawned in hands, late join) - start now, report cold if anything is missing
+	PreloadItem(Item);
+
+	if (IsItemWarm(Item))
+	{
+		return true;
+	}
+
+	INC_DWORD_STAT(STAT_FPSCore_ColdEquips);
+	UE_LOG(LogTemp, Verbose, TEXT("FPSAssetPreloadSubsystem::NotifyEquip() - %s equipped while assets still loading"), *Item->GetName());
+	return false;
+}
+
+bool UFPSAssetPreloadSubsystem::IsItemWarm(AActor* Item) const
+{
+	const FItemPreload* Preload = Preloads.Find(Item);
+	if (!Preload)
+	{
+		return false;
+	}
+
+	// Nested pass starts from the first pass completion callback
+	if (!Preload->bNestedPassStarted)
+	{
+		return false;
+	}
+
+	return !Preload->NestedHandle.IsValid() || Preload->NestedHandle->HasLoadCompleted();
+}
+
+// ============================================
+// INTERNAL
+// ============================================
+
+void UFPSAssetPreloadSubsystem::GatherUnloadedAssets(AActor* Item, TArray<FSoftObjectPath>& OutAssets)
+{
+	TArray<FSoftObjectPath> Candidates;
+
+	if (UClass* AnimLayer = IHoldableInterface::Execute_GetAnimLayer(Item).Get())
+	{
+		Candidates.Add(FSoftObjectPath(AnimLayer));
+	}
+	Candidates.Add(FSoftObjectPath(IHoldableInterface::Execute_GetEquipMontage(Item)));
+	Candidates.Add(FSoftObjectPath(IHoldableInterface::Execute_GetUnequipMontage(Item)));
+
+	IHoldableInterface::Execute_GetPreloadAssets(Item, Candidates);
+
+	for (const FSoftObjectPath& Path : Candidates)
+	{
+		if (Path.IsValid() && !Path.ResolveObject())
+		{
+			OutAssets.AddUnique(Path);
+		}
+	}
+}
+
+void UFPSAssetPreloadSubsystem::OnPreloadComplete(TWeakObjectPtr<AActor> WeakItem)
+{
+	AActor* Item = WeakItem.Get();
+	FItemPreload* Preload = Item ? Preloads.Find(Item) : nullptr;
+	if (!Preload || Preload->bNestedPassStarted)
+	{
+		return;
+	}
+	Preload->bNestedPassStarted = true;
+
+	TArray<FSoftObjectPath> NestedAssets;
+	GatherUnloadedAssets(Item, NestedAssets);
+
+	if (NestedAssets.Num() > 0)
+	{
+		Preload->NestedHandle = StreamableManager.RequestAsyncLoad(MoveTemp(NestedAssets), FStreamableDelegate(), FStreamableManager::DefaultAsyncLoadPriority);
+	}
+}
+
+void UFPSAssetPreloadSubsystem::ReleaseHandles(FItemPreload& Preload)
+{
+	if (Preload.Handle.IsValid())
+	{
+		Preload.Handle->ReleaseHandle();
+		Preload.Handle.Reset();
+	}
+
+	if (Preload.NestedHandle.IsValid())
+	{
+		Preload.NestedHandle->ReleaseHandle();
+		Preload.NestedHandle.Reset();
+	}
+}
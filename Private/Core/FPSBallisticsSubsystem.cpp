@@ -0,0 +1,82 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/FPSBallisticsSubsystem.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "Core/FPSCoreStats.h"
+
+bool UFPSBallisticsSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFPSBallisticsSubsystem::Deinitialize()
+{
+	// World teardown - pending damage has no one left to receive it
+	PendingTraces.Empty();
+	ActiveTraces.Empty();
+
+	Super::Deinitialize();
+}
+
+// ============================================
+// API
+// ============================================
+
+void UFPSBallisticsSubsystem::QueueTrace(FBallisticsTrace&& Trace)
+{
+	PendingTraces.Add(MoveTemp(Trace));
+}
+
+void UFPSBallisticsSubsystem::Flush()
+{
+	if (PendingTraces.Num() == 0)
+	{
+		return;
+	}
+
+	FPSCORE_SCOPE_CYCLE(STAT_FPSCore_HitBatch);
+
+	// Damage callbacks may fire new shots - those queue for the next batch
+	Swap(ActiveTraces, PendingTraces);
+
+	const int32 NumTraces = ActiveTraces.Num();
+	ParallelFor(NumTraces, [this](int32 Index)
+	{
+		UBallisticsComponent::SolveTrace(ActiveTraces[Index]);
+	}, NumTraces < FMath::Max(MinParallelTraces, 1));
+
+	for (const FBallisticsTrace& Trace : ActiveTraces)
+	{
+		if (UBallisticsComponent* Ballistics = Trace.Ballistics.Get())
+		{
+			Ballistics->ApplyHitCommands(Trace);
+		}
+	}
+
+	ActiveTraces.Reset();
+}
+
+// ============================================
+// TICK (only while traces are queued)
+// ============================================
+
+ETickableTickType UFPSBallisticsSubsystem::GetTickableTickType() const
+{
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UFPSBallisticsSubsystem::IsTickable() const
+{
+	return PendingTraces.Num() > 0;
+}
+
+TStatId UFPSBallisticsSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFPSBallisticsSubsystem, STATGROUP_Tickables);
+}
+
+void UFPSBallisticsSubsystem::Tick(float DeltaTime)
+{
+	Flush();
+}
@@ -0,0 +1,276 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/FPSCharacterSignificanceSubsystem.h"
+#include "FPSCharacter.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "Core/FPSCoreStats.h"
+
+bool UFPSCharacterSignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// ============================================
+// API
+// ============================================
+
+void UFPSCharacterSignificanceSubsystem::RegisterCharacter(AFPSCharacter* Character)
+{
+	// Dedicated server renders nothing - proxies don't exist there
+	if (!IsValid(Character) || GetWorld()->GetNetMode() == NM_DedicatedServer)
+	{
+		return;
+	}
+
+	if (FindEntry(Character))
+	{
+		return;
+	}
+
+	FTrackedCharacter& Entry = TrackedCharacters.AddDefaulted_GetRef();
+	Entry.Character = Character;
+
+	// Score on next tick instead of waiting a full interval
+	TimeSinceEvaluation = EvaluationInterval;
+}
+
+void UFPSCharacterSignificanceSubsystem::UnregisterCharacter(AFPSCharacter* Character)
+{
+	for (int32 Index = TrackedCharacters.Num() - 1; Index >= 0; --Index)
+	{
+		if (TrackedCharacters[Index].Character.Get() != Character)
+		{
+			continue;
+		}
+
+		if (Character && TrackedCharacters[Index].Detail != EFPSProxyDetail::Full)
+		{
+			Character->ApplyProxyDetail(EFPSProxyDetail::Full);
+		}
+
+		TrackedCharacters.RemoveAt(Index);
+	}
+}
+
+void UFPSCharacterSignificanceSubsystem::NotifyCombatEvent(const AActor* Character)
+{
+	if (FTrackedCharacter* Entry = FindEntry(Character))
+	{
+		Entry->LastCombatTime = GetWorld()->GetTimeSeconds();
+	}
+}
+
+EFPSProxyDetail UFPSCharacterSignificanceSubsystem::GetDetail(const AActor* Character) const
+{
+	const FTrackedCharacter* Entry = FindEntry(Character);
+	return Entry ? Entry->Detail : EFPSProxyDetail::Full;
+}
+
+EFPSProxyDetail UFPSCharacterSignificanceSubsystem::GetDetailFor(const AActor* Character)
+{
+	const UWorld* World = Character ? Character->GetWorld() : nullptr;
+	const UFPSCharacterSignificanceSubsystem* Significance = World ? World->GetSubsystem<UFPSCharacterSignificanceSubsystem>() : nullptr;
+	return Significance ? Significance->GetDetail(Character) : EFPSProxyDetail::Full;
+}
+
+void UFPSCharacterSignificanceSubsystem::NotifyCombatEventFor(const AActor* Character)
+{
+	const UWorld* World = Character ? Character->GetWorld() : nullptr;
+	if (UFPSCharacterSignificanceSubsystem* Significance = World ? World->GetSubsystem<UFPSCharacterSignificanceSubsystem>() : nullptr)
+	{
+		Significance->NotifyCombatEvent(Character);
+	}
+}
+
+// ============================================
+// TICK (only while characters are tracked)
+// ============================================
+
+ETickableTickType UFPSCharacterSignificanceSubsystem::GetTickableTickType() const
+{
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UFPSCharacterSignificanceSubsystem::IsTickable() const
+{
+	return TrackedCharacters.Num() > 0;
+}
+
+TStatId UFPSCharacterSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFPSCharacterSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+void UFPSCharacterSignificanceSubsystem::Tick(float DeltaTime)
+{
+	TimeSinceEvaluation += DeltaTime;
+	if (TimeSinceEvaluation < EvaluationInterval)
+	{
+		return;
+	}
+
+	TimeSinceEvaluation = 0.0f;
+	Evaluate();
+}
+
+void UFPSCharacterSignificanceSubsystem::Evaluate()
+{
+	FPSCORE_SCOPE_CYCLE(STAT_FPSCore_ProxySignificance);
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	TrackedCharacters.RemoveAll([](const FTrackedCharacter& Entry) { return !Entry.Character.IsValid(); });
+
+	// Local viewpoints (split-screen: best score across players wins)
+	TArray<FTransform> ViewPoints;
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (PC && PC->IsLocalController())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			ViewPoints.Emplace(ViewRotation, ViewLocation);
+		}
+	}
+
+	const float CurrentTime = World->GetTimeSeconds();
+
+	TArray<EFPSProxyDetail, TInlineAllocator<32>> Desired;
+	Desired.SetNumUninitialized(TrackedCharacters.Num());
+
+	TArray<int32, TInlineAllocator<32>> FullProxies;
+
+	for (int32 Index = 0; Index < TrackedCharacters.Num(); ++Index)
+	{
+		FTrackedCharacter& Entry = TrackedCharacters[Index];
+		const AFPSCharacter* Character = Entry.Character.Get();
+
+		// Own pawn / listen-server remotes (authority) / no viewpoint yet - never scaled
+		if (Character->GetLocalRole() != ROLE_SimulatedProxy || ViewPoints.Num() == 0)
+		{
+			Entry.Score = 1.0f;
+			Desired[Index] = EFPSProxyDetail::Full;
+			continue;
+		}
+
+		const bool bInCombat = CurrentTime - Entry.LastCombatTime <= CombatRelevanceTime;
+		Entry.Score = ScoreCharacter(Character, bInCombat, ViewPoints);
+		Desired[Index] = DetailForScore(Entry.Score, Entry.Detail);
+
+		if (Desired[Index] == EFPSProxyDetail::Full)
+		{
+			FullProxies.Add(Index);
+		}
+	}
+
+	// Cap Full proxies - cost grows with the cap, not with player count
+	if (FullProxies.Num() > FMath::Max(MaxFullDetailProxies, 0))
+	{
+		FullProxies.Sort([this](int32 A, int32 B)
+		{
+			return TrackedCharacters[A].Score > TrackedCharacters[B].Score;
+		});
+
+		for (int32 Rank = FMath::Max(MaxFullDetailProxies, 0); Rank < FullProxies.Num(); ++Rank)
+		{
+			Desired[FullProxies[Rank]] = EFPSProxyDetail::Reduced;
+		}
+	}
+
+	for (int32 Index = 0; Index < TrackedCharacters.Num(); ++Index)
+	{
+		FTrackedCharacter& Entry = TrackedCharacters[Index];
+		if (Entry.Detail != Desired[Index])
+		{
+			Entry.Detail = Desired[Index];
+			Entry.Character->ApplyProxyDetail(Entry.Detail);
+		}
+	}
+}
+
+// ============================================
+// HELPERS
+// ============================================
+
+float UFPSCharacterSignificanceSubsystem::ScoreCharacter(const AFPSCharacter* Character, bool bInCombat, const TArray<FTransform>& ViewPoints) const
+{
+	const FVector Location = Character->GetActorLocation();
+	const float CosHalfAngle = FMath::Max(FMath::Cos(FMath::DegreesToRadians(ViewHalfAngle)), KINDA_SMALL_NUMBER);
+	const float FadeRange = FMath::Max(FarDistance - NearDistance, 1.0f);
+
+	// Culled / occluded by renderer - on-screen angle alone is not enough
+	const bool bRendered = Character->WasRecentlyRendered(EvaluationInterval + 0.1f);
+
+	float BestScore = 0.0f;
+
+	for (const FTransform& ViewPoint : ViewPoints)
+	{
+		const FVector ToCharacter = Location - ViewPoint.GetLocation();
+		const float Distance = ToCharacter.Size();
+
+		if (Distance <= NearDistance)
+		{
+			return 1.0f;
+		}
+
+		const float DistanceScore = 1.0f - FMath::Clamp((Distance - NearDistance) / FadeRange, 0.0f, 1.0f);
+
+		// 1 inside view cone, fading to 0 at 90 degrees off-axis
+		const float Dot = FVector::DotProduct(ViewPoint.GetRotation().GetForwardVector(), ToCharacter / Distance);
+		float ViewScore = FMath::Clamp(Dot / CosHalfAngle, 0.0f, 1.0f);
+
+		if (!bRendered)
+		{
+			ViewScore *= 0.25f;
+		}
+
+		BestScore = FMath::Max(BestScore, DistanceScore * (0.3f + 0.7f * ViewScore));
+	}
+
+	// Shooting / being shot - keep animation and effects readable
+	if (bInCombat)
+	{
+		BestScore += 0.35f;
+	}
+
+	return FMath::Clamp(BestScore, 0.0f, 1.0f);
+}
+
+EFPSProxyDetail UFPSCharacterSignificanceSubsystem::DetailForScore(float Score, EFPSProxyDetail Current) const
+{
+	// Promote above Threshold + Hysteresis, demote below Threshold - Hysteresis
+	auto IsAbove = [this, Score](float Threshold, bool bCurrentlyAbove)
+	{
+		return Score >= (bCurrentlyAbove ? Threshold - ScoreHysteresis : Threshold + ScoreHysteresis);
+	};
+
+	if (IsAbove(FullScore, Current == EFPSProxyDetail::Full))
+	{
+		return EFPSProxyDetail::Full;
+	}
+
+	return IsAbove(ReducedScore, Current != EFPSProxyDetail::Minimal) ? EFPSProxyDetail::Reduced : EFPSProxyDetail::Minimal;
+}
+
+UFPSCharacterSignificanceSubsystem::FTrackedCharacter* UFPSCharacterSignificanceSubsystem::FindEntry(const AActor* Character)
+{
+	return TrackedCharacters.FindByPredicate([Character](const FTrackedCharacter& Entry)
+	{
+		return Entry.Character.Get() == Character;
+	});
+}
+
+const UFPSCharacterSignificanceSubsystem::FTrackedCharacter* UFPSCharacterSignificanceSubsystem::FindEntry(const AActor* Character) const
+{
+	return TrackedCharacters.FindByPredicate([Character](const FTrackedCharacter& Entry)
+	{
+		return Entry.Character.Get() == Character;
+	});
+}
@@ -0,0 +1,347 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/FPSCombatReplaySubsystem.h"
+#include "Core/FPSHitboxSubsystem.h"
+#include "Components/BallisticsComponent.h"
+#include "Data/AmmoTypeDataAsset.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/Crc.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+bool UFPSCombatReplaySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFPSCombatReplaySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Server only, opt-in
+	bRecording = InWorld.GetNetMode() != NM_Client && FParse::Param(FCommandLine::Get(), TEXT("FPSCombatRecord"));
+
+	if (bRecording)
+	{
+		UE_LOG(LogTemp, Log, TEXT("FPSCombatReplaySubsystem::OnWorldBeginPlay() - Recording combat inputs"));
+	}
+}
+
+void UFPSCombatReplaySubsystem::Deinitialize()
+{
+	if (bRecording && RecordedShots.Num() > 0)
+	{
+		SaveRecording();
+	}
+
+	// Outstanding segment writes must finish before the process may exit
+	SaveTask.Wait();
+
+	bRecording = false;
+	RecordedShots.Empty();
+	TargetIds.Empty();
+	TargetClasses.Empty();
+
+	Super::Deinitialize();
+}
+
+// ============================================
+// RECORD
+// ============================================
+
+void UFPSCombatReplaySubsystem::RecordShot(const UBallisticsComponent* Ballistics, const FVector& Location, const FVector& Direction, int32 Seed)
+{
+	if (!bRecording || !Ballistics)
+	{
+		return;
+	}
+
+	// Long sessions: flush full segment instead of growing without bound
+	if (RecordedShots.Num() >= FMath::Max(MaxShotsPerRecording, 1))
+	{
+		SaveRecording();
+	}
+
+	const AActor* Weapon = Ballistics->GetOwner();
+	const AActor* Shooter = Weapon ? Weapon->GetOwner() : nullptr;
+
+	FFPSCombatShot& Shot = RecordedShots.AddDefaulted_GetRef();
+	Shot.Time = GetWorld()->GetTimeSeconds();
+	Shot.WeaponClass = FSoftClassPath(Weapon ? Weapon->GetClass() : nullptr);
+	Shot.AmmoType = FSoftObjectPath(Ballistics->GetCurrentAmmoType());
+	Shot.Location = Location;
+	Shot.Direction = Direction;
+	Shot.Seed = Seed;
+
+	// Target poses: every pawn except the shooter
+	for (TActorIterator<APawn> It(GetWorld()); It; ++It)
+	{
+		APawn* Pawn = *It;
+		if (Pawn == Shooter)
+		{
+			continue;
+		}
+
+		int32 TargetId = INDEX_NONE;
+		if (const int32* ExistingId = TargetIds.Find(Pawn))
+		{
+			TargetId = *ExistingId;
+		}
+		else
+		{
+			TargetId = TargetClasses.Add(FSoftClassPath(Pawn->GetClass()));
+			TargetIds.Add(Pawn, TargetId);
+		}
+
+		FFPSCombatTargetPose& Pose = Shot.Targets.AddDefaulted_GetRef();
+		Pose.TargetId = TargetId;
+		Pose.Location = FVector3f(Pawn->GetActorLocation());
+		Pose.Yaw = FRotator::CompressAxisToShort(Pawn->GetActorRotation().Yaw);
+	}
+}
+
+void UFPSCombatReplaySubsystem::SaveRecording()
+{
+	// Segment index keeps files unique when several segments are written within a second
+	const FString FileName = FString::Printf(TEXT("%s_%s_%03d.fpscombat"),
+		*GetWorld()->GetMapName(),
+		*FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S")),
+		RecordingSegment);
+	FString FilePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("CombatRecordings"), FileName);
+
+	// Segment moves to the task, target table is copied (stays cumulative - later segments keep the same ids)
+	SaveTask = UE::Tasks::Launch(UE_SOURCE_LOCATION,
+		[Shots = MoveTemp(RecordedShots), Classes = TargetClasses, FilePath = MoveTemp(FilePath)]() mutable
+		{
+			TArray<uint8> Data;
+			FMemoryWriter Writer(Data);
+
+			uint32 Magic = FileMagic;
+			uint32 Version = FileVersion;
+			Writer << Magic << Version << Classes << Shots;
+
+			if (FFileHelper::SaveArrayToFile(Data, *FilePath))
+			{
+				UE_LOG(LogTemp, Log, TEXT("FPSCombatReplaySubsystem::SaveRecording() - %d shots, %d targets -> %s"),
+					Shots.Num(), Classes.Num(), *FilePath);
+			}
+			else
+			{
+				UE_LOG(LogTemp, Error, TEXT("FPSCombatReplaySubsystem::SaveRecording() - Failed to write %s"), *FilePath);
+			}
+		},
+		UE::Tasks::Prerequisites(SaveTask), UE::Tasks::ETaskPriority::BackgroundNormal);
+
+	RecordedShots.Reset();
+	RecordingSegment++;
+}
+
+// ============================================
+// REPLAY
+// ============================================
+
+bool UFPSCombatReplaySubsystem::Replay(const FString& FilePath, const FString& ExpectedDigest)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return false;
+	}
+
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *FilePath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("FPSCombatReplaySubsystem::Replay() - Failed to read %s"), *FilePath);
+		return false;
+	}
+
+	FMemoryReader Reader(Data);
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	Reader << Magic << Version;
+
+	if (Magic != FileMagic || Version != FileVersion)
+	{
+		UE_LOG(LogTemp, Error, TEXT("FPSCombatReplaySubsystem::Replay() - %s has unsupported format (Version=%u)"), *FilePath, Version);
+		return false;
+	}
+
+	TArray<FSoftClassPath> Classes;
+	TArray<FFPSCombatShot> Shots;
+	Reader << Classes << Shots;
+
+	if (Reader.IsError())
+	{
+		UE_LOG(LogTemp, Error, TEXT("FPSCombatReplaySubsystem::Replay() - %s is truncated"), *FilePath);
+		return false;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	// ============================================
+	// SPAWN TARGETS (inactive until posed)
+	// ============================================
+
+	TArray<AActor*> Targets;
+	for (const FSoftClassPath& ClassPath : Classes)
+	{
+		UClass* TargetClass = ClassPath.TryLoadClass<APawn>();
+		AActor* Target = TargetClass ? World->SpawnActor<AActor>(TargetClass, FTransform::Identity, SpawnParams) : nullptr;
+		if (Target)
+		{
+			Target->SetActorEnableCollision(false);
+		}
+		Targets.Add(Target);
+	}
+
+	// ============================================
+	// RUN SHOTS
+	// ============================================
+
+	TMap<FSoftClassPath, UBallisticsComponent*> WeaponCache;
+	TArray<AActor*> SpawnedWeapons;
+	TArray<FBallisticsHitOutcome> Outcomes;
+
+	uint32 Digest = 0;
+	uint64 TotalCycles = 0;
+	uint64 MaxCycles = 0;
+	int32 NumReplayed = 0;
+	int32 NumHits = 0;
+
+	FString Csv = TEXT("Shot,Micros,Hits,Damage\n");
+
+	for (int32 ShotIndex = 0; ShotIndex < Shots.Num(); ++ShotIndex)
+	{
+		const FFPSCombatShot& Shot = Shots[ShotIndex];
+
+		UBallisticsComponent* Ballistics = nullptr;
+		if (UBallisticsComponent** Cached = WeaponCache.Find(Shot.WeaponClass))
+		{
+			Ballistics = *Cached;
+		}
+		else
+		{
+			UClass* WeaponClass = Shot.WeaponClass.TryLoadClass<AActor>();
+			AActor* Weapon = WeaponClass ? World->SpawnActor<AActor>(WeaponClass, FTransform::Identity, SpawnParams) : nullptr;
+			if (Weapon)
+			{
+				SpawnedWeapons.Add(Weapon);
+				Ballistics = Weapon->FindComponentByClass<UBallisticsComponent>();
+			}
+			WeaponCache.Add(Shot.WeaponClass, Ballistics);
+		}
+
+		UAmmoTypeDataAsset* AmmoType = Cast<UAmmoTypeDataAsset>(Shot.AmmoType.TryLoad());
+		if (!Ballistics || !AmmoType)
+		{
+			continue;
+		}
+		Ballistics->CurrentAmmoType = AmmoType;
+
+		// Restore target poses - only targets present at shot time collide
+		for (AActor* Target : Targets)
+		{
+			if (Target)
+			{
+				Target->SetActorEnableCollision(false);
+			}
+		}
+		for (const FFPSCombatTargetPose& Pose : Shot.Targets)
+		{
+			AActor* Target = Targets.IsValidIndex(Pose.TargetId) ? Targets[Pose.TargetId] : nullptr;
+			if (Target)
+			{
+				Target->SetActorTransform(Pose.ToTransform(), false, nullptr, ETeleportType::TeleportPhysics);
+				Target->SetActorEnableCollision(true);
+			}
+		}
+
+		// Poses changed within the frame - hitbox capsules must not reuse this frame's refresh
+		if (UFPSHitboxSubsystem* Hitboxes = World->GetSubsystem<UFPSHitboxSubsystem>())
+		{
+			Hitboxes->InvalidateHitboxes();
+		}
+
+		Outcomes.Reset();
+		Ballistics->SetReplayCapture(&Outcomes);
+
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		Ballistics->ShootWithSeed(Shot.Location, Shot.Direction, Shot.Seed);
+		const uint64 ShotCycles = FPlatformTime::Cycles64() - StartCycles;
+
+		Ballistics->SetReplayCapture(nullptr);
+
+		TotalCycles += ShotCycles;
+		MaxCycles = FMath::Max(MaxCycles, ShotCycles);
+		NumReplayed++;
+		NumHits += Outcomes.Num();
+
+		// Digest: shot index, hit target (replay target id or world actor name), bone, exact damage bits
+		float ShotDamage = 0.0f;
+		Digest = FCrc::MemCrc32(&ShotIndex, sizeof(ShotIndex), Digest);
+		for (const FBallisticsHitOutcome& Outcome : Outcomes)
+		{
+			AActor* HitActor = Outcome.HitActor.Get();
+			const int32 TargetId = Targets.IndexOfByKey(HitActor);
+			const FString HitName = TargetId != INDEX_NONE ? FString::Printf(TEXT("Target%d"), TargetId) : GetNameSafe(HitActor);
+
+			Digest = FCrc::StrCrc32(*HitName, Digest);
+			Digest = FCrc::StrCrc32(*Outcome.BoneName.ToString(), Digest);
+			Digest = FCrc::MemCrc32(&Outcome.Damage, sizeof(Outcome.Damage), Digest);
+
+			ShotDamage += Outcome.Damage;
+		}
+
+		Csv += FString::Printf(TEXT("%d,%.3f,%d,%.4f\n"), ShotIndex, FPlatformTime::ToMilliseconds64(ShotCycles) * 1000.0, Outcomes.Num(), ShotDamage);
+	}
+
+	// Cleanup
+	for (AActor* Weapon : SpawnedWeapons)
+	{
+		Weapon->Destroy();
+	}
+	for (AActor* Target : Targets)
+	{
+		if (Target)
+		{
+			Target->Destroy();
+		}
+	}
+
+	// ============================================
+	// REPORT
+	// ============================================
+
+	const FString CsvPath = FPaths::Combine(FPaths::GetPath(FilePath), FPaths::GetBaseFilename(FilePath) + TEXT("_replay.csv"));
+	FFileHelper::SaveStringToFile(Csv, *CsvPath);
+
+	const FString DigestString = FString::Printf(TEXT("%08X"), Digest);
+	const double TotalMs = FPlatformTime::ToMilliseconds64(TotalCycles);
+
+	UE_LOG(LogTemp, Display, TEXT("FPSCombatReplaySubsystem::Replay() - %d/%d shots, %d hits, total %.3f ms, avg %.2f us, max %.2f us, digest %s (per shot: %s)"),
+		NumReplayed, Shots.Num(), NumHits, TotalMs,
+		NumReplayed > 0 ? TotalMs * 1000.0 / NumReplayed : 0.0,
+		FPlatformTime::ToMilliseconds64(MaxCycles) * 1000.0,
+		*DigestString, *CsvPath);
+
+	if (!ExpectedDigest.IsEmpty())
+	{
+		if (!ExpectedDigest.Equals(DigestString, ESearchCase::IgnoreCase))
+		{
+			UE_LOG(LogTemp, Error, TEXT("FPSCombatReplaySubsystem::Replay() - Outcome MISMATCH (expected %s, got %s)"), *ExpectedDigest, *DigestString);
+			return false;
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("FPSCombatReplaySubsystem::Replay() - Outcome matches baseline"));
+	}
+
+	return true;
+}
@@ -0,0 +1,37 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/FPSCoreStats.h"
+
+DEFINE_STAT(STAT_FPSCore_Fire);
+DEFINE_STAT(STAT_FPSCore_CanFire);
+DEFINE_STAT(STAT_FPSCore_Shoot);
+DEFINE_STAT(STAT_FPSCore_ApplyHits);
+DEFINE_STAT(STAT_FPSCore_SolveHits);
+DEFINE_STAT(STAT_FPSCore_HitBatch);
+DEFINE_STAT(STAT_FPSCore_ExplosionDamage);
+DEFINE_STAT(STAT_FPSCore_ThrowArcPreview);
+DEFINE_STAT(STAT_FPSCore_HitboxRaycast);
+DEFINE_STAT(STAT_FPSCore_HitboxUpdate);
+
+DEFINE_STAT(STAT_FPSCore_CharacterTick);
+DEFINE_STAT(STAT_FPSCore_SprintIntent);
+DEFINE_STAT(STAT_FPSCore_InteractionTrace);
+DEFINE_STAT(STAT_FPSCore_AimingState);
+DEFINE_STAT(STAT_FPSCore_ProceduralArms);
+DEFINE_STAT(STAT_FPSCore_LeaningFeedback);
+DEFINE_STAT(STAT_FPSCore_ProxySignificance);
+
+DEFINE_STAT(STAT_FPSCore_HUDFlush);
+
+DEFINE_STAT(STAT_FPSCore_RPC);
+DEFINE_STAT(STAT_FPSCore_OnRep);
+
+DEFINE_STAT(STAT_FPSCore_ShotsFired);
+DEFINE_STAT(STAT_FPSCore_HitsProcessed);
+DEFINE_STAT(STAT_FPSCore_Penetrations);
+DEFINE_STAT(STAT_FPSCore_RPCsExecuted);
+DEFINE_STAT(STAT_FPSCore_OnReps);
+DEFINE_STAT(STAT_FPSCore_HUDWrites);
+
+DEFINE_STAT(STAT_FPSCore_ColdEquips);
+DEFINE_STAT(STAT_FPSCore_EvaluatedCharacterMeshes);
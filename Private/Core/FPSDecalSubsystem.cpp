@@ -0,0 +1,157 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/FPSDecalSubsystem.h"
+#include "Components/DecalComponent.h"
+#include "Materials/MaterialInterface.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+
+bool UFPSDecalSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFPSDecalSubsystem::Deinitialize()
+{
+	for (TPair<TWeakObjectPtr<UMaterialInterface>, FDecalRing>& Pair : Rings)
+	{
+		for (const TWeakObjectPtr<UDecalComponent>& Slot : Pair.Value.Slots)
+		{
+			if (UDecalComponent* Decal = Slot.Get())
+			{
+				Decal->DestroyComponent();
+			}
+		}
+	}
+
+	Rings.Empty();
+	DecalComponents.Empty();
+	PendingDecals.Empty();
+
+	Super::Deinitialize();
+}
+
+// ============================================
+// API
+// ============================================
+
+void UFPSDecalSubsystem::AddDecal(UMaterialInterface* Material, const FVector& Location, const FVector& Normal)
+{
+	UWorld* World = GetWorld();
+	if (!Material || !World || World->GetNetMode() == NM_DedicatedServer)
+	{
+		return;
+	}
+
+	if (PendingDecals.Num() >= MaxQueuedPlacements || !IsWithinCullDistance(Location))
+	{
+		return;
+	}
+
+	FPendingDecal& Pending = PendingDecals.AddDefaulted_GetRef();
+	Pending.Material = Material;
+	Pending.Location = Location;
+	Pending.Normal = Normal;
+}
+
+bool UFPSDecalSubsystem::IsWithinCullDistance(const FVector& Location) const
+{
+	const float MaxDistanceSq = FMath::Square(MaxDecalDistance);
+
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (PC && PC->IsLocalController() && PC->PlayerCameraManager
+			&& FVector::DistSquared(PC->PlayerCameraManager->GetCameraLocation(), Location) <= MaxDistanceSq)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void UFPSDecalSubsystem::PlaceDecal(const FPendingDecal& Pending)
+{
+	UMaterialInterface* Material = Pending.Material.Get();
+	if (!Material)
+	{
+		return;
+	}
+
+	// Decal projects along its X axis (into the surface), random roll hides repetition
+	FRotator Rotation = (-Pending.Normal).Rotation();
+	Rotation.Roll = FMath::FRandRange(-180.0f, 180.0f);
+
+	FDecalRing& Ring = Rings.FindOrAdd(Material);
+	const int32 Capacity = FMath::Max(MaxDecalsPerMaterial, 1);
+
+	// Ring full: move oldest hole (no allocation, no register/unregister)
+	if (Ring.Slots.Num() >= Capacity)
+	{
+		const int32 Slot = Ring.NextSlot;
+		Ring.NextSlot = (Ring.NextSlot + 1) % Ring.Slots.Num();
+
+		if (UDecalComponent* Decal = Ring.Slots[Slot].Get())
+		{
+			Decal->SetWorldLocationAndRotation(Pending.Location, Rotation);
+			return;
+		}
+
+		// Slot component destroyed externally (level streaming, world teardown) - recreate below
+		Ring.Slots[Slot] = nullptr;
+		Ring.NextSlot = Slot;
+		DecalComponents.RemoveAll([](const TObjectPtr<UDecalComponent>& Existing) { return !IsValid(Existing); });
+	}
+
+	UDecalComponent* Decal = NewObject<UDecalComponent>(GetWorld());
+	Decal->SetDecalMaterial(Material);
+	Decal->DecalSize = DecalSize;
+	Decal->SetFadeScreenSize(DecalFadeScreenSize);
+	Decal->SetWorldLocationAndRotation(Pending.Location, Rotation);
+	Decal->RegisterComponentWithWorld(GetWorld());
+	DecalComponents.Add(Decal);
+
+	if (Ring.Slots.Num() < Capacity)
+	{
+		Ring.Slots.Add(Decal);
+	}
+	else
+	{
+		Ring.Slots[Ring.NextSlot] = Decal;
+		Ring.NextSlot = (Ring.NextSlot + 1) % Ring.Slots.Num();
+	}
+}
+
+// ============================================
+// TICK (place once per frame)
+// ============================================
+
+ETickableTickType UFPSDecalSubsystem::GetTickableTickType() const
+{
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UFPSDecalSubsystem::IsTickable() const
+{
+	return PendingDecals.Num() > 0;
+}
+
+TStatId UFPSDecalSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFPSDecalSubsystem, STATGROUP_Tickables);
+}
+
+void UFPSDecalSubsystem::Tick(float DeltaTime)
+{
+	const int32 NumToPlace = FMath::Min(PendingDecals.Num(), FMath::Max(MaxPlacementsPerFrame, 1));
+
+	for (int32 Index = 0; Index < NumToPlace; ++Index)
+	{
+		PlaceDecal(PendingDecals[Index]);
+	}
+
+	// Oldest first - remainder keeps its order for next frame
+	PendingDecals.RemoveAt(0, NumToPlace);
+}
@@ -0,0 +1,322 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/FPSDroppedItemSubsystem.h"
+#include "Components/DroppedItemComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Interfaces/HoldableInterface.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "Algo/Count.h"
+
+bool UFPSDroppedItemSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// ============================================
+// API
+// ============================================
+
+void UFPSDroppedItemSubsystem::RegisterDroppedItem(AActor* Item, bool bCountTowardCap)
+{
+	// Clients simulate the drop locally but wait for the server's rest transform
+	if (!IsValid(Item) || !Item->HasAuthority())
+	{
+		return;
+	}
+
+	UPrimitiveComponent* Mesh = GetPhysicsMesh(Item);
+	if (!Mesh)
+	{
+		return;
+	}
+
+	// Re-drop of a tracked item restarts tracking
+	RemoveEntries(Item);
+
+	if (UDroppedItemComponent* DroppedComp = Item->FindComponentByClass<UDroppedItemComponent>())
+	{
+		DroppedComp->ClearRestState();
+	}
+
+	if (Item->NetDormancy > DORM_Awake)
+	{
+		Item->SetNetDormancy(DORM_Awake);
+	}
+
+	FSimulatingItem& Entry = SimulatingItems.AddDefaulted_GetRef();
+	Entry.Item = Item;
+	Entry.Mesh = Mesh;
+	Entry.DropTime = GetWorld()->GetTimeSeconds();
+	Entry.bCountTowardCap = bCountTowardCap;
+
+	if (bCountTowardCap)
+	{
+		EnforceItemCap();
+	}
+}
+
+void UFPSDroppedItemSubsystem::UnregisterItem(AActor* Item)
+{
+	if (!Item)
+	{
+		return;
+	}
+
+	RemoveEntries(Item);
+
+	if (Item->HasAuthority())
+	{
+		// Wake BEFORE changing replicated state so pickup (owner, attachment) reaches clients
+		if (Item->NetDormancy > DORM_Awake)
+		{
+			Item->SetNetDormancy(DORM_Awake);
+		}
+
+		if (UDroppedItemComponent* DroppedComp = Item->FindComponentByClass<UDroppedItemComponent>())
+		{
+			DroppedComp->ClearRestState();
+		}
+	}
+}
+
+void UFPSDroppedItemSubsystem::ApplyRestState(AActor* Item, const FTransform& RestTransform)
+{
+	if (!IsValid(Item) || Item->HasAuthority())
+	{
+		return;
+	}
+
+	// Rest state arrived after a pickup was already applied - ignore
+	if (Item->GetAttachParentActor())
+	{
+		return;
+	}
+
+	UPrimitiveComponent* Mesh = GetPhysicsMesh(Item);
+	if (!Mesh)
+	{
+		return;
+	}
+
+	// Clients never evict - cap flag unused here
+	RemoveEntries(Item);
+	FreezeItem(Item, Mesh, RestTransform, GetWorld()->GetTimeSeconds(), false);
+}
+
+// ============================================
+// TICK (authority, only while items simulate)
+// ============================================
+
+ETickableTickType UFPSDroppedItemSubsystem::GetTickableTickType() const
+{
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UFPSDroppedItemSubsystem::IsTickable() const
+{
+	return SimulatingItems.Num() > 0;
+}
+
+TStatId UFPSDroppedItemSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFPSDroppedItemSubsystem, STATGROUP_Tickables);
+}
+
+void UFPSDroppedItemSubsystem::Tick(float DeltaTime)
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const float CurrentTime = World->GetTimeSeconds();
+
+	for (int32 Index = SimulatingItems.Num() - 1; Index >= 0; --Index)
+	{
+		FSimulatingItem& Entry = SimulatingItems[Index];
+		AActor* Item = Entry.Item.Get();
+		UPrimitiveComponent* Mesh = Entry.Mesh.Get();
+
+		// Destroyed, or physics turned off by someone else (attached without PerformPickup)
+		if (!Item || !Mesh || !Mesh->IsSimulatingPhysics())
+		{
+			SimulatingItems.RemoveAt(Index);
+			continue;
+		}
+
+		// Settle detection: body asleep, or slow for SettleTime
+		const bool bSlow = Mesh->GetPhysicsLinearVelocity().Size() < SettleLinearSpeed
+			&& Mesh->GetPhysicsAngularVelocityInDegrees().Size() < SettleAngularSpeed;
+
+		Entry.RestTime = bSlow ? Entry.RestTime + DeltaTime : 0.0f;
+
+		const bool bSettled = !Mesh->RigidBodyIsAwake() || Entry.RestTime >= SettleTime;
+		const bool bExpired = CurrentTime - Entry.DropTime >= MaxSimulationTime;
+
+		if (!bSettled && !bExpired)
+		{
+			continue;
+		}
+
+		const float DropTime = Entry.DropTime;
+		const bool bCountTowardCap = Entry.bCountTowardCap;
+		SimulatingItems.RemoveAt(Index);
+
+		const FTransform RestTransform(Mesh->GetComponentRotation(), Mesh->GetComponentLocation());
+		FreezeItem(Item, Mesh, RestTransform, DropTime, bCountTowardCap);
+
+		// Final transform travels with RestState - stop movement replication, then go dormant
+		// (pending property changes are sent before the channel goes dormant)
+		Item->SetReplicateMovement(false);
+
+		if (UDroppedItemComponent* DroppedComp = Item->FindComponentByClass<UDroppedItemComponent>())
+		{
+			DroppedComp->SetRestState(RestTransform);
+		}
+
+		Item->ForceNetUpdate();
+		Item->SetNetDormancy(DORM_DormantAll);
+	}
+}
+
+// ============================================
+// HELPERS
+// ============================================
+
+void UFPSDroppedItemSubsystem::FreezeItem(AActor* Item, UPrimitiveComponent* Mesh, const FTransform& RestTransform, float DropTime, bool bCountTowardCap)
+{
+	Mesh->SetSimulatePhysics(false);
+
+	// Simulating non-root mesh detached from root - move root to rest pose and re-attach
+	// (same hierarchy PerformPickup / PerformDrop expect)
+	Item->SetActorLocationAndRotation(RestTransform.GetLocation(), RestTransform.GetRotation());
+
+	USceneComponent* ItemRoot = Item->GetRootComponent();
+	if (ItemRoot && Mesh != ItemRoot)
+	{
+		const FAttachmentTransformRules ReAttachRules(
+			EAttachmentRule::SnapToTarget,
+			EAttachmentRule::SnapToTarget,
+			EAttachmentRule::KeepWorld,
+			false
+		);
+		Mesh->AttachToComponent(ItemRoot, ReAttachRules);
+		Mesh->SetRelativeTransform(FTransform::Identity);
+	}
+
+	FRestingItem& Entry = RestingItems.AddDefaulted_GetRef();
+	Entry.Item = Item;
+	Entry.Mesh = Mesh;
+	Entry.DropTime = DropTime;
+	Entry.bCountTowardCap = bCountTowardCap;
+
+	// Pose snapshot: no bone refresh, no tick (collision kept for interaction traces)
+	if (USkeletalMeshComponent* SkeletalMesh = Cast<USkeletalMeshComponent>(Mesh))
+	{
+		SkeletalMesh->bNoSkeletonUpdate = true;
+		SkeletalMesh->SetComponentTickEnabled(false);
+	}
+
+	// Static proxy - cosmetic, nobody renders on dedicated server
+	const UDroppedItemComponent* DroppedComp = Item->FindComponentByClass<UDroppedItemComponent>();
+	if (DroppedComp && DroppedComp->RestProxyMesh && GetWorld()->GetNetMode() != NM_DedicatedServer)
+	{
+		UStaticMeshComponent* Proxy = NewObject<UStaticMeshComponent>(Item);
+		Proxy->SetStaticMesh(DroppedComp->RestProxyMesh);
+		Proxy->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		Proxy->SetGenerateOverlapEvents(false);
+		Proxy->SetupAttachment(Mesh);
+		Proxy->RegisterComponent();
+
+		Mesh->SetVisibility(false);
+		Entry.Proxy = Proxy;
+	}
+}
+
+void UFPSDroppedItemSubsystem::ThawItem(const FRestingItem& Entry)
+{
+	UPrimitiveComponent* Mesh = Entry.Mesh.Get();
+
+	if (UStaticMeshComponent* Proxy = Entry.Proxy.Get())
+	{
+		Proxy->DestroyComponent();
+
+		if (Mesh)
+		{
+			Mesh->SetVisibility(true);
+		}
+	}
+
+	if (USkeletalMeshComponent* SkeletalMesh = Cast<USkeletalMeshComponent>(Mesh))
+	{
+		SkeletalMesh->bNoSkeletonUpdate = false;
+		SkeletalMesh->SetComponentTickEnabled(true);
+	}
+}
+
+void UFPSDroppedItemSubsystem::EnforceItemCap()
+{
+	SimulatingItems.RemoveAll([](const FSimulatingItem& Entry) { return !Entry.Item.IsValid(); });
+	RestingItems.RemoveAll([](const FRestingItem& Entry) { return !Entry.Item.IsValid(); });
+
+	auto IsCapped = [](const auto& Entry) { return Entry.bCountTowardCap; };
+
+	int32 NumCapped = Algo::CountIf(SimulatingItems, IsCapped) + Algo::CountIf(RestingItems, IsCapped);
+
+	for (; NumCapped > FMath::Max(MaxDroppedItems, 1); --NumCapped)
+	{
+		// Oldest capped drop across both lists
+		const int32 SimulatingIndex = SimulatingItems.IndexOfByPredicate(IsCapped);
+		const int32 RestingIndex = RestingItems.IndexOfByPredicate(IsCapped);
+
+		const bool bEvictResting = RestingIndex != INDEX_NONE
+			&& (SimulatingIndex == INDEX_NONE || RestingItems[RestingIndex].DropTime <= SimulatingItems[SimulatingIndex].DropTime);
+
+		AActor* Oldest = nullptr;
+		if (bEvictResting)
+		{
+			Oldest = RestingItems[RestingIndex].Item.Get();
+			RestingItems.RemoveAt(RestingIndex);
+		}
+		else
+		{
+			Oldest = SimulatingItems[SimulatingIndex].Item.Get();
+			SimulatingItems.RemoveAt(SimulatingIndex);
+		}
+
+		if (Oldest)
+		{
+			Oldest->Destroy();
+		}
+	}
+}
+
+void UFPSDroppedItemSubsystem::RemoveEntries(AActor* Item)
+{
+	SimulatingItems.RemoveAll([Item](const FSimulatingItem& Entry)
+	{
+		return Entry.Item.Get() == Item;
+	});
+
+	for (int32 Index = RestingItems.Num() - 1; Index >= 0; --Index)
+	{
+		if (RestingItems[Index].Item.Get() == Item)
+		{
+			ThawItem(RestingItems[Index]);
+			RestingItems.RemoveAt(Index);
+		}
+	}
+}
+
+UPrimitiveComponent* UFPSDroppedItemSubsystem::GetPhysicsMesh(AActor* Item)
+{
+	if (Item->Implements<UHoldableInterface>())
+	{
+		return IHoldableInterface::Execute_GetTPSMeshComponent(Item);
+	}
+
+	return Cast<UPrimitiveComponent>(Item->GetRootComponent());
+}
@@ -0,0 +1,226 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/FPSHitboxSubsystem.h"
+#include "Components/HitboxComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+
+bool UFPSHitboxSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// ============================================
+// REGISTRY
+// ============================================
+
+void UFPSHitboxSubsystem::RegisterHitbox(UHitboxComponent* Hitbox)
+{
+	if (Hitbox)
+	{
+		Hitboxes.AddUnique(Hitbox);
+	}
+}
+
+void UFPSHitboxSubsystem::UnregisterHitbox(UHitboxComponent* Hitbox)
+{
+	Hitboxes.RemoveSwap(Hitbox);
+}
+
+void UFPSHitboxSubsystem::InvalidateHitboxes()
+{
+	for (UHitboxComponent* Hitbox : Hitboxes)
+	{
+		Hitbox->InvalidateHitboxes();
+	}
+}
+
+// ============================================
+// QUERY
+// ============================================
+
+int32 UFPSHitboxSubsystem::Raycast(const FVector& Start, const FVector& End, TConstArrayView<const AActor*> IgnoredActors, TArray<FHitResult>& OutHits) const
+{
+	const FVector Delta = End - Start;
+	const float Length = Delta.Size();
+	if (Length <= KINDA_SMALL_NUMBER)
+	{
+		return 0;
+	}
+	const FVector Direction = Delta / Length;
+
+	int32 NumHits = 0;
+	for (UHitboxComponent* Hitbox : Hitboxes)
+	{
+		if (IgnoredActors.Contains(Hitbox->GetOwner()) || !Hitbox->IsQueryable())
+		{
+			continue;
+		}
+
+		// Broadphase: ray segment vs mesh bounds sphere (engine-maintained, no capsule refresh needed)
+		const FBoxSphereBounds Bounds = Hitbox->GetQueryBounds();
+		const float T = FMath::Clamp(FVector::DotProduct(Bounds.Origin - Start, Direction), 0.0f, Length);
+		if (FVector::DistSquared(Start + Direction * T, Bounds.Origin) > FMath::Square(Bounds.SphereRadius))
+		{
+			continue;
+		}
+
+		FHitResult Hit;
+		if (Hitbox->Raycast(Start, Direction, Length, Hit))
+		{
+			OutHits.Add(Hit);
+			NumHits++;
+		}
+	}
+
+	return NumHits;
+}
+
+// ============================================
+// BENCHMARK
+// ============================================
+
+void UFPSHitboxSubsystem::Benchmark(int32 NumPlayers, int32 NumRays)
+{
+	UWorld* World = GetWorld();
+	if (!World || Hitboxes.Num() == 0 || NumRays <= 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FPSHitboxSubsystem::Benchmark() - Requires at least one character with UHitboxComponent"));
+		return;
+	}
+
+	// ============================================
+	// PAD WORLD TO NumPlayers (grid next to first character)
+	// ============================================
+
+	AActor* Template = Hitboxes[0]->GetOwner();
+	const FVector GridOrigin = Template->GetActorLocation();
+	const int32 GridSize = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumPlayers)));
+	const float GridSpacing = 300.0f;
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	TArray<AActor*> Spawned;
+	for (int32 Slot = Hitboxes.Num(); Slot < NumPlayers; ++Slot)
+	{
+		const FVector Location = GridOrigin + FVector((Slot % GridSize) * GridSpacing, (Slot / GridSize) * GridSpacing, 0.0f);
+		if (AActor* Actor = World->SpawnActor<AActor>(Template->GetClass(), Location, Template->GetActorRotation(), SpawnParams))
+		{
+			Spawned.Add(Actor);
+		}
+	}
+
+	TArray<UHitboxComponent*> Targets;
+	for (UHitboxComponent* Hitbox : Hitboxes)
+	{
+		if (Hitbox->IsQueryable())
+		{
+			Targets.Add(Hitbox);
+		}
+	}
+
+	// ============================================
+	// RAYS (fixed seed - same set for both paths)
+	// ============================================
+
+	FRandomStream Random(0x48495458);
+	const float RayLength = 5000.0f;
+
+	TArray<FVector> Starts;
+	TArray<FVector> Ends;
+	Starts.Reserve(NumRays);
+	Ends.Reserve(NumRays);
+
+	for (int32 Ray = 0; Ray < NumRays && Targets.Num() > 0; ++Ray)
+	{
+		const FBoxSphereBounds Bounds = Targets[Random.RandHelper(Targets.Num())]->GetQueryBounds();
+		const FVector AimPoint = Bounds.Origin + FVector(
+			Random.FRandRange(-1.0f, 1.0f) * Bounds.BoxExtent.X * 0.5f,
+			Random.FRandRange(-1.0f, 1.0f) * Bounds.BoxExtent.Y * 0.5f,
+			Random.FRandRange(-1.0f, 1.0f) * Bounds.BoxExtent.Z);
+
+		FVector FromDirection = Random.GetUnitVector();
+		FromDirection.Z *= 0.25f;
+		FromDirection.Normalize();
+
+		const FVector Start = AimPoint + FromDirection * 2000.0f;
+		Starts.Add(Start);
+		Ends.Add(Start + (AimPoint - Start).GetSafeNormal() * RayLength);
+	}
+
+	// ============================================
+	// HITBOX PATH (includes once-per-frame capsule refresh)
+	// ============================================
+
+	InvalidateHitboxes();
+
+	TArray<const AActor*> HitboxResults;
+	HitboxResults.Reserve(Starts.Num());
+	TArray<FHitResult> Hits;
+
+	const uint64 HitboxStart = FPlatformTime::Cycles64();
+	for (int32 Ray = 0; Ray < Starts.Num(); ++Ray)
+	{
+		Hits.Reset();
+		Raycast(Starts[Ray], Ends[Ray], {}, Hits);
+
+		const FHitResult* Nearest = nullptr;
+		for (const FHitResult& Hit : Hits)
+		{
+			if (!Nearest || Hit.Distance < Nearest->Distance)
+			{
+				Nearest = &Hit;
+			}
+		}
+		HitboxResults.Add(Nearest ? Nearest->GetActor() : nullptr);
+	}
+	const double HitboxMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - HitboxStart);
+
+	// ============================================
+	// PHYSICS PATH (previous bullet query: complex multi trace, physics-asset bodies)
+	// ============================================
+
+	FCollisionQueryParams TraceParams;
+	TraceParams.bTraceComplex = true;
+	TraceParams.bReturnPhysicalMaterial = true;
+
+	int32 NumAgree = 0;
+	int32 NumCharacterHits = 0;
+	TArray<FHitResult> PhysicsHits;
+
+	const uint64 PhysicsStart = FPlatformTime::Cycles64();
+	for (int32 Ray = 0; Ray < Starts.Num(); ++Ray)
+	{
+		PhysicsHits.Reset();
+		World->LineTraceMultiByChannel(PhysicsHits, Starts[Ray], Ends[Ray], ECC_GameTraceChannel2, TraceParams);
+
+		const AActor* FirstCharacter = nullptr;
+		for (const FHitResult& Hit : PhysicsHits)
+		{
+			const AActor* HitActor = Hit.GetActor();
+			if (HitActor && Targets.ContainsByPredicate([HitActor](const UHitboxComponent* Target) { return Target->GetOwner() == HitActor; }))
+			{
+				FirstCharacter = HitActor;
+				break;
+			}
+		}
+
+		NumAgree += FirstCharacter == HitboxResults[Ray] ? 1 : 0;
+		NumCharacterHits += HitboxResults[Ray] ? 1 : 0;
+	}
+	const double PhysicsMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - PhysicsStart);
+
+	const int32 NumTraced = FMath::Max(Starts.Num(), 1);
+	UE_LOG(LogTemp, Display, TEXT("FPSHitboxSubsystem::Benchmark() - %d players, %d rays, %d character hits: hitbox %.3f ms (%.2f us/ray), physics %.3f ms (%.2f us/ray), first-character agreement %.1f%%"),
+		Targets.Num(), Starts.Num(), NumCharacterHits,
+		HitboxMs, HitboxMs * 1000.0 / NumTraced,
+		PhysicsMs, PhysicsMs * 1000.0 / NumTraced,
+		100.0 * NumAgree / NumTraced);
+
+	for (AActor* Actor : Spawned)
+	{
+		Actor->Destroy();
+	}
+}
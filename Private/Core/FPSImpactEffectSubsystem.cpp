@@ -0,0 +1,206 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/FPSImpactEffectSubsystem.h"
+#include "NiagaraSystem.h"
+#include "NiagaraComponent.h"
+#include "NiagaraFunctionLibrary.h"
+#include "NiagaraDataInterfaceArrayFunctionLibrary.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+
+namespace FPSImpactParams
+{
+	// Array user parameters of batched impact systems (names without "User." prefix for array writers)
+	static const FName Positions(TEXT("ImpactPositions"));
+	static const FName Normals(TEXT("ImpactNormals"));
+
+	// Exposed parameter store names carry the "User." namespace
+	static const FName PositionsUser(TEXT("User.ImpactPositions"));
+}
+
+bool UFPSImpactEffectSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFPSImpactEffectSubsystem::Deinitialize()
+{
+	for (TPair<TWeakObjectPtr<UNiagaraSystem>, FImpactBatch>& Pair : Batches)
+	{
+		if (UNiagaraComponent* Component = Pair.Value.Component.Get())
+		{
+			Component->DestroyComponent();
+		}
+	}
+
+	Batches.Empty();
+	BatchableSystems.Empty();
+
+	Super::Deinitialize();
+}
+
+// ============================================
+// API
+// ============================================
+
+void UFPSImpactEffectSubsystem::AddImpact(UNiagaraSystem* System, const FVector& Location, const FVector& Normal)
+{
+	UWorld* World = GetWorld();
+	if (!System || !World || World->GetNetMode() == NM_DedicatedServer)
+	{
+		return;
+	}
+
+	// Budget window = one frame
+	if (BudgetFrame != GFrameCounter)
+	{
+		BudgetFrame = GFrameCounter;
+		ImpactsThisFrame = 0;
+	}
+
+	if (ImpactsThisFrame >= MaxImpactsPerFrame || !IsWithinCullDistance(Location))
+	{
+		return;
+	}
+	ImpactsThisFrame++;
+
+	if (!IsBatchable(System))
+	{
+		// Legacy per-impact system instance (pooled)
+		UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+			World,
+			System,
+			Location,
+			FRotationMatrix::MakeFromZ(Normal).Rotator(),
+			FVector(1.0f),
+			true,
+			true,
+			ENCPoolMethod::AutoRelease
+		);
+		return;
+	}
+
+	FImpactBatch& Batch = Batches.FindOrAdd(System);
+	Batch.Positions.Add(Location);
+	Batch.Normals.Add(Normal);
+	bHasPendingWork = true;
+}
+
+bool UFPSImpactEffectSubsystem::IsBatchable(UNiagaraSystem* System)
+{
+	if (const bool* Cached = BatchableSystems.Find(System))
+	{
+		return *Cached;
+	}
+
+	bool bBatchable = false;
+	for (const FNiagaraVariableWithOffset& Variable : System->GetExposedParameters().ReadParameterVariables())
+	{
+		if (Variable.GetName() == FPSImpactParams::PositionsUser)
+		{
+			bBatchable = true;
+			break;
+		}
+	}
+
+	BatchableSystems.Add(System, bBatchable);
+	return bBatchable;
+}
+
+bool UFPSImpactEffectSubsystem::IsWithinCullDistance(const FVector& Location) const
+{
+	const float MaxDistanceSq = FMath::Square(MaxImpactDistance);
+
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (PC && PC->IsLocalController() && PC->PlayerCameraManager
+			&& FVector::DistSquared(PC->PlayerCameraManager->GetCameraLocation(), Location) <= MaxDistanceSq)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+UNiagaraComponent* UFPSImpactEffectSubsystem::GetBatchComponent(UNiagaraSystem* System, FImpactBatch& Batch)
+{
+	if (UNiagaraComponent* Existing = Batch.Component.Get())
+	{
+		return Existing;
+	}
+
+	// Not pooled, never auto-destroyed - lives as long as the world
+	UNiagaraComponent* Component = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+		GetWorld(),
+		System,
+		FVector::ZeroVector,
+		FRotator::ZeroRotator,
+		FVector(1.0f),
+		false,
+		true,
+		ENCPoolMethod::None
+	);
+
+	if (Component)
+	{
+		// Particles are anywhere in the world - never cull the batch by component bounds
+		Component->SetSystemFixedBounds(FBox(FVector(-HALF_WORLD_MAX), FVector(HALF_WORLD_MAX)));
+	}
+
+	Batch.Component = Component;
+	return Component;
+}
+
+// ============================================
+// TICK (flush once per frame)
+// ============================================
+
+ETickableTickType UFPSImpactEffectSubsystem::GetTickableTickType() const
+{
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UFPSImpactEffectSubsystem::IsTickable() const
+{
+	return bHasPendingWork;
+}
+
+TStatId UFPSImpactEffectSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFPSImpactEffectSubsystem, STATGROUP_Tickables);
+}
+
+void UFPSImpactEffectSubsystem::Tick(float DeltaTime)
+{
+	bHasPendingWork = false;
+
+	for (TPair<TWeakObjectPtr<UNiagaraSystem>, FImpactBatch>& Pair : Batches)
+	{
+		FImpactBatch& Batch = Pair.Value;
+		const bool bHasImpacts = Batch.Positions.Num() > 0;
+
+		if (!bHasImpacts && !Batch.bNeedsClear)
+		{
+			continue;
+		}
+
+		UNiagaraSystem* System = Pair.Key.Get();
+		UNiagaraComponent* Component = System ? GetBatchComponent(System, Batch) : nullptr;
+		if (Component)
+		{
+			// One array write per system per frame, regardless of impact count
+			UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayPosition(Component, FPSImpactParams::Positions, Batch.Positions);
+			UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVector(Component, FPSImpactParams::Normals, Batch.Normals);
+		}
+
+		Batch.Positions.Reset();
+		Batch.Normals.Reset();
+
+		// Written non-empty this frame → empty it next frame
+		Batch.bNeedsClear = bHasImpacts;
+		bHasPendingWork |= bHasImpacts;
+	}
+}
@@ -0,0 +1,169 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/FPSRagdollSubsystem.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "PhysicsEngine/BodyInstance.h"
+#include "Engine/World.h"
+
+bool UFPSRagdollSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// ============================================
+// API
+// ============================================
+
+bool UFPSRagdollSubsystem::BeginRagdoll(USkeletalMeshComponent* Mesh, FName RootBone)
+{
+	if (!IsValid(Mesh))
+	{
+		return false;
+	}
+
+	// Dedicated server: nobody sees the corpse - skip cosmetic simulation entirely
+	UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_DedicatedServer)
+	{
+		return false;
+	}
+
+	// Re-entrant safety (death processed twice)
+	EndRagdoll(Mesh);
+
+	// Enforce budget BEFORE adding - freeze oldest simulating ragdolls
+	while (ActiveRagdolls.Num() >= FMath::Max(MaxSimulatedRagdolls, 1))
+	{
+		FActiveRagdoll Oldest = ActiveRagdolls[0];
+		ActiveRagdolls.RemoveAt(0);
+
+		if (USkeletalMeshComponent* OldestMesh = Oldest.Mesh.Get())
+		{
+			FreezeRagdoll(OldestMesh);
+		}
+	}
+
+	Mesh->SetAllBodiesBelowSimulatePhysics(RootBone, true, true);
+
+	FActiveRagdoll& Entry = ActiveRagdolls.AddDefaulted_GetRef();
+	Entry.Mesh = Mesh;
+	Entry.StartTime = World->GetTimeSeconds();
+	Entry.RestTime = 0.0f;
+
+	return true;
+}
+
+void UFPSRagdollSubsystem::EndRagdoll(USkeletalMeshComponent* Mesh)
+{
+	if (!Mesh)
+	{
+		return;
+	}
+
+	ActiveRagdolls.RemoveAll([Mesh](const FActiveRagdoll& Entry)
+	{
+		return !Entry.Mesh.IsValid() || Entry.Mesh.Get() == Mesh;
+	});
+
+	const int32 NumRemoved = FrozenRagdolls.RemoveAll([Mesh](const TWeakObjectPtr<USkeletalMeshComponent>& Entry)
+	{
+		return !Entry.IsValid() || Entry.Get() == Mesh;
+	});
+
+	if (NumRemoved > 0)
+	{
+		// Restore animated state (snapshot released)
+		Mesh->bNoSkeletonUpdate = false;
+		Mesh->SetComponentTickEnabled(true);
+	}
+}
+
+// ============================================
+// TICK (only while ragdolls simulate)
+// ============================================
+
+ETickableTickType UFPSRagdollSubsystem::GetTickableTickType() const
+{
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UFPSRagdollSubsystem::IsTickable() const
+{
+	return ActiveRagdolls.Num() > 0;
+}
+
+TStatId UFPSRagdollSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFPSRagdollSubsystem, STATGROUP_Tickables);
+}
+
+void UFPSRagdollSubsystem::Tick(float DeltaTime)
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const float CurrentTime = World->GetTimeSeconds();
+
+	for (int32 Index = ActiveRagdolls.Num() - 1; Index >= 0; --Index)
+	{
+		FActiveRagdoll& Entry = ActiveRagdolls[Index];
+		USkeletalMeshComponent* Mesh = Entry.Mesh.Get();
+
+		if (!Mesh)
+		{
+			ActiveRagdolls.RemoveAt(Index);
+			continue;
+		}
+
+		// Settle detection: all bodies slow for SettleTime
+		if (GetMaxBodySpeed(Mesh) < SettleVelocityThreshold)
+		{
+			Entry.RestTime += DeltaTime;
+		}
+		else
+		{
+			Entry.RestTime = 0.0f;
+		}
+
+		const bool bSettled = Entry.RestTime >= SettleTime;
+		const bool bExpired = CurrentTime - Entry.StartTime >= MaxSimulationTime;
+
+		if (bSettled || bExpired)
+		{
+			ActiveRagdolls.RemoveAt(Index);
+			FreezeRagdoll(Mesh);
+		}
+	}
+}
+
+// ============================================
+// HELPERS
+// ============================================
+
+void UFPSRagdollSubsystem::FreezeRagdoll(USkeletalMeshComponent* Mesh)
+{
+	// Snapshot: stop bone refresh FIRST so disabling physics doesn't snap back to anim pose
+	Mesh->bNoSkeletonUpdate = true;
+	Mesh->SetAllBodiesSimulatePhysics(false);
+	Mesh->SetComponentTickEnabled(false);
+
+	FrozenRagdolls.Add(Mesh);
+}
+
+float UFPSRagdollSubsystem::GetMaxBodySpeed(const USkeletalMeshComponent* Mesh)
+{
+	float MaxSpeedSq = 0.0f;
+
+	for (const FBodyInstance* Body : Mesh->Bodies)
+	{
+		if (Body && Body->IsInstanceSimulatingPhysics())
+		{
+			MaxSpeedSq = FMath::Max(MaxSpeedSq, Body->GetUnrealWorldVelocity().SizeSquared());
+		}
+	}
+
+	return FMath::Sqrt(MaxSpeedSq);
+}
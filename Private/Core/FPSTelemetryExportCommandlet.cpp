@@ -0,0 +1,124 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/FPSTelemetryExportCommandlet.h"
+#include "Core/FPSTelemetrySubsystem.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+UFPSTelemetryExportCommandlet::UFPSTelemetryExportCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UFPSTelemetryExportCommandlet::Main(const FString& Params)
+{
+	FString InPath;
+	if (!FParse::Value(*Params, TEXT("In="), InPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("FPSTelemetryExport - Missing -In=<File.fpstel>"));
+		return 1;
+	}
+
+	FString OutBase = FPaths::Combine(FPaths::GetPath(InPath), FPaths::GetBaseFilename(InPath));
+	FParse::Value(*Params, TEXT("Out="), OutBase);
+
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *InPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("FPSTelemetryExport - Failed to read %s"), *InPath);
+		return 1;
+	}
+
+	// ============================================
+	// VALIDATE HEADER
+	// ============================================
+
+	if (Data.Num() < static_cast<int32>(sizeof(FFPSTelemetryFileHeader)))
+	{
+		UE_LOG(LogTemp, Error, TEXT("FPSTelemetryExport - %s is too small"), *InPath);
+		return 1;
+	}
+
+	FFPSTelemetryFileHeader Header;
+	FMemory::Memcpy(&Header, Data.GetData(), sizeof(Header));
+
+	if (Header.Magic != FFPSTelemetryFileHeader::ExpectedMagic
+		|| Header.Version != FFPSTelemetryFileHeader::CurrentVersion
+		|| Header.RecordSize != sizeof(FFPSTelemetryRecord))
+	{
+		UE_LOG(LogTemp, Error, TEXT("FPSTelemetryExport - %s has unsupported format (Version=%u RecordSize=%u)"),
+			*InPath, Header.Version, Header.RecordSize);
+		return 1;
+	}
+
+	// ============================================
+	// CONVERT RECORDS
+	// ============================================
+
+	TMap<uint32, FString> Names;
+	auto GetName = [&Names](uint32 Id) -> const TCHAR*
+	{
+		const FString* Found = Names.Find(Id);
+		return Found ? **Found : TEXT("");
+	};
+
+	FString ShotsCsv = TEXT("Time,ShotId,Shooter,Weapon,Seed,OriginX,OriginY,OriginZ,DirX,DirY,DirZ\n");
+	FString HitsCsv = TEXT("Time,ShotId,Actor,Bone,Material,Speed,KineticEnergy,Damage\n");
+
+	const int32 NumRecords = (Data.Num() - sizeof(FFPSTelemetryFileHeader)) / sizeof(FFPSTelemetryRecord);
+	int32 NumShots = 0;
+	int32 NumHits = 0;
+
+	for (int32 Index = 0; Index < NumRecords; ++Index)
+	{
+		FFPSTelemetryRecord Record;
+		FMemory::Memcpy(&Record, Data.GetData() + sizeof(FFPSTelemetryFileHeader) + Index * sizeof(FFPSTelemetryRecord), sizeof(Record));
+
+		switch (Record.Type)
+		{
+		case EFPSTelemetryRecordType::Name:
+		{
+			Record.Name.Text[UE_ARRAY_COUNT(Record.Name.Text) - 1] = '\0';
+			Names.Add(Record.Name.Id, ANSI_TO_TCHAR(Record.Name.Text));
+			break;
+		}
+		case EFPSTelemetryRecordType::Shot:
+		{
+			const FFPSTelemetryShot& Shot = Record.Shot;
+			ShotsCsv += FString::Printf(TEXT("%.4f,%u,%s,%s,%d,%.1f,%.1f,%.1f,%.5f,%.5f,%.5f\n"),
+				Shot.Time, Shot.ShotId, GetName(Shot.ShooterName), GetName(Shot.WeaponName), Shot.Seed,
+				Shot.Origin[0], Shot.Origin[1], Shot.Origin[2],
+				Shot.Direction[0], Shot.Direction[1], Shot.Direction[2]);
+			NumShots++;
+			break;
+		}
+		case EFPSTelemetryRecordType::Hit:
+		{
+			const FFPSTelemetryHit& Hit = Record.Hit;
+			HitsCsv += FString::Printf(TEXT("%.4f,%u,%s,%s,%s,%.2f,%.2f,%.2f\n"),
+				Hit.Time, Hit.ShotId, GetName(Hit.ActorName), GetName(Hit.BoneName), GetName(Hit.MaterialName),
+				Hit.Speed, Hit.KineticEnergy, Hit.Damage);
+			NumHits++;
+			break;
+		}
+		default:
+			UE_LOG(LogTemp, Warning, TEXT("FPSTelemetryExport - Unknown record type %d at index %d"), static_cast<int32>(Record.Type), Index);
+			break;
+		}
+	}
+
+	const FString ShotsPath = OutBase + TEXT("_shots.csv");
+	const FString HitsPath = OutBase + TEXT("_hits.csv");
+
+	if (!FFileHelper::SaveStringToFile(ShotsCsv, *ShotsPath) || !FFileHelper::SaveStringToFile(HitsCsv, *HitsPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("FPSTelemetryExport - Failed to write %s / %s"), *ShotsPath, *HitsPath);
+		return 1;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("FPSTelemetryExport - %d shots, %d hits -> %s, %s"), NumShots, NumHits, *ShotsPath, *HitsPath);
+	return 0;
+}
@@ -0,0 +1,265 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/FPSTelemetrySubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/FileManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include <atomic>
+
+// ============================================
+// WRITER (SPSC RING + BACKGROUND DRAIN)
+// ============================================
+
+class FFPSTelemetryWriter : public FRunnable
+{
+public:
+	// Power of two - index wrap is a mask
+	static constexpr uint32 Capacity = 16384;
+
+	// Background drain period (seconds)
+	static constexpr float DrainInterval = 0.1f;
+
+	explicit FFPSTelemetryWriter(FArchive* InArchive)
+		: Archive(InArchive)
+	{
+		Ring.SetNumUninitialized(Capacity);
+
+		FFPSTelemetryFileHeader Header;
+		Archive->Serialize(&Header, sizeof(Header));
+
+		Thread = FRunnableThread::Create(this, TEXT("FPSTelemetryWriter"), 0, TPri_BelowNormal);
+	}
+
+	virtual ~FFPSTelemetryWriter() override
+	{
+		if (Thread)
+		{
+			Thread->Kill(true);
+			delete Thread;
+			Thread = nullptr;
+		}
+
+		// Anything pushed after the thread's final drain
+		Drain();
+
+		Archive->Close();
+		delete Archive;
+	}
+
+	/** GAME THREAD ONLY - copy record into ring, false (dropped) if full */
+	bool Push(const FFPSTelemetryRecord& Record)
+	{
+		const uint32 Head = WriteIndex.load(std::memory_order_relaxed);
+		const uint32 Tail = ReadIndex.load(std::memory_order_acquire);
+
+		if (Head - Tail >= Capacity)
+		{
+			DroppedRecords++;
+			return false;
+		}
+
+		Ring[Head & (Capacity - 1)] = Record;
+		WriteIndex.store(Head + 1, std::memory_order_release);
+		return true;
+	}
+
+	uint32 GetDroppedRecords() const { return DroppedRecords; }
+
+	// FRunnable
+	virtual uint32 Run() override
+	{
+		while (!bStopRequested.load(std::memory_order_relaxed))
+		{
+			Drain();
+			FPlatformProcess::Sleep(DrainInterval);
+		}
+
+		Drain();
+		return 0;
+	}
+
+	virtual void Stop() override
+	{
+		bStopRequested.store(true, std::memory_order_relaxed);
+	}
+
+private:
+	/** CONSUMER ONLY - write everything between ReadIndex and WriteIndex */
+	void Drain()
+	{
+		const uint32 Head = WriteIndex.load(std::memory_order_acquire);
+		uint32 Tail = ReadIndex.load(std::memory_order_relaxed);
+
+		while (Tail != Head)
+		{
+			// Contiguous run up to ring end or head
+			const uint32 Start = Tail & (Capacity - 1);
+			const uint32 Count = FMath::Min(Head - Tail, Capacity - Start);
+
+			Archive->Serialize(&Ring[Start], Count * sizeof(FFPSTelemetryRecord));
+			Tail += Count;
+		}
+
+		ReadIndex.store(Tail, std::memory_order_release);
+	}
+
+	FArchive* Archive = nullptr;
+	FRunnableThread* Thread = nullptr;
+
+	TArray<FFPSTelemetryRecord> Ring;
+
+	// Monotonic indices (wrap via mask), uint32 overflow is harmless
+	std::atomic<uint32> WriteIndex{ 0 };
+	std::atomic<uint32> ReadIndex{ 0 };
+	std::atomic<bool> bStopRequested{ false };
+
+	// Game thread only
+	uint32 DroppedRecords = 0;
+};
+
+// ============================================
+// SUBSYSTEM
+// ============================================
+
+bool UFPSTelemetrySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFPSTelemetrySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Server only, opt-in
+	if (InWorld.GetNetMode() == NM_Client || !FParse::Param(FCommandLine::Get(), TEXT("FPSTelemetry")))
+	{
+		return;
+	}
+
+	if (!FPlatformProcess::SupportsMultithreading())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FPSTelemetrySubsystem::OnWorldBeginPlay() - No multithreading, telemetry disabled"));
+		return;
+	}
+
+	const FString FileName = FString::Printf(TEXT("%s_%s.fpstel"),
+		*InWorld.GetMapName(),
+		*FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S")));
+	const FString FilePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Telemetry"), FileName);
+
+	FArchive* Archive = IFileManager::Get().CreateFileWriter(*FilePath);
+	if (!Archive)
+	{
+		UE_LOG(LogTemp, Error, TEXT("FPSTelemetrySubsystem::OnWorldBeginPlay() - Failed to open %s"), *FilePath);
+		return;
+	}
+
+	NameIds.Reset();
+	NextShotId = 1;
+	Writer = new FFPSTelemetryWriter(Archive);
+
+	UE_LOG(LogTemp, Log, TEXT("FPSTelemetrySubsystem::OnWorldBeginPlay() - Recording to %s"), *FilePath);
+}
+
+void UFPSTelemetrySubsystem::Deinitialize()
+{
+	if (Writer)
+	{
+		const uint32 Dropped = Writer->GetDroppedRecords();
+		if (Dropped > 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("FPSTelemetrySubsystem::Deinitialize() - %u records dropped (ring full)"), Dropped);
+		}
+
+		// Stops thread, drains remaining records, closes file
+		delete Writer;
+		Writer = nullptr;
+	}
+
+	Super::Deinitialize();
+}
+
+// ============================================
+// RECORDING (GAME THREAD)
+// ============================================
+
+uint32 UFPSTelemetrySubsystem::RecordShot(const AActor* Shooter, const AActor* Weapon, const FVector& Origin, const FVector& Direction, int32 Seed)
+{
+	if (!Writer)
+	{
+		return 0;
+	}
+
+	FFPSTelemetryRecord Record;
+	Record.Type = EFPSTelemetryRecordType::Shot;
+
+	FFPSTelemetryShot& Shot = Record.Shot;
+	Shot.Time = GetWorld()->GetTimeSeconds();
+	Shot.ShotId = NextShotId++;
+	Shot.ShooterName = InternName(Shooter ? Shooter->GetFName() : NAME_None);
+	Shot.WeaponName = InternName(Weapon ? Weapon->GetClass()->GetFName() : NAME_None);
+	Shot.Seed = Seed;
+	Shot.Origin[0] = Origin.X;
+	Shot.Origin[1] = Origin.Y;
+	Shot.Origin[2] = Origin.Z;
+	Shot.Direction[0] = Direction.X;
+	Shot.Direction[1] = Direction.Y;
+	Shot.Direction[2] = Direction.Z;
+
+	Writer->Push(Record);
+	return Shot.ShotId;
+}
+
+void UFPSTelemetrySubsystem::RecordHit(uint32 ShotId, const AActor* HitActor, FName BoneName, FName MaterialName, float Speed, float KineticEnergy, float Damage)
+{
+	if (!Writer)
+	{
+		return;
+	}
+
+	FFPSTelemetryRecord Record;
+	Record.Type = EFPSTelemetryRecordType::Hit;
+
+	FFPSTelemetryHit& Hit = Record.Hit;
+	Hit.Time = GetWorld()->GetTimeSeconds();
+	Hit.ShotId = ShotId;
+	Hit.ActorName = InternName(HitActor ? HitActor->GetFName() : NAME_None);
+	Hit.BoneName = InternName(BoneName);
+	Hit.MaterialName = InternName(MaterialName);
+	Hit.Speed = Speed;
+	Hit.KineticEnergy = KineticEnergy;
+	Hit.Damage = Damage;
+
+	Writer->Push(Record);
+}
+
+uint32 UFPSTelemetrySubsystem::InternName(FName Name)
+{
+	if (const uint32* ExistingId = NameIds.Find(Name))
+	{
+		return *ExistingId;
+	}
+
+	const uint32 NewId = NameIds.Num() + 1;
+
+	// First use: string conversion happens once per name per file
+	FFPSTelemetryRecord Record;
+	FMemory::Memzero(Record);
+	Record.Type = EFPSTelemetryRecordType::Name;
+	Record.Name.Id = NewId;
+	FCStringAnsi::Strncpy(Record.Name.Text, TCHAR_TO_ANSI(*Name.ToString()), UE_ARRAY_COUNT(Record.Name.Text));
+
+	// Ring full - don't cache, retry on next use (0 = unknown name in export)
+	if (!Writer->Push(Record))
+	{
+		return 0;
+	}
+
+	NameIds.Add(Name, NewId);
+	return NewId;
+}
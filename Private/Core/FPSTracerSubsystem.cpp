@@ -0,0 +1,243 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/FPSTracerSubsystem.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+
+namespace
+{
+	// Hidden slot: degenerate instance, no pixels
+	const FTransform HiddenTracerTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector);
+
+	// Tracer mesh authored 100 units long along +X
+	constexpr float TracerMeshLength = 100.0f;
+
+	struct FTracerView
+	{
+		FVector Location;
+		FVector Forward;
+		float HalfFOVRad;
+	};
+}
+
+bool UFPSTracerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFPSTracerSubsystem::Deinitialize()
+{
+	for (TPair<TWeakObjectPtr<UStaticMesh>, FTracerBatch>& Pair : Batches)
+	{
+		if (UInstancedStaticMeshComponent* Instances = Pair.Value.Instances.Get())
+		{
+			Instances->DestroyComponent();
+		}
+	}
+
+	Batches.Empty();
+	BatchComponents.Empty();
+
+	Super::Deinitialize();
+}
+
+// ============================================
+// API
+// ============================================
+
+void UFPSTracerSubsystem::AddTracer(UStaticMesh* Mesh, const FVector& Origin, const FVector& Direction, float Distance)
+{
+	UWorld* World = GetWorld();
+	if (!Mesh || !World || World->GetNetMode() == NM_DedicatedServer || Distance <= TracerStartOffset)
+	{
+		return;
+	}
+
+	FTracerBatch& Batch = Batches.FindOrAdd(Mesh);
+	if (Batch.Tracers.Num() == 0)
+	{
+		Batch.Tracers.SetNum(FMath::Max(TracerCapacity, 1));
+	}
+
+	// Ring: overwrite oldest when full
+	FTracer& Tracer = Batch.Tracers[Batch.NextSlot];
+	Batch.NextSlot = (Batch.NextSlot + 1) % Batch.Tracers.Num();
+
+	if (!Tracer.bActive)
+	{
+		Batch.NumActive++;
+	}
+
+	Tracer.Origin = Origin;
+	Tracer.Direction = Direction;
+	Tracer.Distance = Distance;
+	Tracer.StartTime = World->GetTimeSeconds();
+	Tracer.bActive = true;
+
+	bHasPendingWork = true;
+}
+
+UInstancedStaticMeshComponent* UFPSTracerSubsystem::GetBatchInstances(UStaticMesh* Mesh, FTracerBatch& Batch)
+{
+	if (UInstancedStaticMeshComponent* Existing = Batch.Instances.Get())
+	{
+		return Existing;
+	}
+
+	UInstancedStaticMeshComponent* Instances = NewObject<UInstancedStaticMeshComponent>(GetWorld());
+	Instances->SetStaticMesh(Mesh);
+	Instances->SetMobility(EComponentMobility::Movable);
+	Instances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Instances->SetGenerateOverlapEvents(false);
+	Instances->SetCastShadow(false);
+	Instances->RegisterComponentWithWorld(GetWorld());
+
+	// All slots allocated once - per frame only transforms change
+	Batch.Transforms.Init(HiddenTracerTransform, Batch.Tracers.Num());
+	Instances->AddInstances(Batch.Transforms, false);
+
+	BatchComponents.Add(Instances);
+	Batch.Instances = Instances;
+	return Instances;
+}
+
+// ============================================
+// TICK (simulate, cull, submit)
+// ============================================
+
+ETickableTickType UFPSTracerSubsystem::GetTickableTickType() const
+{
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UFPSTracerSubsystem::IsTickable() const
+{
+	return bHasPendingWork;
+}
+
+TStatId UFPSTracerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFPSTracerSubsystem, STATGROUP_Tickables);
+}
+
+void UFPSTracerSubsystem::Tick(float DeltaTime)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// Local views (split screen safe)
+	TArray<FTracerView, TInlineAllocator<4>> Views;
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (PC && PC->IsLocalController() && PC->PlayerCameraManager)
+		{
+			FTracerView& View = Views.AddDefaulted_GetRef();
+			View.Location = PC->PlayerCameraManager->GetCameraLocation();
+			View.Forward = PC->PlayerCameraManager->GetCameraRotation().Vector();
+			View.HalfFOVRad = FMath::DegreesToRadians(PC->PlayerCameraManager->GetFOVAngle() * 0.5f);
+		}
+	}
+
+	const double Now = World->GetTimeSeconds();
+	const float MaxDistanceSq = FMath::Square(MaxTracerDistance);
+
+	bHasPendingWork = false;
+
+	for (TPair<TWeakObjectPtr<UStaticMesh>, FTracerBatch>& Pair : Batches)
+	{
+		FTracerBatch& Batch = Pair.Value;
+		if (Batch.NumActive == 0 && !Batch.bNeedsHide)
+		{
+			continue;
+		}
+
+		UStaticMesh* Mesh = Pair.Key.Get();
+		UInstancedStaticMeshComponent* Instances = Mesh ? GetBatchInstances(Mesh, Batch) : nullptr;
+		if (!Instances)
+		{
+			continue;
+		}
+
+		bool bAnyVisible = false;
+
+		for (int32 Slot = 0; Slot < Batch.Tracers.Num(); ++Slot)
+		{
+			FTracer& Tracer = Batch.Tracers[Slot];
+			FTransform& InstanceTM = Batch.Transforms[Slot];
+			InstanceTM = HiddenTracerTransform;
+
+			if (!Tracer.bActive)
+			{
+				continue;
+			}
+
+			const float Travelled = static_cast<float>(Now - Tracer.StartTime) * TracerSpeed;
+			const float Head = FMath::Min(Travelled, Tracer.Distance);
+			const float Tail = FMath::Max(Travelled - TracerLength, TracerStartOffset);
+
+			// Tail reached impact - slot free
+			if (Tail >= Tracer.Distance)
+			{
+				Tracer.bActive = false;
+				Batch.NumActive--;
+				continue;
+			}
+
+			if (Head <= Tail)
+			{
+				continue;
+			}
+
+			// Cull: closest approach within MaxTracerDistance and bounding sphere inside view cone
+			const FVector TailLocation = Tracer.Origin + Tracer.Direction * Tail;
+			const FVector HeadLocation = Tracer.Origin + Tracer.Direction * Head;
+			const FVector Center = (TailLocation + HeadLocation) * 0.5f;
+			const float HalfLength = (Head - Tail) * 0.5f;
+
+			bool bVisible = false;
+			for (const FTracerView& View : Views)
+			{
+				const FVector Closest = FMath::ClosestPointOnSegment(View.Location, TailLocation, HeadLocation);
+				if (FVector::DistSquared(View.Location, Closest) > MaxDistanceSq)
+				{
+					continue;
+				}
+
+				const FVector ToCenter = Center - View.Location;
+				const float CenterDistance = ToCenter.Size();
+				if (CenterDistance <= HalfLength)
+				{
+					bVisible = true;
+					break;
+				}
+
+				const float Angle = FMath::Acos(FMath::Clamp(FVector::DotProduct(ToCenter / CenterDistance, View.Forward), -1.0f, 1.0f));
+				if (Angle <= View.HalfFOVRad + FMath::Asin(HalfLength / CenterDistance))
+				{
+					bVisible = true;
+					break;
+				}
+			}
+
+			if (bVisible)
+			{
+				InstanceTM = FTransform(Tracer.Direction.ToOrientationQuat(), TailLocation, FVector((Head - Tail) / TracerMeshLength, TracerWidth, TracerWidth));
+				bAnyVisible = true;
+			}
+		}
+
+		// One transform upload per batch per frame
+		Instances->BatchUpdateInstancesTransforms(0, Batch.Transforms, false, true, false);
+
+		// Written visible this frame → hide next frame if nothing is left in flight
+		Batch.bNeedsHide = bAnyVisible;
+		bHasPendingWork |= Batch.NumActive > 0 || Batch.bNeedsHide;
+	}
+}
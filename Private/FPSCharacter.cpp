@@ -19,6 +19,10 @@
 #include "Interfaces/ReloadableInterface.h"
 #include "BaseWeapon.h"
 #include "Core/FPSGameplayTags.h"
+#include "Core/FPSRagdollSubsystem.h"
+#include "Core/FPSAssetPreloadSubsystem.h"
+#include "Core/FPSDroppedItemSubsystem.h"
+#include "Core/FPSCharacterSignificanceSubsystem.h"
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
 #include "InputAction.h"
@@ -27,17 +31,23 @@
 #include "ReferenceSkeleton.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "GameFramework/HUD.h"
+#include "GameFramework/GameStateBase.h"
 #include "DrawDebugHelpers.h"
 #include "Components/InventoryComponent.h"
 #include "Components/HealthComponent.h"
+#include "Components/HitboxComponent.h"
+#include "Components/FPSCharacterMovementComponent.h"
 #include "Components/RecoilComponent.h"
+#include "Animation/FPSCharacterAnimInstance.h"
 #include "Components/PrimitiveComponent.h"
 #include "Materials/MaterialParameterCollection.h"
 #include "Materials/MaterialParameterCollectionInstance.h"
 #include "Kismet/KismetMaterialLibrary.h"
 #include "Engine/DamageEvents.h"
+#include "Core/FPSCoreStats.h"
 
-AFPSCharacter::AFPSCharacter()
+AFPSCharacter::AFPSCharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<UFPSCharacterMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
 	PrimaryActorTick.bCanEverTick = true;
 
@@ -57,7 +67,7 @@ AFPSCharacter::AFPSCharacter()
 	// Performance optimization
 	GetCapsuleComponent()->SetGenerateOverlapEvents(false);
 
-	CMC = GetCharacterMovement();
+	CMC = CastChecked<UFPSCharacterMovementComponent>(GetCharacterMovement());
 	CMC->MaxWalkSpeedCrouched = 150.0f;  // Same as WalkSpeed
 
 	// Third person body - visible to others only
@@ -72,18 +82,10 @@ AFPSCharacter::AFPSCharacter()
 	GetMesh()->bEnableUpdateRateOptimizations = true;
 	GetMesh()->SetGenerateOverlapEvents(false);
 
-	Spine_03 = CreateDefaultSubobject<USceneComponent>(TEXT("spine_03"));
-	Spine_03->SetupAttachment(GetMesh());
-	Spine_04 = CreateDefaultSubobject<USceneComponent>(TEXT("spine_04"));
-	Spine_04->SetupAttachment(Spine_03);
-	Spine_05 = CreateDefaultSubobject<USceneComponent>(TEXT("spine_05"));
-	Spine_05->SetupAttachment(Spine_04);
-	Neck_01 = CreateDefaultSubobject<USceneComponent>(TEXT("neck_01"));
-	Neck_01->SetupAttachment(Spine_05);
-
+	// Camera rides an ANALYTIC spine chain (see CalculateCameraRelativeTransform)
+	// Attached directly to body mesh - spine/neck bend lives in the anim graph, not in scene components
 	Camera = CreateDefaultSubobject<UCameraComponent>(TEXT("Camera"));
-	Camera->SetupAttachment(Neck_01);
-	Camera->SetRelativeLocation(FVector(15.0f, 0.0f, 0.0f));
+	Camera->SetupAttachment(GetMesh());
 	Camera->bUsePawnControlRotation = false;
 
 	// First person arms - owner only
@@ -96,6 +98,8 @@ AFPSCharacter::AFPSCharacter()
 	// Performance optimizations (NO bComponentUseFixedSkelBounds - causes disappearing)
 	Arms->SetSimulatePhysics(false);
 	Arms->SetGenerateOverlapEvents(false);
+	// Procedural sway runs in anim update - keep updating while hidden (scoped ADS hides Arms)
+	Arms->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPose;
 
 	// First person legs - owner only
 	Legs = CreateDefaultSubobject<USkeletalMeshComponent>(TEXT("Legs"));
@@ -110,6 +114,7 @@ AFPSCharacter::AFPSCharacter()
 
 	InventoryComp = CreateDefaultSubobject<UInventoryComponent>(TEXT("InventoryComponent"));
 	HealthComp = CreateDefaultSubobject<UHealthComponent>(TEXT("HealthComponent"));
+	HitboxComp = CreateDefaultSubobject<UHitboxComponent>(TEXT("HitboxComponent"));
 	RecoilComp = CreateDefaultSubobject<URecoilComponent>(TEXT("RecoilComponent"));
 
 	// ============================================
@@ -124,6 +129,12 @@ void AFPSCharacter::PostInitializeComponents()
 	Super::PostInitializeComponents();
 
 	InitializeSpineComponents();
+
+	// Arms anim update consumes the procedural input snapshot written in Tick()
+	if (Arms)
+	{
+		Arms->PrimaryComponentTick.AddPrerequisite(this, PrimaryActorTick);
+	}
 }
 
 void AFPSCharacter::InitializeSpineComponents()
@@ -165,29 +176,15 @@ void AFPSCharacter::InitializeSpineComponents()
 
 	const FQuat InverseRotation = FRotator(0.0f, -90.0f, 0.0f).Quaternion();
 
-	Spine_03->SetRelativeLocation(Spine03Transform.GetLocation());
-	Spine_03->SetRelativeRotation(FRotator(0.0f, 90.0f, 0.0f));
-
-	// Store original Spine_03 location for crouch offset
-	OriginalSpineLocation = Spine_03->GetRelativeLocation();
+	// Cache bind-pose chain offsets (mesh space → spine_03, then parent-relative deltas)
+	OriginalSpineLocation = Spine03Transform.GetLocation();
+	SpineChainSpine04Offset = InverseRotation.RotateVector(Spine04Transform.GetLocation() - Spine03Transform.GetLocation());
+	SpineChainSpine05Offset = InverseRotation.RotateVector(Spine05Transform.GetLocation() - Spine04Transform.GetLocation());
+	SpineChainNeck01Offset = InverseRotation.RotateVector(Neck01Transform.GetLocation() - Spine05Transform.GetLocation());
 
-	auto SetChildRelativeTransform = [&](USceneComponent* Child, const FTransform& ChildBone, const FTransform& ParentBone)
-	{
-		FVector Delta = ChildBone.GetLocation() - ParentBone.GetLocation();
-		Child->SetRelativeLocation(InverseRotation.RotateVector(Delta));
-		Child->SetRelativeRotation(FRotator::ZeroRotator);
-	};
-
-	SetChildRelativeTransform(Spine_04, Spine04Transform, Spine03Transform);
-	SetChildRelativeTransform(Spine_05, Spine05Transform, Spine04Transform);
-	SetChildRelativeTransform(Neck_01, Neck01Transform, Spine05Transform);
-
-	FTransform MeshToCamera = FTransform::Identity;
-	MeshToCamera = FTransform(Spine_03->GetRelativeRotation(), Spine_03->GetRelativeLocation()) * MeshToCamera;
-	MeshToCamera = FTransform(Spine_04->GetRelativeRotation(), Spine_04->GetRelativeLocation()) * MeshToCamera;
-	MeshToCamera = FTransform(Spine_05->GetRelativeRotation(), Spine_05->GetRelativeLocation()) * MeshToCamera;
-	MeshToCamera = FTransform(Neck_01->GetRelativeRotation(), Neck_01->GetRelativeLocation()) * MeshToCamera;
-	MeshToCamera = FTransform(Camera->GetRelativeRotation(), Camera->GetRelativeLocation()) * MeshToCamera;
+	// Camera-to-mesh at zero pitch (used to cancel camera offset for arms)
+	const FTransform MeshToCamera = CalculateCameraRelativeTransform(0.0f);
+	Camera->SetRelativeTransform(MeshToCamera);
 
 	FVector CameraOffsetInMeshSpace = MeshToCamera.GetLocation();
 	FVector ArmsLocation = MeshToCamera.GetRotation().Inverse().RotateVector(-CameraOffsetInMeshSpace);
@@ -271,27 +268,125 @@ void AFPSCharacter::BeginPlay()
 			OnHealthComponentHealthChanged(HealthComp->Health);
 		}
 	}
+
+	// ============================================
+	// REMOTE POSE SHARING + PROXY SIGNIFICANCE
+	// ============================================
+	DefaultBodyAnimTickOption = GetMesh()->VisibilityBasedAnimTickOption;
+	DefaultArmsAnimTickOption = Arms->VisibilityBasedAnimTickOption;
+	DefaultLegsAnimTickOption = Legs->VisibilityBasedAnimTickOption;
+
+	// Body + Arms + Legs evaluate until UpdateOwnerOnlyMeshes decides otherwise
+	INC_DWORD_STAT_BY(STAT_FPSCore_EvaluatedCharacterMeshes, 3);
+	UpdateOwnerOnlyMeshes();
+
+	// Subsystem scales only simulated proxies, own pawn stays Full
+	if (UFPSCharacterSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UFPSCharacterSignificanceSubsystem>())
+	{
+		Significance->RegisterCharacter(this);
+	}
 }
 
 void AFPSCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	if (UFPSCharacterSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UFPSCharacterSignificanceSubsystem>())
+	{
+		Significance->UnregisterCharacter(this);
+	}
+
+	DEC_DWORD_STAT_BY(STAT_FPSCore_EvaluatedCharacterMeshes, bOwnerOnlyMeshesFollowBody ? 1 : 3);
+
 	Super::EndPlay(EndPlayReason);
 }
 
+void AFPSCharacter::NotifyControllerChanged()
+{
+	Super::NotifyControllerChanged();
+
+	// Server: PossessedBy / UnPossessed, clients: OnRep_Controller
+	if (HasActorBegunPlay())
+	{
+		UpdateOwnerOnlyMeshes();
+	}
+}
+
+void AFPSCharacter::UpdateOwnerOnlyMeshes()
+{
+	// Arms / Legs are OnlyOwnerSee - machines that don't control this character never render them
+	const bool bFollowBody = bShareRemotePose && !IsLocallyControlled();
+	if (bFollowBody == bOwnerOnlyMeshesFollowBody)
+	{
+		return;
+	}
+
+	bOwnerOnlyMeshesFollowBody = bFollowBody;
+
+	const EVisibilityBasedAnimTickOption HiddenTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+
+	// Legs: same skeleton as Body - copy its evaluated pose, own anim instance idles
+	// (GetLegsMesh returns nullptr meanwhile, so montages are played once on Body)
+	Legs->SetLeaderPoseComponent(bFollowBody ? GetMesh() : nullptr);
+	Legs->VisibilityBasedAnimTickOption = bFollowBody ? HiddenTickOption : DefaultLegsAnimTickOption;
+
+	// Arms: own skeleton, can't follow Body - skip pose evaluation, montages still advance
+	// (weapon FPSMesh stays attached to Arms sockets, end delegates / notifies still fire)
+	Arms->VisibilityBasedAnimTickOption = bFollowBody ? HiddenTickOption : DefaultArmsAnimTickOption;
+
+	if (bFollowBody)
+	{
+		DEC_DWORD_STAT_BY(STAT_FPSCore_EvaluatedCharacterMeshes, 2);
+	}
+	else
+	{
+		INC_DWORD_STAT_BY(STAT_FPSCore_EvaluatedCharacterMeshes, 2);
+	}
+}
+
+void AFPSCharacter::ApplyProxyDetail(EFPSProxyDetail Detail)
+{
+	// Body anim update rate + actor tick rate per detail level
+	// (Arms / Legs already skip evaluation on proxies - see UpdateOwnerOnlyMeshes)
+	float TickInterval = 0.0f;
+	switch (Detail)
+	{
+	case EFPSProxyDetail::Reduced:
+		TickInterval = 1.0f / 30.0f;
+		break;
+	case EFPSProxyDetail::Minimal:
+		TickInterval = 1.0f / 10.0f;
+		break;
+	default:
+		break;
+	}
+
+	const bool bFull = Detail == EFPSProxyDetail::Full;
+
+	// Off-screen below Full: montages keep advancing (notifies), pose + bones skipped
+	const EVisibilityBasedAnimTickOption ReducedTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+
+	// Body - the only mesh other players see
+	GetMesh()->SetComponentTickInterval(TickInterval);
+	GetMesh()->VisibilityBasedAnimTickOption = bFull ? DefaultBodyAnimTickOption : ReducedTickOption;
+
+	SetActorTickInterval(TickInterval);
+}
+
 void AFPSCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
 	DOREPLIFETIME_CONDITION(AFPSCharacter, Pitch, COND_SkipOwner);
-	DOREPLIFETIME(AFPSCharacter, ActiveItem);
-	// NOTE: PendingEquipItem and UnequippingItem are LOCAL (not replicated)
-	// Weapon switch visual state is delivered via Multicast_WeaponSwitch (atomic)
-	DOREPLIFETIME(AFPSCharacter, CurrentMovementMode);
-	DOREPLIFETIME(AFPSCharacter, bIsAiming);
+	// NOTE: ActiveItem, PendingEquipItem and UnequippingItem are LOCAL (applied from WeaponSwitchState)
+	DOREPLIFETIME(AFPSCharacter, WeaponSwitchState);
+	// Owner predicts both in its own saved moves
+	DOREPLIFETIME_CONDITION(AFPSCharacter, CurrentMovementMode, COND_SkipOwner);
+	DOREPLIFETIME_CONDITION(AFPSCharacter, bIsAiming, COND_SkipOwner);
 }
 
 void AFPSCharacter::Tick(float DeltaTime)
 {
+	FPSCORE_SCOPE_CYCLE(STAT_FPSCore_CharacterTick);
+
 	Super::Tick(DeltaTime);
 
 	DeltaSeconds = DeltaTime;
@@ -299,24 +394,13 @@ void AFPSCharacter::Tick(float DeltaTime)
 	// ============================================
 	// SPRINT INTENT ACTIVATION (LOCAL ONLY)
 	// ============================================
-	// Automatically activate/deactivate Sprint mode based on sprint intent + movement direction
+	// Raise/clear movement sprint intent based on sprint key + movement direction
+	// Mode + speed are resolved in the next predicted move (UFPSCharacterMovementComponent)
 	if (IsLocallyControlled())
 	{
-		if (bSprintIntentActive)
-		{
-			float SprintMultiplier = GetSprintDirectionMultiplier(CurrentMovementVector);
+		FPSCORE_SCOPE_CYCLE(STAT_FPSCore_SprintIntent);
 
-			if (SprintMultiplier > 0.0f && CurrentMovementMode != EFPSMovementMode::Sprint)
-			{
-				UpdateMovementSpeed(EFPSMovementMode::Sprint);
-				Server_SetMovementMode(EFPSMovementMode::Sprint);
-			}
-			else if (SprintMultiplier <= 0.0f && CurrentMovementMode == EFPSMovementMode::Sprint)
-			{
-				UpdateMovementSpeed(EFPSMovementMode::Jog);
-				Server_SetMovementMode(EFPSMovementMode::Jog);
-			}
-		}
+		CMC->bWantsToSprint = bSprintIntentActive && GetSprintDirectionMultiplier(CurrentMovementVector) > 0.0f;
 	}
 
 	// Check for interactable objects (only for locally controlled player)
@@ -325,49 +409,29 @@ void AFPSCharacter::Tick(float DeltaTime)
 		CheckInteractionTrace();
 
 		// Update aiming state (responds to item state changes like reload ending)
-		UpdateAimingState();
+		{
+			FPSCORE_SCOPE_CYCLE(STAT_FPSCore_AimingState);
+			UpdateAimingState();
+		}
 
 		InterpolatedArmsOffset = CalculateInterpolatedArmsOffset(DeltaTime);
-		LeanVector = CalculateLeanVector(DeltaTime);
-		FVector BreathingVector = CalculateBreathing(DeltaTime);
-
-		// Combine aiming offset + weapon lean/sway + breathing
-		// LeanVector.X = Forward/back offset (cm)
-		// LeanVector.Y = Lateral left/right offset (cm)
-		// LeanVector.Z = Vertical up/down offset (cm)
-		// BreathingVector = Idle breathing offset (XYZ)
-		FVector FinalArmsOffset = InterpolatedArmsOffset;
-		FinalArmsOffset.X += LeanVector.X + BreathingVector.X;
-		FinalArmsOffset.Y += LeanVector.Y + BreathingVector.Y;
-		FinalArmsOffset.Z += LeanVector.Z + BreathingVector.Z;
-
-		Arms->SetRelativeLocation(FinalArmsOffset);
 
 		// ============================================
-		// BREATHING & LEANING CAMERA OFFSET (ADS ONLY)
+		// PROCEDURAL ARMS & CAMERA SWAY
 		// ============================================
-		// Apply breathing rotation + leaning position to camera when aiming
-		// This creates realistic aim wobble and weapon sway during ADS
-		if (bIsAiming && Camera)
+		// Lean/bob/mouse lag/breathing evaluated in Arms anim instance (worker thread)
 		{
-			BreathingRotation = CalculateBreathingRotation(BreathingVector);
-			Camera->SetRelativeRotation(BreathingRotation);
-			Camera->SetRelativeLocation(BaseCameraLocation + LeanVector);
-		}
-		else
-		{
-			if (Camera && (!BreathingRotation.IsZero() || Camera->GetRelativeLocation() != BaseCameraLocation))
-			{
-				BreathingRotation = FRotator::ZeroRotator;
-				Camera->SetRelativeRotation(BreathingRotation);
-				Camera->SetRelativeLocation(BaseCameraLocation);
-			}
+			FPSCORE_SCOPE_CYCLE(STAT_FPSCore_ProceduralArms);
+			UpdateProceduralArms(DeltaTime);
 		}
 
 		// ============================================
 		// UPDATE LEANING VISUAL FEEDBACK
 		// ============================================
-		UpdateLeaningVisualFeedback(BreathingVector);
+		{
+			FPSCORE_SCOPE_CYCLE(STAT_FPSCore_LeaningFeedback);
+			UpdateLeaningVisualFeedback(BreathingVector);
+		}
 	}
 }
 
@@ -485,6 +549,8 @@ void AFPSCharacter::UnPossessed()
 
 void AFPSCharacter::Client_OnPossessed_Implementation()
 {
+	FPSCORE_SCOPE_RPC(AFPSCharacter_Client_OnPossessed);
+
 	if (!IsLocallyControlled())
 	{
 		return;
@@ -526,7 +592,7 @@ void AFPSCharacter::UpdatePitch(float Y)
 	NewLocalPitch = FMath::ClampAngle(NewLocalPitch, -45.0f, 45.0f);
 	LocalPitchAccumulator = NewLocalPitch;
 
-	UpdateSpineRotations();
+	UpdateCameraTransform();
 
 	// Calculate network pitch from actual camera direction (inverse calculation)
 	// This ensures ViewPointProvider returns the same direction as local camera
@@ -541,6 +607,8 @@ void AFPSCharacter::UpdatePitch(float Y)
 
 void AFPSCharacter::Server_UpdatePitch_Implementation(float NewPitch)
 {
+	FPSCORE_SCOPE_RPC(AFPSCharacter_Server_UpdatePitch);
+
 	// ✅ FIX: Store ACTUAL camera pitch from client (no artificial clamp to input range)
 	// Client sends calculated pitch from CalculateNetworkPitchFromCamera()
 	// which includes spine chain amplification (can exceed ±45° input range)
@@ -551,27 +619,38 @@ void AFPSCharacter::Server_UpdatePitch_Implementation(float NewPitch)
 	// Anti-cheat: Clamp to realistic camera pitch range (±90°), not input range (±45°)
 	Pitch = FMath::Clamp(NewPitch, -90.0f, 90.0f);
 
-	// ✅ FIX: Apply inverse compensation for server's spine rotations
+	// ✅ FIX: Apply inverse compensation for server's spine pitch
 	// Same logic as OnRep_Pitch() for remote clients
 	//
 	// Background:
 	// - LocalPitchAccumulator is input-driven pitch (±45°) for spine animations
 	// - Pitch is ACTUAL camera pitch (post-amplification, can be >45°) for shooting
-	// - Spine chain amplifies: spine_03(40%) + spine_04(50%) + spine_05(60%) + neck_01(20%) ≈ 170%
-	// - Inverse: camera_pitch / 1.7 ≈ LocalPitchAccumulator
-	const float ProxyAimOffsetCompensation = 0.588f; // 1 / 1.7 ≈ 0.588
-	LocalPitchAccumulator = Pitch * ProxyAimOffsetCompensation;
-	LocalPitchAccumulator = FMath::Clamp(LocalPitchAccumulator, -45.0f, 45.0f);
+	// - Spine bend is applied in the anim graph (UFPSCharacterAnimInstance), no components to update
+	LocalPitchAccumulator = FFPSSpineAimOffset::SpinePitchFromViewPitch(Pitch);
+}
+
+FTransform AFPSCharacter::CalculateCameraRelativeTransform(float SpinePitch) const
+{
+	// Same kinematics as the former spine_03 → spine_04 → spine_05 → neck_01 → camera
+	// scene component chain, evaluated as a single transform (child * parent)
+	const FFPSSpineAimOffset AimOffset = FFPSSpineAimOffset::FromSpinePitch(SpinePitch);
 
-	UpdateSpineRotations();
+	FTransform Result(FRotator::ZeroRotator, BaseCameraLocation);
+	Result = Result * FTransform(FRotator(AimOffset.Neck01, 0.0f, 0.0f), SpineChainNeck01Offset);
+	Result = Result * FTransform(FRotator(AimOffset.Spine05, 0.0f, 0.0f), SpineChainSpine05Offset);
+	Result = Result * FTransform(FRotator(AimOffset.Spine04, 0.0f, 0.0f), SpineChainSpine04Offset);
+	Result = Result * FTransform(FRotator(AimOffset.Spine03, 90.0f, 0.0f), OriginalSpineLocation + SpineCrouchOffset);
+
+	return Result;
 }
 
-void AFPSCharacter::UpdateSpineRotations()
+void AFPSCharacter::UpdateCameraTransform()
 {
-	Spine_03->SetRelativeRotation(FRotator(LocalPitchAccumulator * 0.4f, 90.0f, 0.0f));
-	Spine_04->SetRelativeRotation(FRotator(LocalPitchAccumulator * 0.5f, 0.0f, 0.0f));
-	Spine_05->SetRelativeRotation(FRotator(LocalPitchAccumulator * 0.6f, 0.0f, 0.0f));
-	Neck_01->SetRelativeRotation(FRotator(LocalPitchAccumulator * 0.2f, 0.0f, 0.0f));
+	// LOCAL ONLY - single relative transform update (server/proxies never move the camera)
+	if (Camera)
+	{
+		Camera->SetRelativeTransform(CalculateCameraRelativeTransform(LocalPitchAccumulator));
+	}
 }
 
 float AFPSCharacter::CalculateNetworkPitchFromCamera() const
@@ -866,14 +945,12 @@ void AFPSCharacter::MoveCanceled(const FInputActionValue& Value)
 
 void AFPSCharacter::WalkPressed()
 {
-	UpdateMovementSpeed(EFPSMovementMode::Walk);
-	Server_SetMovementMode(EFPSMovementMode::Walk);
+	CMC->bWantsToWalk = true;
 }
 
 void AFPSCharacter::WalkReleased()
 {
-	UpdateMovementSpeed(EFPSMovementMode::Jog);
-	Server_SetMovementMode(EFPSMovementMode::Jog);
+	CMC->bWantsToWalk = false;
 }
 
 void AFPSCharacter::SprintPressed()
@@ -885,12 +962,7 @@ void AFPSCharacter::SprintPressed()
 void AFPSCharacter::SprintReleased()
 {
 	bSprintIntentActive = false;
-
-	if (CurrentMovementMode == EFPSMovementMode::Sprint)
-	{
-		UpdateMovementSpeed(EFPSMovementMode::Jog);
-		Server_SetMovementMode(EFPSMovementMode::Jog);
-	}
+	CMC->bWantsToSprint = false;
 }
 
 void AFPSCharacter::CrouchPressed()
@@ -901,27 +973,26 @@ void AFPSCharacter::CrouchPressed()
 		return;
 	}
 
-	UpdateMovementSpeed(EFPSMovementMode::Crouch);
-	Server_SetMovementMode(EFPSMovementMode::Crouch);
+	// Crouch mode resolved from bWantsToCrouch in the predicted move
 	Crouch();
 
 	// Apply crouch camera offset (LOCAL ONLY - owning client)
 	if (IsLocallyControlled())
 	{
-		Spine_03->SetRelativeLocation(OriginalSpineLocation + FVector(0.0f, 10.0f, -50.0f));
+		SpineCrouchOffset = FVector(0.0f, 10.0f, -50.0f);
+		UpdateCameraTransform();
 	}
 }
 
 void AFPSCharacter::CrouchReleased()
 {
-	UpdateMovementSpeed(EFPSMovementMode::Jog);
-	Server_SetMovementMode(EFPSMovementMode::Jog);
 	UnCrouch();
 
 	// Restore original spine location (LOCAL ONLY - owning client)
 	if (IsLocallyControlled())
 	{
-		Spine_03->SetRelativeLocation(OriginalSpineLocation);
+		SpineCrouchOffset = FVector::ZeroVector;
+		UpdateCameraTransform();
 	}
 }
 
@@ -1125,7 +1196,8 @@ void AFPSCharacter::UpdateAimingState()
 
 		// Calculate arms offset for aiming
 		// Goal: Align AimTransform location with camera center (0,0,0) in camera space
-		FVector CurrentArmsOffset = Arms->GetRelativeLocation();
+		// Use last evaluated procedural offset (matches current Arms pose; component may not move)
+		FVector CurrentArmsOffset = GetProceduralArmsState().FinalArmsOffset;
 
 		// Transform aim point from world space to camera local space
 		FVector AimingPointInCameraSpace = Camera->GetComponentTransform().InverseTransformPosition(AimTransform.GetLocation());
@@ -1146,8 +1218,8 @@ void AFPSCharacter::UpdateAimingState()
 		// Set local state immediately for responsive feel
 		bIsAiming = true;
 
-		// Notify server to replicate to other clients
-		Server_SetAiming(true);
+		// Server picks it up from the next saved move, replicates to other clients
+		CMC->bWantsToAim = true;
 	}
 	else
 	{
@@ -1175,8 +1247,8 @@ void AFPSCharacter::UpdateAimingState()
 		bIsAiming = false;
 		bAimingCrosshairSet = false;
 
-		// Notify server to replicate to other clients
-		Server_SetAiming(false);
+		// Server picks it up from the next saved move, replicates to other clients
+		CMC->bWantsToAim = false;
 	}
 }
 
@@ -1248,16 +1320,19 @@ bool AFPSCharacter::IsActivelyMoving() const
 	return bHasVelocity && bHasAcceleration;
 }
 
-void AFPSCharacter::Server_SetMovementMode_Implementation(EFPSMovementMode NewMode)
+void AFPSCharacter::ApplyPredictedMovementState(EFPSMovementMode NewMode, bool bNewAiming)
 {
-	UpdateMovementSpeed(NewMode);
-}
+	if (NewMode != CurrentMovementMode)
+	{
+		UpdateMovementSpeed(NewMode);
+	}
 
-void AFPSCharacter::Server_SetAiming_Implementation(bool bNewAiming)
-{
-	// SERVER ONLY - set authoritative aiming state
-	// This will replicate to all clients via bIsAiming REPLICATED property
-	bIsAiming = bNewAiming;
+	// SERVER ONLY for remote players - owner already set bIsAiming in UpdateAimingState
+	// Replicates to simulated proxies via bIsAiming (COND_SkipOwner)
+	if (HasAuthority() && !IsLocallyControlled())
+	{
+		bIsAiming = bNewAiming;
+	}
 }
 
 void AFPSCharacter::UpdateMovementSpeed(EFPSMovementMode NewMode)
@@ -1287,86 +1362,205 @@ void AFPSCharacter::UpdateMovementSpeed(EFPSMovementMode NewMode)
 
 void AFPSCharacter::OnRep_Pitch()
 {
-	// Only update spine rotations for remote clients (not locally controlled)
-	// Locally controlled client already updates spine via UpdatePitch()
+	FPSCORE_SCOPE_ONREP(AFPSCharacter_OnRep_Pitch);
+
+	// Only update spine pitch for remote clients (not locally controlled)
+	// Locally controlled client already updates it via UpdatePitch()
 	if (!IsLocallyControlled())
 	{
 		// PROXY AIMOFFSET COMPENSATION:
-		// Replicated Pitch is now ACTUAL camera pitch (after spine chain amplification)
+		// Replicated Pitch is ACTUAL camera pitch (after spine chain amplification)
 		// But AimOffset in AnimBP needs the original input-driven pitch range (±45°)
-		// Apply inverse compensation to approximate LocalPitchAccumulator from camera pitch
-		//
-		// Spine chain calculation: spine_03(40%) + spine_04(50%) + spine_05(60%) + neck_01(20%)
-		// These are RELATIVE rotations, so they accumulate: ~170% amplification (empirical)
-		// Inverse: camera_pitch / 1.7 ≈ LocalPitchAccumulator
-		//
-		// NOTE: Tune this multiplier empirically by comparing local vs proxy AimOffset max range
-		// Goal: Proxy reaches max AimOffset (6) at same visual angle as local client
-		const float ProxyAimOffsetCompensation = 0.588f; // 1 / 1.7 ≈ 0.588
+		// Spine/neck bone bend is evaluated by UFPSCharacterAnimInstance from this value
+		LocalPitchAccumulator = FFPSSpineAimOffset::SpinePitchFromViewPitch(Pitch);
+	}
+}
+
+void AFPSCharacter::OnRep_WeaponSwitchState()
+{
+	FPSCORE_SCOPE_ONREP(AFPSCharacter_OnRep_WeaponSwitchState);
+
+	// Server already applied in SetWeaponSwitchState
+	if (GetNetMode() != NM_Client) return;
+
+	ApplyWeaponSwitchState();
+}
+
+// ============================================
+// WEAPON SWITCH STATE MACHINE
+// ============================================
 
-		LocalPitchAccumulator = Pitch * ProxyAimOffsetCompensation;
-		LocalPitchAccumulator = FMath::Clamp(LocalPitchAccumulator, -45.0f, 45.0f);
+void AFPSCharacter::SetWeaponSwitchState(AActor* NewActiveItem, AActor* NewPendingItem, EFPSWeaponSwitchPhase NewPhase)
+{
+	if (!HasAuthority()) return;
 
-		UpdateSpineRotations();
+	const AGameStateBase* GameState = GetWorld()->GetGameState();
+
+	WeaponSwitchState.ActiveItem = NewActiveItem;
+	WeaponSwitchState.PendingItem = NewPendingItem;
+	WeaponSwitchState.Phase = NewPhase;
+	WeaponSwitchState.StartTime = GameState ? static_cast<float>(GameState->GetServerWorldTimeSeconds()) : GetWorld()->GetTimeSeconds();
+
+	// Montage end normally advances Unequipping - timer guarantees the switch cannot stall
+	// (armed before applying: a synchronous completion clears it again)
+	GetWorldTimerManager().ClearTimer(UnequipTimeoutHandle);
+	if (NewPhase == EFPSWeaponSwitchPhase::Unequipping)
+	{
+		UAnimMontage* UnequipMontage = (NewActiveItem && NewActiveItem->Implements<UHoldableInterface>())
+			? IHoldableInterface::Execute_GetUnequipMontage(NewActiveItem)
+			: nullptr;
+		const float Timeout = (UnequipMontage ? UnequipMontage->GetPlayLength() : 0.0f) + UnequipTimeoutGrace;
+		GetWorldTimerManager().SetTimer(UnequipTimeoutHandle, this, &AFPSCharacter::OnUnequipTimeout, Timeout, false);
 	}
+
+	ApplyWeaponSwitchState();
 }
 
-void AFPSCharacter::OnRep_ActiveItem(AActor* OldActiveItem)
+void AFPSCharacter::OnUnequipTimeout()
 {
-	if (GetNetMode() != NM_Client) return;
+	if (!HasAuthority() || WeaponSwitchState.Phase != EFPSWeaponSwitchPhase::Unequipping) return;
 
-	// CASE 1: New item equipped
-	if (ActiveItem && ActiveItem != OldActiveItem)
+	if (UnequippingItem)
+	{
+		OnUnequipMontageFinished_Implementation();
+	}
+	else
+	{
+		SetWeaponSwitchState(WeaponSwitchState.PendingItem, nullptr, EFPSWeaponSwitchPhase::Equipped);
+	}
+}
+
+float AFPSCharacter::GetWeaponSwitchElapsed() const
+{
+	const AGameStateBase* GameState = GetWorld() ? GetWorld()->GetGameState() : nullptr;
+	if (!GameState) return 0.0f;
+
+	return FMath::Max(0.0f, static_cast<float>(GameState->GetServerWorldTimeSeconds()) - WeaponSwitchState.StartTime);
+}
+
+void AFPSCharacter::ApplyWeaponSwitchState()
+{
+	AActor* TargetItem = WeaponSwitchState.ActiveItem;
+	const float Elapsed = GetWeaponSwitchElapsed();
+
+	// ============================================
+	// UNEQUIPPING: holster ActiveItem, PendingItem next
+	// ============================================
+	if (WeaponSwitchState.Phase == EFPSWeaponSwitchPhase::Unequipping)
 	{
-		if (OldActiveItem && OldActiveItem->Implements<UHoldableInterface>())
+		AActor* NewItem = WeaponSwitchState.PendingItem;
+
+		// Already running this transition (server applied, or duplicate OnRep)
+		if (UnequippingItem == TargetItem && PendingEquipItem == NewItem)
 		{
-			IHoldableInterface::Execute_SetUnequippingState(OldActiveItem, false);
+			return;
 		}
 
-		if (OldActiveItem)
+		// Missed the equip of the item being holstered (late join) - put it in hands instantly
+		if (TargetItem && ActiveItem != TargetItem)
 		{
-			HolsterItem(OldActiveItem);
-		}
+			if (ActiveItem)
+			{
+				HolsterItem(ActiveItem);
+			}
 
-		EquipItem(ActiveItem);
+			ActiveItem = TargetItem;
+			EquipItem(TargetItem, MAX_flt);
+		}
 
-		PendingEquipItem = nullptr;
-		UnequippingItem = nullptr;
-		return;
-	}
+		PendingEquipItem = NewItem;
+		UnequippingItem = TargetItem;
 
-	// CASE 2: Item dropped
-	if (!ActiveItem && OldActiveItem)
-	{
-		if (OldActiveItem->Implements<UHoldableInterface>())
+		if (NewItem && NewItem->Implements<UHoldableInterface>())
 		{
-			IHoldableInterface::Execute_SetEquippingState(OldActiveItem, false);
-			IHoldableInterface::Execute_SetUnequippingState(OldActiveItem, false);
+			IHoldableInterface::Execute_SetEquippingState(NewItem, true);
 		}
 
-		UpdateItemAnimLayer(nullptr);
+		if (TargetItem && TargetItem->Implements<UHoldableInterface>())
+		{
+			IHoldableInterface::Execute_SetUnequippingState(TargetItem, true);
 
-		PendingEquipItem = nullptr;
-		UnequippingItem = nullptr;
+			UAnimMontage* UnequipMontage = IHoldableInterface::Execute_GetUnequipMontage(TargetItem);
+			const bool bPlayMontage = UnequipMontage && Elapsed < UnequipMontage->GetPlayLength();
 
-		if (IsLocallyControlled())
-		{
-			SetupArmsLocation(nullptr);
+			if (bPlayMontage)
+			{
+				PlayEquipMontage(UnequipMontage, true, Elapsed);
+			}
+
+			IHoldableInterface::Execute_OnUnequipped(TargetItem);
 
-			if (Controller && Controller->Implements<UPlayerHUDInterface>())
+			// Montage already over on the server - finish holster locally now
+			if (!bPlayMontage && !HasAuthority())
 			{
-				IPlayerHUDInterface::Execute_SetCrossHair(Controller, DefaultCrossHair, nullptr);
-				IPlayerHUDInterface::Execute_UpdateActiveItem(Controller, nullptr);
+				OnUnequipMontageFinished_Implementation();
 			}
+		}
+		return;
+	}
 
-			HipLeaningScale = 1.0f;
-			HipBreathingScale = 1.0f;
+	// ============================================
+	// EQUIPPED: TargetItem in hands (or empty hands)
+	// ============================================
+
+	// Unequip notify hasn't fired locally yet (montage behind server) - complete it now
+	// (same side effects as the notify; TargetItem is what gets equipped next)
+	if (UnequippingItem && UnequippingItem != TargetItem)
+	{
+		ActiveItem = TargetItem;
+		PendingEquipItem = TargetItem;
+		FinishUnequip();
+	}
+
+	if (TargetItem && TargetItem == ActiveItem && PendingEquipItem == nullptr)
+	{
+		return;
+	}
+
+	AActor* OldActiveItem = ActiveItem;
+	ActiveItem = TargetItem;
+	PendingEquipItem = nullptr;
+
+	// Immediate switch (no unequip montage)
+	if (TargetItem && OldActiveItem && OldActiveItem != TargetItem)
+	{
+		HolsterItem(OldActiveItem);
+	}
+
+	if (TargetItem)
+	{
+		EquipItem(TargetItem, Elapsed);
+		return;
+	}
+
+	// Empty hands (item dropped)
+	if (OldActiveItem && OldActiveItem->Implements<UHoldableInterface>())
+	{
+		IHoldableInterface::Execute_SetEquippingState(OldActiveItem, false);
+		IHoldableInterface::Execute_SetUnequippingState(OldActiveItem, false);
+	}
+
+	UpdateItemAnimLayer(nullptr);
+
+	if (IsLocallyControlled())
+	{
+		SetupArmsLocation(nullptr);
+
+		if (Controller && Controller->Implements<UPlayerHUDInterface>())
+		{
+			IPlayerHUDInterface::Execute_SetCrossHair(Controller, DefaultCrossHair, nullptr);
+			IPlayerHUDInterface::Execute_UpdateActiveItem(Controller, nullptr);
 		}
+
+		HipLeaningScale = 1.0f;
+		HipBreathingScale = 1.0f;
 	}
 }
 
 void AFPSCharacter::OnRep_CurrentMovementMode()
 {
+	FPSCORE_SCOPE_ONREP(AFPSCharacter_OnRep_CurrentMovementMode);
+
 	UpdateMovementSpeed(CurrentMovementMode);
 }
 
@@ -1389,6 +1583,8 @@ float AFPSCharacter::GetSprintDirectionMultiplier(const FVector2D& MovementInput
 
 void AFPSCharacter::CheckInteractionTrace()
 {
+	FPSCORE_SCOPE_CYCLE(STAT_FPSCore_InteractionTrace);
+
 	if (!Camera)
 	{
 		return;
@@ -1464,6 +1660,8 @@ void AFPSCharacter::CheckInteractionTrace()
 
 void AFPSCharacter::Server_PickupItem_Implementation(AActor* Item)
 {
+	FPSCORE_SCOPE_RPC(AFPSCharacter_Server_PickupItem);
+
 	// SERVER VALIDATION (anti-cheat, race conditions)
 	// Client already validated before sending RPC, but server MUST re-validate
 	// to prevent cheating and handle race conditions
@@ -1480,6 +1678,8 @@ void AFPSCharacter::Server_PickupItem_Implementation(AActor* Item)
 
 void AFPSCharacter::Server_DropItem_Implementation(AActor* Item)
 {
+	FPSCORE_SCOPE_RPC(AFPSCharacter_Server_DropItem);
+
 	if (!Item || !HasAuthority()) return;
 	if (!InventoryComp->ContainsItem(Item)) return;
 
@@ -1497,6 +1697,8 @@ void AFPSCharacter::Server_DropItem_Implementation(AActor* Item)
 
 void AFPSCharacter::Server_SelectItem_Implementation(int32 Index)
 {
+	FPSCORE_SCOPE_RPC(AFPSCharacter_Server_SelectItem);
+
 	if (!HasAuthority()) return;
 
 	AActor* NewItem = InventoryComp->GetItemAtIndex(Index);
@@ -1513,6 +1715,9 @@ void AFPSCharacter::Server_SelectItem_Implementation(int32 Index)
 		}
 	}
 
+	// Switch already in progress - wait for it to finish (UnequipTimeoutHandle bounds the wait)
+	if (WeaponSwitchState.Phase != EFPSWeaponSwitchPhase::Equipped) return;
+
 	AActor* OldActiveItem = ActiveItem;
 
 	// Check if old item has unequip montage
@@ -1522,27 +1727,15 @@ void AFPSCharacter::Server_SelectItem_Implementation(int32 Index)
 		UnequipMontage = IHoldableInterface::Execute_GetUnequipMontage(OldActiveItem);
 	}
 
-	if (OldActiveItem && NewItem && UnequipMontage)
+	if (OldActiveItem && UnequipMontage)
 	{
-		// Weapon switch with unequip montage
-		PendingEquipItem = NewItem;
-		UnequippingItem = OldActiveItem;
-		Multicast_WeaponSwitch(OldActiveItem, NewItem);
+		// Weapon switch with unequip montage - NewItem equipped when it finishes
+		SetWeaponSwitchState(OldActiveItem, NewItem, EFPSWeaponSwitchPhase::Unequipping);
 	}
 	else
 	{
 		// Immediate switch (no montage)
-		ActiveItem = NewItem;
-
-		if (OldActiveItem)
-		{
-			HolsterItem(OldActiveItem);
-		}
-
-		if (ActiveItem)
-		{
-			EquipItem(ActiveItem);
-		}
+		SetWeaponSwitchState(NewItem, nullptr, EFPSWeaponSwitchPhase::Equipped);
 	}
 }
 
@@ -1667,12 +1860,8 @@ void AFPSCharacter::UnEquipItem(AActor* Item)
 	// ============================================
 	// UnEquipItem - LEGACY / IMMEDIATE UNEQUIP
 	// ============================================
-	// NOTE: For weapon switch with montage, use Multicast_WeaponSwitch instead.
+	// NOTE: For weapon switch, use SetWeaponSwitchState instead.
 	// This function is kept for immediate unequip (no montage) scenarios.
-	//
-	// In HYBRID architecture:
-	// - Weapon switch with montage: Multicast_WeaponSwitch handles everything
-	// - Immediate switch: Server_SelectItem calls this directly
 
 	if (!IsValid(Item)) return;
 	if (!Item->Implements<UHoldableInterface>()) return;
@@ -1682,7 +1871,7 @@ void AFPSCharacter::UnEquipItem(AActor* Item)
 	if (UnequipMontage)
 	{
 		// NOTE: This path shouldn't be used in new architecture
-		// Multicast_WeaponSwitch handles montage-based weapon switch
+		// ApplyWeaponSwitchState handles montage-based weapon switch
 		UnequippingItem = Item;
 		IHoldableInterface::Execute_SetUnequippingState(Item, true);
 		PlayEquipMontage(UnequipMontage, true);
@@ -1737,6 +1926,19 @@ void AFPSCharacter::HolsterItem(AActor* Item)
 }
 
 void AFPSCharacter::OnUnequipMontageFinished_Implementation()
+{
+	if (!UnequippingItem) return;
+
+	FinishUnequip();
+
+	// Server: advance state machine → Equipped(PendingItem)
+	if (HasAuthority() && WeaponSwitchState.Phase == EFPSWeaponSwitchPhase::Unequipping)
+	{
+		SetWeaponSwitchState(WeaponSwitchState.PendingItem, nullptr, EFPSWeaponSwitchPhase::Equipped);
+	}
+}
+
+void AFPSCharacter::FinishUnequip()
 {
 	AActor* OldUnequippingItem = UnequippingItem;
 	if (!OldUnequippingItem) return;
@@ -1754,19 +1956,16 @@ void AFPSCharacter::OnUnequipMontageFinished_Implementation()
 	if (PendingEquipItem)
 	{
 		UpdateItemAnimLayer(PendingEquipItem);
-	}
 
-	// Server: set ActiveItem and equip
-	if (HasAuthority() && PendingEquipItem)
-	{
-		AActor* ItemToEquip = PendingEquipItem;
-		ActiveItem = ItemToEquip;
-		PendingEquipItem = nullptr;
-		EquipItem(ItemToEquip);
+		// Hands empty until Equipped phase is applied (server: OnUnequipMontageFinished, clients: OnRep)
+		if (ActiveItem == OldUnequippingItem)
+		{
+			ActiveItem = nullptr;
+		}
 	}
 }
 
-void AFPSCharacter::PlayEquipMontage(UAnimMontage* Montage, bool bBindEndDelegate)
+void AFPSCharacter::PlayEquipMontage(UAnimMontage* Montage, bool bBindEndDelegate, float StartPosition)
 {
 	if (!Montage) return;
 
@@ -1774,7 +1973,7 @@ void AFPSCharacter::PlayEquipMontage(UAnimMontage* Montage, bool bBindEndDelegat
 	if (GetMesh() && GetMesh()->GetAnimInstance())
 	{
 		UAnimInstance* BodyAnimInstance = GetMesh()->GetAnimInstance();
-		BodyAnimInstance->Montage_Play(Montage);
+		BodyAnimInstance->Montage_Play(Montage, 1.0f, EMontagePlayReturnType::MontageLength, StartPosition);
 
 		if (bBindEndDelegate)
 		{
@@ -1792,13 +1991,13 @@ void AFPSCharacter::PlayEquipMontage(UAnimMontage* Montage, bool bBindEndDelegat
 	// Play on Arms mesh
 	if (Arms && Arms->GetAnimInstance())
 	{
-		Arms->GetAnimInstance()->Montage_Play(Montage);
+		Arms->GetAnimInstance()->Montage_Play(Montage, 1.0f, EMontagePlayReturnType::MontageLength, StartPosition);
 	}
 
 	// Play on Legs mesh
 	if (Legs && Legs->GetAnimInstance())
 	{
-		Legs->GetAnimInstance()->Montage_Play(Montage);
+		Legs->GetAnimInstance()->Montage_Play(Montage, 1.0f, EMontagePlayReturnType::MontageLength, StartPosition);
 	}
 }
 
@@ -1836,7 +2035,7 @@ void AFPSCharacter::OnUnequipMontageBlendingOut(UAnimMontage* Montage, bool bInt
 	}
 }
 
-void AFPSCharacter::EquipItem(AActor* Item)
+void AFPSCharacter::EquipItem(AActor* Item, float MontagePosition)
 {
 	if (!IsValid(Item)) return;
 	if (!Item->Implements<UHoldableInterface>()) return;
@@ -1850,6 +2049,12 @@ void AFPSCharacter::EquipItem(AActor* Item)
 		}
 	}
 
+	// Reports cold equips (pickup preload not finished)
+	if (UFPSAssetPreloadSubsystem* Preload = GetWorld() ? GetWorld()->GetSubsystem<UFPSAssetPreloadSubsystem>() : nullptr)
+	{
+		Preload->NotifyEquip(Item);
+	}
+
 	UpdateItemAnimLayer(Item);
 
 	if (IsLocallyControlled())
@@ -1874,10 +2079,22 @@ void AFPSCharacter::EquipItem(AActor* Item)
 
 	UAnimMontage* EquipMontage = IHoldableInterface::Execute_GetEquipMontage(Item);
 
+	// Joined after the equip montage ended (late join / catch-up) - equip without montage
+	if (EquipMontage && MontagePosition >= EquipMontage->GetPlayLength())
+	{
+		EquipMontage = nullptr;
+	}
+
 	if (EquipMontage)
 	{
 		IHoldableInterface::Execute_SetEquippingState(Item, true);
-		PlayEquipMontage(EquipMontage, false);
+		PlayEquipMontage(EquipMontage, false, MontagePosition);
+
+		// Started mid-montage: show-item notify may already be behind the play position
+		if (MontagePosition > 0.0f)
+		{
+			Item->SetActorHiddenInGame(false);
+		}
 
 		if (GetMesh() && GetMesh()->GetAnimInstance())
 		{
@@ -1902,12 +2119,10 @@ void AFPSCharacter::OnInventoryItemAdded(AActor* Item)
 	Item->SetOwner(this);
 	Multicast_PickupItem(Item);
 
-	// Auto-equip first item
+	// Auto-equip first item (EquipItem pre-links anim layer before equip montage on every machine)
 	if (InventoryComp->GetItemCount() == 1)
 	{
-		Multicast_FirstItemEquip(Item);
-		ActiveItem = Item;
-		EquipItem(ActiveItem);
+		SetWeaponSwitchState(Item, nullptr, EFPSWeaponSwitchPhase::Equipped);
 	}
 
 	if (Item->Implements<UPickupableInterface>())
@@ -1923,43 +2138,27 @@ void AFPSCharacter::OnInventoryItemAdded(AActor* Item)
 
 void AFPSCharacter::Multicast_PickupItem_Implementation(AActor* Item)
 {
-	PerformPickup(Item);
-}
+	FPSCORE_SCOPE_RPC(AFPSCharacter_Multicast_PickupItem);
 
-void AFPSCharacter::Multicast_FirstItemEquip_Implementation(AActor* Item)
-{
-	if (!Item) return;
-	UpdateItemAnimLayer(Item);
+	PerformPickup(Item);
 }
 
-void AFPSCharacter::Multicast_WeaponSwitch_Implementation(AActor* OldItem, AActor* NewItem)
+void AFPSCharacter::PerformPickup(AActor* Item)
 {
-	PendingEquipItem = NewItem;
-	UnequippingItem = OldItem;
+	if (!IsValid(Item)) return;
+	if (!Item->Implements<UHoldableInterface>()) return;
 
-	if (NewItem && NewItem->Implements<UHoldableInterface>())
+	// Stream equip assets now - first equip is usually seconds away
+	if (UFPSAssetPreloadSubsystem* Preload = GetWorld() ? GetWorld()->GetSubsystem<UFPSAssetPreloadSubsystem>() : nullptr)
 	{
-		IHoldableInterface::Execute_SetEquippingState(NewItem, true);
+		Preload->PreloadItem(Item);
 	}
 
-	if (OldItem && OldItem->Implements<UHoldableInterface>())
+	// Leaving the world: restore frozen mesh, wake replication before attachment changes
+	if (UFPSDroppedItemSubsystem* DroppedItems = GetWorld() ? GetWorld()->GetSubsystem<UFPSDroppedItemSubsystem>() : nullptr)
 	{
-		IHoldableInterface::Execute_SetUnequippingState(OldItem, true);
-
-		UAnimMontage* UnequipMontage = IHoldableInterface::Execute_GetUnequipMontage(OldItem);
-		if (UnequipMontage)
-		{
-			PlayEquipMontage(UnequipMontage, true);
-		}
-
-		IHoldableInterface::Execute_OnUnequipped(OldItem);
+		DroppedItems->UnregisterItem(Item);
 	}
-}
-
-void AFPSCharacter::PerformPickup(AActor* Item)
-{
-	if (!IsValid(Item)) return;
-	if (!Item->Implements<UHoldableInterface>()) return;
 
 	FName AttachSocket = IHoldableInterface::Execute_GetAttachSocket(Item);
 
@@ -1991,34 +2190,10 @@ void AFPSCharacter::OnInventoryItemRemoved(AActor* Item)
 {
 	if (!HasAuthority()) return;
 
-	if (Item == ActiveItem)
+	// Dropping item in hands → empty hands on every machine
+	if (Item == WeaponSwitchState.ActiveItem)
 	{
-		ActiveItem = nullptr;
-
-		if (Item->Implements<UHoldableInterface>())
-		{
-			IHoldableInterface::Execute_SetEquippingState(Item, false);
-			IHoldableInterface::Execute_SetUnequippingState(Item, false);
-		}
-
-		PendingEquipItem = nullptr;
-		UnequippingItem = nullptr;
-
-		UpdateItemAnimLayer(nullptr);
-
-		if (IsLocallyControlled())
-		{
-			SetupArmsLocation(nullptr);
-
-			if (Controller && Controller->Implements<UPlayerHUDInterface>())
-			{
-				IPlayerHUDInterface::Execute_SetCrossHair(Controller, DefaultCrossHair, nullptr);
-				IPlayerHUDInterface::Execute_UpdateActiveItem(Controller, nullptr);
-			}
-
-			HipLeaningScale = 1.0f;
-			HipBreathingScale = 1.0f;
-		}
+		SetWeaponSwitchState(nullptr, nullptr, EFPSWeaponSwitchPhase::Equipped);
 	}
 
 	Item->SetOwner(nullptr);
@@ -2044,6 +2219,8 @@ void AFPSCharacter::OnInventoryCleared()
 
 void AFPSCharacter::Multicast_DropItem_Implementation(AActor* Item)
 {
+	FPSCORE_SCOPE_RPC(AFPSCharacter_Multicast_DropItem);
+
 	PerformDrop(Item);
 }
 
@@ -2051,6 +2228,11 @@ void AFPSCharacter::PerformDrop(AActor* Item)
 {
 	if (!IsValid(Item)) return;
 
+	if (UFPSAssetPreloadSubsystem* Preload = GetWorld() ? GetWorld()->GetSubsystem<UFPSAssetPreloadSubsystem>() : nullptr)
+	{
+		Preload->ReleaseItem(Item);
+	}
+
 	FTransform DropTransform;
 	FVector DropImpulse;
 	GetDropTransformAndImpulse(Item, DropTransform, DropImpulse);
@@ -2103,6 +2285,12 @@ void AFPSCharacter::PerformDrop(AActor* Item)
 			TPSMesh->AddImpulse(DropImpulse, NAME_None, true);
 		}
 	}
+
+	// Server tracks rest → freeze, dormancy, world cap
+	if (UFPSDroppedItemSubsystem* DroppedItems = GetWorld() ? GetWorld()->GetSubsystem<UFPSDroppedItemSubsystem>() : nullptr)
+	{
+		DroppedItems->RegisterDroppedItem(Item);
+	}
 }
 
 void AFPSCharacter::GetDropTransformAndImpulse_Implementation(AActor* Item, FTransform& OutTransform, FVector& OutImpulse)
@@ -2150,269 +2338,117 @@ void AFPSCharacter::GetDropTransformAndImpulse_Implementation(AActor* Item, FTra
 }
 
 // ============================================
-// LEANING SYSTEM IMPLEMENTATION (Postprocess Offset)
+// PROCEDURAL ARMS SWAY (Leaning + Breathing)
 // ============================================
 //
-// Self-contained function that calculates weapon sway based on movement
-// All parameters are hardcoded for simplicity
-// State is tracked via static variables (per-instance via this pointer map)
-// Returns 3D offset: X = forward/back (cm), Y = lateral left/right (cm), Z = vertical up/down (cm)
+// Math lives in FFPSProceduralArmsState (Animation/FPSArmsAnimInstance)
+// Game thread only gathers a value snapshot; evaluation runs in the Arms anim update
+// (worker thread) and is applied as root bone offset + camera additive offset.
+// Camera offset evaluated on frame N is applied on frame N+1 and passed back as
+// AppliedCameraOffset, so Arms root always compensates for the offset actually in use.
 
-FVector AFPSCharacter::CalculateLeanVector(float DeltaTime)
+UFPSArmsAnimInstance* AFPSCharacter::GetArmsAnimInstance() const
 {
-	// ============================================
-	// HARDCODED PARAMETERS (REALISTIC VALUES)
-	// ============================================
-	// Based on research: Insurgency, Escape from Tarkov, Ready or Not, CS:GO
-	// TUNED: Refined values for smoother forward/backward and lateral movement
-
-	// Velocity-based lean (weapon follows movement direction)
-	const float MaxLateralOffset = 3.8f;        // cm - lateral sway (tuned: was 4.5, original 1.2)
-	const float MaxForwardOffset = 1.2f;        // cm - forward sway (tuned: was 2.5, original 0.6)
-
-	// Walking bob (perpendicular oscillation)
-	const float BobAmplitudeHorizontal = 2.4f;  // cm - horizontal bob (tuned: was 2.8, original 0.8)
-	const float BobAmplitudeVertical = 3.5f;    // cm - vertical bob (not returned)
-	const float BobFrequency = 8.0f;            // cycles per jog speed
-
-	// Mouse input influence (weapon tilt/lag)
-	const float MouseTiltStrength = 7.0f;       // cm - tilt effect (tuned: was 12.0, more controlled)
-	const float MouseLagSpeed = 6.0f;           // spring damping (tuned: was 5.0, faster response)
-
-	// Interpolation speed
-	const float LeanInterpSpeed = 8.0f;         // velocity-based lean smoothing
-
-	// ============================================
-	// GET VELOCITY (local space)
-	// ============================================
-	FVector WorldVelocity = CMC->Velocity;
-	WorldVelocity.Z = 0.0f; // Ignore vertical movement
-
-	// Transform to local space (X=forward, Y=right)
-	FQuat ActorRot = GetActorQuat();
-	FVector LocalVelocity = ActorRot.Inverse().RotateVector(WorldVelocity);
-	float VelocityMag = LocalVelocity.Size();
-
-	// ============================================
-	// UPDATE WALK CYCLE TIME (for bob phase)
-	// ============================================
-	if (VelocityMag > 10.0f)
-	{
-		float NormalizedSpeed = VelocityMag / 450.0f; // Normalize to jog speed
-		LeanState_WalkCycleTime += DeltaTime * BobFrequency * NormalizedSpeed;
-	}
-	// Don't reset when stopping - preserves phase, prevents jarring snap
-
-	// ============================================
-	// CALCULATE VELOCITY-BASED LEAN (follow movement direction)
-	// ============================================
-	float VelLateral = FMath::Clamp(LocalVelocity.Y / 450.0f, -1.0f, 1.0f);  // Normalize
-	float VelForward = FMath::Clamp(LocalVelocity.X / 450.0f, -1.0f, 1.0f);  // Normalize
-
-	// Lean follows velocity (moving RIGHT → lean RIGHT, moving FORWARD → lean FORWARD)
-	float VelocityLateralLean = VelLateral * MaxLateralOffset;
-	float VelocityForwardLean = VelForward * MaxForwardOffset;
-
-	// ============================================
-	// CALCULATE PERPENDICULAR BOB (walking cycle)
-	// ============================================
-	// Bob perpendicular to movement direction (creates natural "swagger")
-	float BobHorizontal = 0.0f;
-	float BobForward = 0.0f;
-
-	if (VelocityMag > 10.0f)
-	{
-		// Normalize velocity direction
-		FVector2D VelDir;
-		VelDir.X = LocalVelocity.X / VelocityMag;  // Forward component
-		VelDir.Y = LocalVelocity.Y / VelocityMag;  // Right component
-
-		// Forward movement (W) → horizontal bob (left-right swing)
-		BobHorizontal = FMath::Sin(LeanState_WalkCycleTime) * BobAmplitudeHorizontal;
-		BobHorizontal *= FMath::Abs(VelDir.X); // Scale by forward component
-
-		// Strafe movement (A/D) → horizontal bob (perpendicular to strafe)
-		// FIX: Both forward AND strafe create horizontal bob (not forward bob)
-		float StrafeBobHorizontal = FMath::Sin(LeanState_WalkCycleTime) * BobAmplitudeHorizontal * 0.7f;
-		StrafeBobHorizontal *= FMath::Abs(VelDir.Y); // Scale by strafe component
-		BobHorizontal += StrafeBobHorizontal;
-
-		// Vertical bob component (subtle forward/back during walk cycle)
-		// TUNED: Reduced from 0.3 to 0.15 for gentler forward/back oscillation
-		BobForward = FMath::Cos(LeanState_WalkCycleTime * 2.0f) * (BobAmplitudeHorizontal * 0.15f);
-	}
-
-	// ============================================
-	// CALCULATE VERTICAL BOB (Z-axis)
-	// ============================================
-	// Primary component: Up/down bounce during walk cycle
-	// Frequency: 1× horizontal bob (one full cycle per walk cycle)
-	// TUNED: Reduced from 2.0× to 1.0× for slower, more natural rhythm
-	float VerticalBob = 0.0f;
-
-	if (VelocityMag > 10.0f)
-	{
-		// Sin wave at same frequency as horizontal bob (smooth, slow bounce)
-		// Always positive (weapon goes DOWN, not up - realistic foot impact)
-		float NormalizedSpeed = FMath::Clamp(VelocityMag / 450.0f, 0.0f, 1.0f);
-		VerticalBob = FMath::Abs(FMath::Sin(LeanState_WalkCycleTime * 1.0f)) * BobAmplitudeVertical;
-		VerticalBob *= NormalizedSpeed;  // Scale by movement speed
-
-		// Invert to negative (weapon drops DOWN on step)
-		VerticalBob = -VerticalBob;
-	}
-
-	// ============================================
-	// CALCULATE MOUSE INPUT INFLUENCE (weapon tilt/lag)
-	// ============================================
-	FVector2D MouseTiltOffset = FVector2D::ZeroVector;
+	// Framework-level cast: Arms AnimBP is FPSCharacter-specific (same as FPSPlayerController cast)
+	return Arms ? Cast<UFPSArmsAnimInstance>(Arms->GetAnimInstance()) : nullptr;
+}
 
-	// Get current control rotation
-	if (AController* Ctrl = GetController())
+const FFPSProceduralArmsState& AFPSCharacter::GetProceduralArmsState() const
+{
+	if (const UFPSArmsAnimInstance* ArmsAnim = GetArmsAnimInstance())
 	{
-		FRotator CurrentRotation = Ctrl->GetControlRotation();
-
-		// Calculate mouse delta (angular velocity)
-		FRotator DeltaRotation = CurrentRotation - LeanState_PreviousControlRotation;
-		DeltaRotation.Normalize(); // Clamp to ±180°
-
-		// Convert angular velocity to tilt offset
-		// Yaw (horizontal mouse) → lateral offset (weapon lags left/right)
-		// Pitch (vertical mouse) → forward offset (weapon lags up/down)
-		float MouseYawDelta = DeltaRotation.Yaw / DeltaTime;   // degrees per second
-		float MousePitchDelta = DeltaRotation.Pitch / DeltaTime; // degrees per second
-
-		// Store RAW mouse delta magnitude for crosshair alpha
-		// Combine yaw and pitch for total angular velocity
-		LeanState_RawMouseDelta = FMath::Sqrt(MouseYawDelta * MouseYawDelta + MousePitchDelta * MousePitchDelta);
-
-		// Target tilt based on mouse speed
-		FVector2D TargetMouseTilt;
-		TargetMouseTilt.X = FMath::Clamp(MousePitchDelta * 0.002f, -1.0f, 1.0f) * MouseTiltStrength;
-		TargetMouseTilt.Y = FMath::Clamp(-MouseYawDelta * 0.002f, -1.0f, 1.0f) * MouseTiltStrength;
-
-		// Spring interpolation (weapon lags behind camera)
-		LeanState_MouseLagOffset = FMath::Vector2DInterpTo(LeanState_MouseLagOffset, TargetMouseTilt, DeltaTime, MouseLagSpeed);
-		MouseTiltOffset = LeanState_MouseLagOffset;
-
-		// Store rotation for next frame
-		LeanState_PreviousControlRotation = CurrentRotation;
+		return ArmsAnim->GetProceduralState();
 	}
 
-	// ============================================
-	// COMBINE ALL OFFSETS INTO TARGET
-	// ============================================
-	// NOTE: Breathing sway is now calculated separately in CalculateBreathing()
-	// This keeps leaning (movement-based) separate from breathing (idle-based)
-	FVector TargetOffset;
-	TargetOffset.X = VelocityForwardLean + BobForward + MouseTiltOffset.X;
-	TargetOffset.Y = VelocityLateralLean + BobHorizontal + MouseTiltOffset.Y;
-	TargetOffset.Z = VerticalBob;  // Z = vertical bob only
-
-	// Apply aiming scale (reduces all sway during ADS)
-	TargetOffset *= CurrentLeaningScale;
-
-	// ============================================
-	// SMOOTH INTERPOLATION (final spring damping)
-	// ============================================
-	LeanState_CurrentLean = FMath::VInterpTo(LeanState_CurrentLean, TargetOffset, DeltaTime, LeanInterpSpeed);
+	return ProceduralArmsState;
+}
 
-	return LeanState_CurrentLean;
+FVector AFPSCharacter::CalculateLeanVector(float DeltaTime)
+{
+	return GetProceduralArmsState().LeanVector;
 }
 
-// ============================================
-// BREATHING SYSTEM IMPLEMENTATION
-// ============================================
-//
-// Standalone breathing calculation function
-// Uses CurrentBreathingScale from ActiveItem weapon (hip-fire idle breathing)
-// Interpolates to AimBreathingScale from sight when aiming (reduced breathing during ADS)
-//
 FVector AFPSCharacter::CalculateBreathing(float DeltaTime)
 {
-	// ============================================
-	// HARDCODED PARAMETERS
-	// ============================================
-	const float IdleSwayAmplitude = 0.4f;       // cm - breathing amplitude
-	const float IdleSwayFrequencyX = 0.45f;     // Hz - breathing rate X (27 cycles/min, 1 cycle per 2.2 sec)
-	const float IdleSwayFrequencyY = 0.55f;     // Hz - breathing rate Y (33 cycles/min, 1 cycle per 1.8 sec)
-	const float IdleSwayFrequencyZ = 0.35f;     // Hz - breathing rate Z (21 cycles/min, 1 cycle per 2.9 sec)
-	const float IdleBlendSpeed = 3.0f;          // idle sway activation blend
-	const float LeanInterpSpeed = 8.0f;         // smooth interpolation
-
-	// ============================================
-	// GET VELOCITY (local space)
-	// ============================================
-	FVector WorldVelocity = CMC->Velocity;
-	WorldVelocity.Z = 0.0f; // Ignore vertical movement
-	float VelocityMag = WorldVelocity.Size();
-
-	// ============================================
-	// IDLE SWAY ACTIVATION (blend based on velocity)
-	// ============================================
-	// When stationary: IdleActivation = 1.0 (full idle sway)
-	// When moving: IdleActivation = 0.0 (disable idle sway)
-	float TargetIdleActivation = (VelocityMag < 50.0f) ? 1.0f : 0.0f;
-	BreathingState_IdleActivation = FMath::FInterpTo(BreathingState_IdleActivation, TargetIdleActivation, DeltaTime, IdleBlendSpeed);
+	return GetProceduralArmsState().BreathingVector;
+}
 
-	// ============================================
-	// UPDATE IDLE SWAY TIME (always running)
-	// ============================================
-	BreathingState_IdleSwayTime += DeltaTime;
+FRotator AFPSCharacter::CalculateBreathingRotation(const FVector& InBreathingVector) const
+{
+	return FFPSProceduralArmsState::CalculateBreathingRotation(InBreathingVector);
+}
 
+void AFPSCharacter::UpdateProceduralArms(float DeltaTime)
+{
 	// ============================================
-	// CALCULATE IDLE SWAY (breathing/tremor)
+	// GATHER INPUT SNAPSHOT (GAME THREAD)
 	// ============================================
-	FVector TargetBreathing = FVector::ZeroVector;
-
-	if (BreathingState_IdleActivation > 0.01f)
+	FFPSProceduralArmsInput Input;
+	Input.Velocity = CMC ? CMC->Velocity : GetVelocity();
+	Input.ActorQuat = GetActorQuat();
+	Input.bHasController = Controller != nullptr;
+	Input.ControlRotation = Controller ? Controller->GetControlRotation() : FRotator::ZeroRotator;
+	Input.ArmsOffset = InterpolatedArmsOffset;
+	Input.ArmsRelativeTransform = Arms->GetRelativeTransform();
+	Input.LeaningScale = CurrentLeaningScale;
+	Input.BreathingScale = CurrentBreathingScale;
+	Input.bIsAiming = bIsAiming;
+	Input.bResetState = bPendingProceduralArmsReset;
+	bPendingProceduralArmsReset = false;
+
+	if (UFPSArmsAnimInstance* ArmsAnim = GetArmsAnimInstance())
 	{
-		// Sine waves at different frequencies (creates figure-8 pattern in XY, subtle Z breathing)
-		float IdleX = FMath::Sin(BreathingState_IdleSwayTime * IdleSwayFrequencyX * 2.0f * PI);
-		float IdleY = FMath::Sin(BreathingState_IdleSwayTime * IdleSwayFrequencyY * 2.0f * PI);
-		float IdleZ = FMath::Cos(BreathingState_IdleSwayTime * IdleSwayFrequencyZ * 2.0f * PI);  // Slower breathing rate
+		// ============================================
+		// WORKER THREAD PATH
+		// ============================================
+		const FFPSProceduralArmsState& State = ArmsAnim->GetProceduralState();
+
+		// Apply last evaluated camera sway as view offset (camera component does not move)
+		Input.AppliedCameraOffset = Input.bResetState ? FTransform::Identity : State.CameraOffset;
+		if (Camera)
+		{
+			Camera->ClearAdditiveOffset();
+			if (!Input.AppliedCameraOffset.Equals(FTransform::Identity))
+			{
+				Camera->AddAdditiveOffset(Input.AppliedCameraOffset, 0.0f);
+			}
+		}
 
-		TargetBreathing.X = IdleX * IdleSwayAmplitude * BreathingState_IdleActivation;
-		TargetBreathing.Y = IdleY * IdleSwayAmplitude * BreathingState_IdleActivation;
-		TargetBreathing.Z = IdleZ * (IdleSwayAmplitude * 0.75f) * BreathingState_IdleActivation;  // 75% amplitude for Z
+		ArmsAnim->SetProceduralInput(Input);
 
-		// Apply breathing scale (CurrentBreathingScale interpolates hip → ADS)
-		TargetBreathing *= CurrentBreathingScale;
+		LeanVector = State.LeanVector;
+		BreathingVector = State.BreathingVector;
+		BreathingRotation = Input.AppliedCameraOffset.Rotator();
+		return;
 	}
 
 	// ============================================
-	// SMOOTH INTERPOLATION (final spring damping)
+	// GAME THREAD FALLBACK (AnimBP not reparented)
 	// ============================================
-	BreathingState_CurrentBreathing = FMath::VInterpTo(BreathingState_CurrentBreathing, TargetBreathing, DeltaTime, LeanInterpSpeed);
-
-	return BreathingState_CurrentBreathing;
-}
+	if (Input.bResetState)
+	{
+		ProceduralArmsState.Reset(Input.ControlRotation);
+	}
 
-// ============================================
-// BREATHING ROTATION CALCULATION (Camera sway)
-// ============================================
-//
-// Converts breathing offset (cm) to camera rotation (degrees)
-// Used for realistic aim wobble during ADS
-//
-FRotator AFPSCharacter::CalculateBreathingRotation(const FVector& BreathingVector) const
-{
-	// ============================================
-	// HARDCODED PARAMETERS
-	// ============================================
-	const float OffsetToRotationScale = 0.8f;   // degrees per cm (tuned for realistic wobble)
+	ProceduralArmsState.Update(Input, DeltaTime);
 
-	// ============================================
-	// CONVERT OFFSET TO ROTATION
-	// ============================================
-	// BreathingVector.Y (lateral offset, cm) → Yaw (horizontal rotation, degrees)
-	// BreathingVector.Z (vertical offset, cm) → Pitch (vertical rotation, degrees)
-	// Invert Z for natural pitch direction (positive Z up → negative Pitch down)
+	LeanVector = ProceduralArmsState.LeanVector;
+	BreathingVector = ProceduralArmsState.BreathingVector;
 
-	float BreathingYaw = BreathingVector.Y * OffsetToRotationScale;
-	float BreathingPitch = -BreathingVector.Z * OffsetToRotationScale;
+	// Camera sway as view offset; Arms follow it through their own relative transform
+	// (Arms are attached to Camera, which does not move with the additive offset)
+	BreathingRotation = ProceduralArmsState.CameraOffset.Rotator();
+	if (Camera)
+	{
+		Camera->ClearAdditiveOffset();
+		if (!ProceduralArmsState.CameraOffset.Equals(FTransform::Identity))
+		{
+			Camera->AddAdditiveOffset(ProceduralArmsState.CameraOffset, 0.0f);
+		}
+	}
 
-	return FRotator(BreathingPitch, BreathingYaw, 0.0f);
+	const FTransform ArmsTransform(FRotator(0.0f, -90.0f, 0.0f), ProceduralArmsState.FinalArmsOffset);
+	Arms->SetRelativeTransform(ArmsTransform * ProceduralArmsState.CameraOffset);
 }
 
 // ============================================
@@ -2421,9 +2457,10 @@ FRotator AFPSCharacter::CalculateBreathingRotation(const FVector& BreathingVecto
 //
 // Shared function that updates both MPC shader effects and crosshair expansion
 // Combines leaning and breathing vectors for shader, calculates lean alpha for crosshair
+// Values are pushed to the controller's HUD view-model (flushed once per frame on change)
 // LOCAL ONLY - called from Tick() for locally controlled players
 //
-void AFPSCharacter::UpdateLeaningVisualFeedback(const FVector& BreathingVector)
+void AFPSCharacter::UpdateLeaningVisualFeedback(const FVector& InBreathingVector)
 {
 	// ============================================
 	// MATERIAL PARAMETER COLLECTION UPDATE
@@ -2432,7 +2469,7 @@ void AFPSCharacter::UpdateLeaningVisualFeedback(const FVector& BreathingVector)
 	if (MPC_Aim)
 	{
 		// Combine leaning and breathing vectors
-		FVector CombinedOffset = LeanVector + BreathingVector;
+		FVector CombinedOffset = LeanVector + InBreathingVector;
 
 		// Swap axes for shader convention: X→Y, Y→X (lateral↔forward)
 		FVector ShaderSpaceOffset;
@@ -2452,7 +2489,15 @@ void AFPSCharacter::UpdateLeaningVisualFeedback(const FVector& BreathingVector)
 		NormalizedOffset.Z = FMath::Clamp((ShaderSpaceOffset.Z / MaxOffsetCm) * IntensityScale, -1.0f, 1.0f);
 
 		// Set to MPC (each axis always in -1..1 range)
-		UKismetMaterialLibrary::SetVectorParameterValue(GetWorld(), MPC_Aim, FName("OffsetDirection"), FLinearColor(NormalizedOffset));
+		// HUD view-model writes once per frame, only on change; direct write for controllers without it
+		if (Controller && Controller->Implements<UPlayerHUDInterface>())
+		{
+			IPlayerHUDInterface::Execute_UpdateAimOffset(Controller, MPC_Aim, NormalizedOffset);
+		}
+		else
+		{
+			UKismetMaterialLibrary::SetVectorParameterValue(GetWorld(), MPC_Aim, FName("OffsetDirection"), FLinearColor(NormalizedOffset));
+		}
 	}
 
 	// ============================================
@@ -2473,15 +2518,15 @@ void AFPSCharacter::UpdateLeaningVisualFeedback(const FVector& BreathingVector)
 		// Scaled down to prevent dominating movement alpha
 		const float MaxMouseSpeed = 400.0f;  // Higher threshold for less sensitivity
 		const float LookInfluence = 0.3f;     // Look contributes up to 30% of total alpha
-		float LookAlpha = FMath::Clamp(LeanState_RawMouseDelta / MaxMouseSpeed, 0.0f, 1.0f) * LookInfluence;
+		float LookAlpha = FMath::Clamp(GetProceduralArmsState().RawMouseDelta / MaxMouseSpeed, 0.0f, 1.0f) * LookInfluence;
 
 		// 3. Recoil contribution (from shot accumulation)
-		// ShotCount: 0 = no recoil, MaxAccumulation = sustained fire (full recoil penalty)
+		// RecoilFactor: 0 = no recoil, 1 = sustained fire (full recoil penalty)
 		// Weight: 35% of total alpha (significant impact on sustained fire)
 		float RecoilAlpha = 0.0f;
 		if (RecoilComp)
 		{
-			float RecoilFactor = FMath::Min(static_cast<float>(RecoilComp->ShotCount) / RecoilComp->MaxAccumulation, 1.0f);
+			float RecoilFactor = RecoilComp->GetRecoilFactor();
 			RecoilAlpha = RecoilFactor * 0.35f; // 35% weight
 		}
 
@@ -2512,10 +2557,11 @@ void AFPSCharacter::GetShootingViewPoint_Implementation(FVector& OutLocation, FR
 	// Server needs replicated Pitch for accurate weapon ballistics
 	OutRotation.Pitch = Pitch;
 
-	// Optional: Use Camera location if available (more accurate than capsule + BaseEyeHeight)
-	if (Camera)
+	// Use analytic camera location (more accurate than capsule + BaseEyeHeight)
+	// Camera component only moves on the owning client - evaluate the same rig on every role
+	if (USkeletalMeshComponent* MeshComp = GetMesh())
 	{
-		OutLocation = Camera->GetComponentLocation();
+		OutLocation = (CalculateCameraRelativeTransform(LocalPitchAccumulator) * MeshComp->GetComponentTransform()).GetLocation();
 	}
 }
 
@@ -2528,11 +2574,12 @@ float AFPSCharacter::GetRecoilFactor_Implementation() const
 {
 	// Get recoil accumulation factor from RecoilComponent
 	// Used by weapons to increase spread during sustained fire
-	// RecoilComponent tracks ShotCount independently on server and client (LOCAL state)
+	// RecoilComponent tracks shots independently on server and client (LOCAL state)
+	// Evaluated in closed form from shot timestamps - frame-rate independent
 	if (RecoilComp)
 	{
-		// Calculate normalized recoil factor (0.0 = no shots, 1.0 = sustained fire)
-		return FMath::Min(static_cast<float>(RecoilComp->ShotCount) / RecoilComp->MaxAccumulation, 1.0f);
+		// Normalized recoil factor (0.0 = no shots, 1.0 = sustained fire)
+		return RecoilComp->GetRecoilFactor();
 	}
 
 	return 0.0f; // No recoil if RecoilComp is null
@@ -2605,6 +2652,10 @@ void AFPSCharacter::OnHealthComponentHealthChanged(float NewHealth)
 
 void AFPSCharacter::Multicast_HitReaction_Implementation()
 {
+	FPSCORE_SCOPE_RPC(AFPSCharacter_Multicast_HitReaction);
+
+	UFPSCharacterSignificanceSubsystem::NotifyCombatEventFor(this);
+
 	HitReaction();
 
 	if (IsLocallyControlled() && Controller && Controller->Implements<UPlayerHUDInterface>())
@@ -2628,12 +2679,15 @@ void AFPSCharacter::HitReaction()
 		return;
 	}
 
-	if (GetMesh() && GetMesh()->GetAnimInstance())
+	// Cosmetic on proxies - far / off-screen skip it, owner-only Arms only at full detail
+	const EFPSProxyDetail ProxyDetail = UFPSCharacterSignificanceSubsystem::GetDetailFor(this);
+
+	if (ProxyDetail != EFPSProxyDetail::Minimal && GetMesh() && GetMesh()->GetAnimInstance())
 	{
 		GetMesh()->GetAnimInstance()->Montage_Play(SelectedMontage);
 	}
 
-	if (Arms && Arms->GetAnimInstance())
+	if (ProxyDetail == EFPSProxyDetail::Full && Arms && Arms->GetAnimInstance())
 	{
 		Arms->GetAnimInstance()->Montage_Play(SelectedMontage);
 	}
@@ -2645,6 +2699,8 @@ void AFPSCharacter::HitReaction()
 
 void AFPSCharacter::Client_ProcessDeath_Implementation()
 {
+	FPSCORE_SCOPE_RPC(AFPSCharacter_Client_ProcessDeath);
+
 	if (Camera)
 	{
 		Camera->PostProcessSettings.bOverride_ColorSaturation = true;
@@ -2659,6 +2715,8 @@ void AFPSCharacter::Client_ProcessDeath_Implementation()
 
 void AFPSCharacter::Multicast_ProcessDeath_Implementation()
 {
+	FPSCORE_SCOPE_RPC(AFPSCharacter_Multicast_ProcessDeath);
+
 	EnableRagdoll();
 }
 
@@ -2680,6 +2738,7 @@ void AFPSCharacter::ResetCharacterState()
 
 	bIsAiming = false;
 	Pitch = 0.0f;
+	CMC->ClearMovementIntent();
 
 	Multicast_ProcessReset();
 	Client_ProcessReset();
@@ -2687,13 +2746,14 @@ void AFPSCharacter::ResetCharacterState()
 
 void AFPSCharacter::Client_ProcessReset_Implementation()
 {
+	FPSCORE_SCOPE_RPC(AFPSCharacter_Client_ProcessReset);
+
 	if (Camera)
 	{
 		Camera->PostProcessSettings.bOverride_ColorSaturation = false;
 		Camera->PostProcessSettings.ColorSaturation = FVector4(1.0f, 1.0f, 1.0f, 1.0f);
 		Camera->SetFieldOfView(DefaultFOV);
-		Camera->SetRelativeLocation(BaseCameraLocation);
-		Camera->SetRelativeRotation(FRotator::ZeroRotator);
+		Camera->ClearAdditiveOffset();
 	}
 
 	if (Controller && Controller->Implements<UPlayerHUDInterface>())
@@ -2717,16 +2777,14 @@ void AFPSCharacter::Client_ProcessReset_Implementation()
 	AimingAlpha = 0.0f;
 	bAimingCrosshairSet = false;
 	LocalPitchAccumulator = 0.0f;
+	UpdateCameraTransform();
 
-	LeanState_CurrentLean = FVector::ZeroVector;
-	LeanState_WalkCycleTime = 0.0f;
-	LeanState_PreviousControlRotation = GetControlRotation();
-	LeanState_MouseLagOffset = FVector2D::ZeroVector;
-	LeanState_RawMouseDelta = 0.0f;
-
-	BreathingState_CurrentBreathing = FVector::ZeroVector;
-	BreathingState_IdleSwayTime = 0.0f;
-	BreathingState_IdleActivation = 0.0f;
+	// Lean/breathing state lives in procedural arms state (anim instance or fallback)
+	// Forwarded with next input snapshot so worker-thread state is never touched here
+	bPendingProceduralArmsReset = true;
+	LeanVector = FVector::ZeroVector;
+	BreathingVector = FVector::ZeroVector;
+	BreathingRotation = FRotator::ZeroRotator;
 
 	HipLeaningScale = 1.0f;
 	HipBreathingScale = 1.0f;
@@ -2736,8 +2794,16 @@ void AFPSCharacter::Client_ProcessReset_Implementation()
 
 void AFPSCharacter::Multicast_ProcessReset_Implementation()
 {
+	FPSCORE_SCOPE_RPC(AFPSCharacter_Multicast_ProcessReset);
+
 	DisableRagdoll();
 
+	// Owner must drop held intent too, otherwise next move re-resolves the old mode
+	if (CMC)
+	{
+		CMC->ClearMovementIntent();
+	}
+
 	CurrentMovementMode = EFPSMovementMode::Jog;
 	UpdateMovementSpeed(CurrentMovementMode);
 }
@@ -2767,6 +2833,8 @@ void AFPSCharacter::ApplyRecoilKick_Implementation(float RecoilScale)
 
 void AFPSCharacter::Multicast_ApplyRecoil_Implementation(float RecoilScale)
 {
+	FPSCORE_SCOPE_RPC(AFPSCharacter_Multicast_ApplyRecoil);
+
 	if (!RecoilComp)
 	{
 		return;
@@ -2776,7 +2844,7 @@ void AFPSCharacter::Multicast_ApplyRecoil_Implementation(float RecoilScale)
 	{
 		RecoilComp->ApplyRecoilToCamera(RecoilScale);
 	}
-	else
+	else if (UFPSCharacterSignificanceSubsystem::GetDetailFor(this) != EFPSProxyDetail::Minimal)
 	{
 		RecoilComp->ApplyRecoilToWeapon(RecoilScale);
 	}
@@ -2834,7 +2902,21 @@ void AFPSCharacter::EnableRagdoll()
 		GetMesh()->SetOwnerNoSee(false);
 		GetMesh()->SetCollisionObjectType(ECC_PhysicsBody);
 		GetMesh()->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-		GetMesh()->SetAllBodiesBelowSimulatePhysics(FName("pelvis"), true, true);
+
+		// Ragdoll is cosmetic - budget subsystem caps simulation and skips it on dedicated server
+		UFPSRagdollSubsystem* RagdollSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UFPSRagdollSubsystem>() : nullptr;
+		if (RagdollSubsystem)
+		{
+			if (!RagdollSubsystem->BeginRagdoll(GetMesh(), FName("pelvis")))
+			{
+				// Not simulated - corpse needs no collision
+				GetMesh()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+			}
+		}
+		else
+		{
+			GetMesh()->SetAllBodiesBelowSimulatePhysics(FName("pelvis"), true, true);
+		}
 	}
 }
 
@@ -2858,18 +2940,26 @@ void AFPSCharacter::DisableRagdoll()
 
 	if (GetMesh())
 	{
+		// Release budget slot / frozen pose snapshot
+		if (UFPSRagdollSubsystem* RagdollSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UFPSRagdollSubsystem>() : nullptr)
+		{
+			RagdollSubsystem->EndRagdoll(GetMesh());
+		}
+
 		GetMesh()->SetAllBodiesSimulatePhysics(false);
 		GetMesh()->SetOwnerNoSee(true);
 		GetMesh()->SetRelativeLocation(FVector(0.0f, 0.0f, -88.0f));
 		GetMesh()->SetRelativeRotation(FRotator(0.0f, -90.0f, 0.0f));
 		GetMesh()->SetCollisionProfileName(FName("CharacterMesh"), true);
-		GetMesh()->SetCollisionObjectType(ECC_Pawn);
+		// Back on the hitbox layer (physics bullet traces skip this object type)
+		GetMesh()->SetCollisionObjectType(HitboxComp ? HitboxComp->GetBodyObjectType() : ECC_Pawn);
 		GetMesh()->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
 	}
 
-	if (Spine_03)
+	SpineCrouchOffset = FVector::ZeroVector;
+	if (IsLocallyControlled())
 	{
-		Spine_03->SetRelativeLocation(OriginalSpineLocation);
+		UpdateCameraTransform();
 	}
 
 	if (GetCapsuleComponent())
@@ -2900,7 +2990,8 @@ USkeletalMeshComponent* AFPSCharacter::GetArmsMesh_Implementation() const
 
 USkeletalMeshComponent* AFPSCharacter::GetLegsMesh_Implementation() const
 {
-	return Legs;
+	// Following Body pose (remote) - nothing to play on Legs
+	return bOwnerOnlyMeshesFollowBody ? nullptr : Legs;
 }
 
 // ============================================
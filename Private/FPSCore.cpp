@@ -1,12 +1,60 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "FPSCore.h"
+#include "UObject/CoreRedirects.h"
 
 #define LOCTEXT_NAMESPACE "FFPSCoreModule"
 
+namespace FPSCoreRedirects
+{
+	/**
+	 * Renamed Blueprint-visible / serialized properties
+	 * Registered before any content loads so saved Blueprints and AnimBPs resolve the new names
+	 */
+	static void RegisterPropertyRedirects()
+	{
+		TArray<FCoreRedirect> Redirects;
+
+		auto AddProperty = [&Redirects](const TCHAR* Class, const TCHAR* OldName, const TCHAR* NewName)
+		{
+			Redirects.Emplace(ECoreRedirectFlags::Type_Property,
+				FString::Printf(TEXT("/Script/FPSCore.%s.%s"), Class, OldName),
+				FString::Printf(TEXT("/Script/FPSCore.%s.%s"), Class, NewName));
+		};
+
+		// URecoilComponent: runtime state is anchored at the last shot (closed-form recovery)
+		AddProperty(TEXT("RecoilComponent"), TEXT("CurrentRecoilPitch"), TEXT("AnchorRecoilPitch"));
+		AddProperty(TEXT("RecoilComponent"), TEXT("CurrentRecoilYaw"), TEXT("AnchorRecoilYaw"));
+		AddProperty(TEXT("RecoilComponent"), TEXT("ShotCount"), TEXT("AnchorShotCount"));
+
+		// ABaseWeapon + tuning components: per-weapon tuning moved to WeaponDefinition,
+		// old values load into _DEPRECATED and are migrated in ABaseWeapon::PostLoad
+		// (lookup walks the super chain, so subclass Blueprints resolve via the declaring class)
+		AddProperty(TEXT("BaseWeapon"), TEXT("AimFOV"), TEXT("AimFOV_DEPRECATED"));
+		AddProperty(TEXT("BaseWeapon"), TEXT("AimLookSpeed"), TEXT("AimLookSpeed_DEPRECATED"));
+		AddProperty(TEXT("BaseWeapon"), TEXT("LeaningScale"), TEXT("LeaningScale_DEPRECATED"));
+		AddProperty(TEXT("BaseWeapon"), TEXT("BreathingScale"), TEXT("BreathingScale_DEPRECATED"));
+		AddProperty(TEXT("BaseWeapon"), TEXT("AcceptedCaliberType"), TEXT("AcceptedCaliberType_DEPRECATED"));
+		AddProperty(TEXT("BaseWeapon"), TEXT("AnimLayer"), TEXT("AnimLayer_DEPRECATED"));
+		AddProperty(TEXT("BaseWeapon"), TEXT("ShootMontage"), TEXT("ShootMontage_DEPRECATED"));
+		AddProperty(TEXT("BaseWeapon"), TEXT("EquipMontage"), TEXT("EquipMontage_DEPRECATED"));
+		AddProperty(TEXT("BaseWeapon"), TEXT("UnequipMontage"), TEXT("UnequipMontage_DEPRECATED"));
+		AddProperty(TEXT("BaseWeapon"), TEXT("CharacterAttachSocket"), TEXT("CharacterAttachSocket_DEPRECATED"));
+		AddProperty(TEXT("BaseWeapon"), TEXT("ReloadAttachSocket"), TEXT("ReloadAttachSocket_DEPRECATED"));
+		AddProperty(TEXT("FireComponent"), TEXT("FireRate"), TEXT("FireRate_DEPRECATED"));
+		AddProperty(TEXT("FireComponent"), TEXT("SpreadScale"), TEXT("SpreadScale_DEPRECATED"));
+		AddProperty(TEXT("FireComponent"), TEXT("RecoilScale"), TEXT("RecoilScale_DEPRECATED"));
+		AddProperty(TEXT("ReloadComponent"), TEXT("ReloadMontage"), TEXT("ReloadMontage_DEPRECATED"));
+		AddProperty(TEXT("BallisticsComponent"), TEXT("CaliberDataMap"), TEXT("CaliberDataMap_DEPRECATED"));
+
+		FCoreRedirects::AddRedirectList(Redirects, TEXT("FPSCore"));
+	}
+}
+
 void FFPSCoreModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+	FPSCoreRedirects::RegisterPropertyRedirects();
 }
 
 void FFPSCoreModule::ShutdownModule()
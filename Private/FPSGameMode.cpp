@@ -6,14 +6,33 @@
 #include "TimerManager.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Kismet/KismetSystemLibrary.h"
+#include "EngineUtils.h"
+#include "HAL/PlatformTime.h"
+#include "Engine/NetDriver.h"
+#include "Core/FPSCombatReplaySubsystem.h"
+#include "Core/FPSHitboxSubsystem.h"
+#include "Misc/CommandLine.h"
+#include "RenderCore.h"
 
 AFPSGameMode::AFPSGameMode()
 {
+	// Tick only used by load report (enabled on demand)
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
 }
 
 void AFPSGameMode::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// Bake spawn candidates once at map load - respawns do no traces afterwards
+	BuildSpawnIndex();
+
+	float ReportInterval = 0.0f;
+	if (FParse::Value(FCommandLine::Get(), TEXT("FPSLoadReport="), ReportInterval))
+	{
+		StartLoadReport(ReportInterval);
+	}
 }
 
 void AFPSGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -130,7 +149,7 @@ void AFPSGameMode::RespawnPlayer(AController* PlayerController)
 	}
 
 	FVector SpawnLocation;
-	if (FindRespawnLocation(SpawnLocation))
+	if (FindRespawnLocation(SpawnLocation, PlayerController))
 	{
 		Pawn->SetActorLocation(SpawnLocation, false, nullptr, ETeleportType::TeleportPhysics);
 	}
@@ -141,7 +160,307 @@ void AFPSGameMode::RespawnPlayer(AController* PlayerController)
 	}
 }
 
-bool AFPSGameMode::FindRespawnLocation(FVector& OutLocation)
+// ============================================
+// SPAWN INDEX
+// ============================================
+
+void AFPSGameMode::BuildSpawnIndex()
+{
+	if (!HasAuthority())
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	SpawnCandidates.Reset();
+	SpawnCells.Reset();
+
+	// ============================================
+	// STEP 1: COLLECT GROUNDED CANDIDATES
+	// ============================================
+	TArray<FVector> RawCandidates;
+
+	const float Spacing = FMath::Max(SpawnCandidateSpacing, 50.0f);
+	const int32 NumX = FMath::Max(1, FMath::FloorToInt(2.0f * SpawnAreaHalfExtents.X / Spacing) + 1);
+	const int32 NumY = FMath::Max(1, FMath::FloorToInt(2.0f * SpawnAreaHalfExtents.Y / Spacing) + 1);
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(FPSSpawnIndexBake), false);
+
+	for (int32 IndexX = 0; IndexX < NumX; ++IndexX)
+	{
+		for (int32 IndexY = 0; IndexY < NumY; ++IndexY)
+		{
+			const FVector GridPoint(
+				SpawnAreaCenter.X - SpawnAreaHalfExtents.X + IndexX * Spacing,
+				SpawnAreaCenter.Y - SpawnAreaHalfExtents.Y + IndexY * Spacing,
+				SpawnAreaCenter.Z - SpawnAreaHalfExtents.Z
+			);
+
+			// Same trace as legacy search: from above spawn area down to its floor
+			const FVector TraceStart(GridPoint.X, GridPoint.Y, SpawnAreaCenter.Z + SpawnAreaHalfExtents.Z + SpawnTraceHeight);
+
+			FHitResult HitResult;
+			if (World->LineTraceSingleByChannel(HitResult, TraceStart, GridPoint, ECC_Visibility, QueryParams))
+			{
+				RawCandidates.Add(HitResult.ImpactPoint + FVector(0.0f, 0.0f, SpawnGroundOffset));
+			}
+		}
+	}
+
+	// PlayerStarts are always valid candidates (designer placed)
+	for (TActorIterator<APlayerStart> It(World); It; ++It)
+	{
+		RawCandidates.Add(It->GetActorLocation());
+	}
+
+	if (RawCandidates.Num() == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AFPSGameMode::BuildSpawnIndex - No spawn candidates found, falling back to trace search"));
+		return;
+	}
+
+	// ============================================
+	// STEP 2: GROUP INTO CELLS (contiguous ranges)
+	// ============================================
+	const float CellSize = FMath::Max(SpawnCellSize, Spacing);
+	auto GetCellKey = [CellSize](const FVector& Location)
+	{
+		return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+	};
+
+	RawCandidates.Sort([&GetCellKey](const FVector& A, const FVector& B)
+	{
+		const FIntPoint KeyA = GetCellKey(A);
+		const FIntPoint KeyB = GetCellKey(B);
+		return KeyA.X != KeyB.X ? KeyA.X < KeyB.X : KeyA.Y < KeyB.Y;
+	});
+
+	SpawnCandidates = MoveTemp(RawCandidates);
+
+	FIntPoint CurrentKey = GetCellKey(SpawnCandidates[0]);
+	FSpawnCell CurrentCell;
+
+	for (int32 Index = 0; Index < SpawnCandidates.Num(); ++Index)
+	{
+		const FIntPoint Key = GetCellKey(SpawnCandidates[Index]);
+		if (Key != CurrentKey)
+		{
+			CurrentCell.Center /= CurrentCell.NumCandidates;
+			SpawnCells.Add(CurrentCell);
+
+			CurrentCell = FSpawnCell();
+			CurrentCell.FirstCandidate = Index;
+			CurrentKey = Key;
+		}
+
+		CurrentCell.Center += SpawnCandidates[Index];
+		CurrentCell.NumCandidates++;
+	}
+
+	CurrentCell.Center /= CurrentCell.NumCandidates;
+	SpawnCells.Add(CurrentCell);
+
+	SpawnCandidates.Shrink();
+	SpawnCells.Shrink();
+
+	UE_LOG(LogTemp, Log, TEXT("AFPSGameMode::BuildSpawnIndex - %d candidates in %d cells (%.2f ms)"),
+		SpawnCandidates.Num(), SpawnCells.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void AFPSGameMode::GatherOccupiedLocations(AController* RespawningController, TArray<FVector>& OutLocations)
+{
+	OutLocations.Reset();
+
+	// Living players (respawning pawn is ignored - it is about to be teleported)
+	for (APlayerController* PC : PlayerControllers)
+	{
+		if (!PC || PC == RespawningController)
+		{
+			continue;
+		}
+
+		APawn* Pawn = PC->GetPawn();
+		if (!Pawn)
+		{
+			continue;
+		}
+
+		if (Pawn->Implements<UDamageableInterface>() && IDamageableInterface::Execute_IsDead(Pawn))
+		{
+			continue;
+		}
+
+		OutLocations.Add(Pawn->GetActorLocation());
+	}
+
+	// Recently used spawns (spreads mass-respawn events)
+	if (const UWorld* World = GetWorld())
+	{
+		const float CurrentTime = World->GetTimeSeconds();
+		RecentSpawns.RemoveAll([CurrentTime, this](const TPair<FVector, float>& Entry)
+		{
+			return CurrentTime - Entry.Value > SpawnReservationTime;
+		});
+
+		for (const TPair<FVector, float>& Entry : RecentSpawns)
+		{
+			OutLocations.Add(Entry.Key);
+		}
+	}
+}
+
+float AFPSGameMode::GetClosestDistanceSquared(const FVector& Location, const TArray<FVector>& Occupied)
+{
+	float ClosestDistSq = MAX_flt;
+	for (const FVector& OccupiedLocation : Occupied)
+	{
+		ClosestDistSq = FMath::Min(ClosestDistSq, FVector::DistSquared2D(Location, OccupiedLocation));
+	}
+	return ClosestDistSq;
+}
+
+bool AFPSGameMode::QuerySpawnIndex(const TArray<FVector>& Occupied, FVector& OutLocation) const
+{
+	if (SpawnCells.Num() == 0)
+	{
+		return false;
+	}
+
+	// ============================================
+	// STEP 1: SCORE CELLS (cells × occupied, independent of candidate count)
+	// ============================================
+	// Score = squared distance from cell center to closest occupied location
+	// Keep N best cells, pick one at random (avoids predictable spawns)
+	// Deliberately a linear scan, not a tree query: "farthest from every player" changes with each
+	// query's player set, so a sorted structure would be rebuilt per query. Cells are few (area / SpawnCellSize^2,
+	// typically < 500) and contiguous - BenchmarkSpawnQueries reports the per-query cost.
+	const int32 NumChoices = FMath::Clamp(SpawnCellChoices, 1, SpawnCells.Num());
+	TArray<TPair<float, int32>, TInlineAllocator<8>> BestCells;
+
+	for (int32 CellIndex = 0; CellIndex < SpawnCells.Num(); ++CellIndex)
+	{
+		// Random tie-breaker when nobody is alive (all scores MAX_flt)
+		const float Score = Occupied.Num() > 0
+			? GetClosestDistanceSquared(SpawnCells[CellIndex].Center, Occupied)
+			: FMath::FRand();
+
+		if (BestCells.Num() < NumChoices)
+		{
+			BestCells.Emplace(Score, CellIndex);
+		}
+		else
+		{
+			int32 WorstIndex = 0;
+			for (int32 i = 1; i < BestCells.Num(); ++i)
+			{
+				if (BestCells[i].Key < BestCells[WorstIndex].Key)
+				{
+					WorstIndex = i;
+				}
+			}
+
+			if (Score > BestCells[WorstIndex].Key)
+			{
+				BestCells[WorstIndex] = TPair<float, int32>(Score, CellIndex);
+			}
+		}
+	}
+
+	const FSpawnCell& Cell = SpawnCells[BestCells[FMath::RandRange(0, BestCells.Num() - 1)].Value];
+
+	// ============================================
+	// STEP 2: BEST CANDIDATE IN CELL
+	// ============================================
+	int32 BestCandidate = Cell.FirstCandidate + FMath::RandRange(0, Cell.NumCandidates - 1);
+
+	if (Occupied.Num() > 0)
+	{
+		float BestScore = -1.0f;
+		for (int32 Index = Cell.FirstCandidate; Index < Cell.FirstCandidate + Cell.NumCandidates; ++Index)
+		{
+			const float Score = GetClosestDistanceSquared(SpawnCandidates[Index], Occupied);
+			if (Score > BestScore)
+			{
+				BestScore = Score;
+				BestCandidate = Index;
+			}
+		}
+	}
+
+	OutLocation = SpawnCandidates[BestCandidate];
+	return true;
+}
+
+bool AFPSGameMode::FindRespawnLocation(FVector& OutLocation, AController* RespawningController)
+{
+	if (!HasAuthority())
+	{
+		return false;
+	}
+
+	if (SpawnCells.Num() == 0)
+	{
+		return FindRespawnLocationByTrace(OutLocation);
+	}
+
+	TArray<FVector> Occupied;
+	GatherOccupiedLocations(RespawningController, Occupied);
+
+	if (!QuerySpawnIndex(Occupied, OutLocation))
+	{
+		return FindRespawnLocationByTrace(OutLocation);
+	}
+
+	// Reserve spawn so simultaneous respawns spread out
+	RecentSpawns.Emplace(OutLocation, GetWorld()->GetTimeSeconds());
+	return true;
+}
+
+void AFPSGameMode::BenchmarkSpawnQueries(int32 NumQueries)
+{
+	if (!HasAuthority() || SpawnCells.Num() == 0 || NumQueries <= 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AFPSGameMode::BenchmarkSpawnQueries - Requires authority and a built spawn index"));
+		return;
+	}
+
+	// Simulate mass respawn waves: every query reserves its result like a real respawn would,
+	// reservations reset every MassRespawnWaveSize queries (reservation window expired)
+	const int32 MassRespawnWaveSize = 64;
+	TArray<FVector> Occupied;
+	GatherOccupiedLocations(nullptr, Occupied);
+	const int32 NumPlayers = Occupied.Num();
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	FVector Location;
+	for (int32 Query = 0; Query < NumQueries; ++Query)
+	{
+		if (QuerySpawnIndex(Occupied, Location))
+		{
+			Occupied.Add(Location);
+		}
+
+		if ((Query + 1) % MassRespawnWaveSize == 0)
+		{
+			Occupied.SetNum(NumPlayers);
+		}
+	}
+
+	const double TotalMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+	UE_LOG(LogTemp, Log, TEXT("AFPSGameMode::BenchmarkSpawnQueries - %d queries, %d cells, %d candidates, %d initial occupied: %.3f ms total, %.2f us/query"),
+		NumQueries, SpawnCells.Num(), SpawnCandidates.Num(), NumPlayers, TotalMs, TotalMs * 1000.0 / NumQueries);
+}
+
+bool AFPSGameMode::FindRespawnLocationByTrace(FVector& OutLocation)
 {
 	if (!HasAuthority())
 	{
@@ -182,3 +501,92 @@ bool AFPSGameMode::FindRespawnLocation(FVector& OutLocation)
 
 	return false;
 }
+
+// ============================================
+// COMBAT REPLAY / BENCHMARKS
+// ============================================
+
+void AFPSGameMode::ReplayCombat(const FString& FilePath, const FString& ExpectedDigest)
+{
+	if (GetNetMode() != NM_Standalone)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FPSGameMode::ReplayCombat() - Run standalone (no networking) for reproducible timings"));
+	}
+
+	if (UFPSCombatReplaySubsystem* Replay = GetWorld()->GetSubsystem<UFPSCombatReplaySubsystem>())
+	{
+		Replay->Replay(FilePath, ExpectedDigest);
+	}
+}
+
+void AFPSGameMode::BenchmarkHitboxes(int32 NumPlayers, int32 NumRays)
+{
+	if (UFPSHitboxSubsystem* Hitboxes = GetWorld()->GetSubsystem<UFPSHitboxSubsystem>())
+	{
+		Hitboxes->Benchmark(NumPlayers, NumRays);
+	}
+}
+
+// ============================================
+// LOAD TEST REPORT
+// ============================================
+
+void AFPSGameMode::StartLoadReport(float Interval)
+{
+	LoadReportInterval = FMath::Max(Interval, 0.0f);
+	LoadReportElapsed = 0.0f;
+	LoadReportGameThreadMs = 0.0;
+	LoadReportMaxGameThreadMs = 0.0;
+	LoadReportFrames = 0;
+
+	SetActorTickEnabled(LoadReportInterval > 0.0f);
+
+	UE_LOG(LogTemp, Log, TEXT("FPSGameMode::StartLoadReport() - Interval=%.1fs (%s)"),
+		LoadReportInterval, LoadReportInterval > 0.0f ? TEXT("enabled") : TEXT("disabled"));
+}
+
+void AFPSGameMode::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	if (LoadReportInterval <= 0.0f)
+	{
+		return;
+	}
+
+	// Game thread work of the previous frame (excludes max-tick-rate idle wait)
+	const double GameThreadMs = FPlatformTime::ToMilliseconds(GGameThreadTime);
+
+	LoadReportElapsed += DeltaSeconds;
+	LoadReportGameThreadMs += GameThreadMs;
+	LoadReportMaxGameThreadMs = FMath::Max(LoadReportMaxGameThreadMs, GameThreadMs);
+	LoadReportFrames++;
+
+	if (LoadReportElapsed < LoadReportInterval)
+	{
+		return;
+	}
+
+	// NetDriver keeps per-second rates (updated once per second)
+	uint32 InBytesPerSecond = 0;
+	uint32 OutBytesPerSecond = 0;
+	if (const UNetDriver* NetDriver = GetWorld()->GetNetDriver())
+	{
+		InBytesPerSecond = NetDriver->InBytesPerSecond;
+		OutBytesPerSecond = NetDriver->OutBytesPerSecond;
+	}
+
+	// Machine-parsable line - grep "LoadReport," from server log
+	UE_LOG(LogTemp, Log, TEXT("LoadReport,%d,%.2f,%.2f,%.2f,%u,%u"),
+		GetNumPlayers(),
+		LoadReportElapsed / LoadReportFrames * 1000.0f,
+		LoadReportGameThreadMs / LoadReportFrames,
+		LoadReportMaxGameThreadMs,
+		InBytesPerSecond,
+		OutBytesPerSecond);
+
+	LoadReportElapsed = 0.0f;
+	LoadReportGameThreadMs = 0.0;
+	LoadReportMaxGameThreadMs = 0.0;
+	LoadReportFrames = 0;
+}
@@ -6,15 +6,39 @@
 #include "GameFramework/HUD.h"
 #include "GameFramework/GameModeBase.h"
 #include "Interfaces/GameModeDeathInterface.h"
+#include "Components/BotDriverComponent.h"
+#include "UI/HUDViewModel.h"
+#include "Misc/CommandLine.h"
 
 AFPSPlayerController::AFPSPlayerController()
 {
 	PrimaryActorTick.bCanEverTick = true;
+
+	HUDViewModel = CreateDefaultSubobject<UHUDViewModel>(TEXT("HUDViewModel"));
 }
 
 void AFPSPlayerController::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// HUD exists only for local players - flush batched HUD state once per frame
+	if (IsLocalController() && HUDViewModel)
+	{
+		HUDViewModel->BindToWorld(GetWorld(), this);
+	}
+
+	// Load-test client: scripted input instead of a human (-FPSBot [-FPSBotSeed=N])
+	if (IsLocalController() && FParse::Param(FCommandLine::Get(), TEXT("FPSBot")))
+	{
+		UBotDriverComponent* BotDriver = NewObject<UBotDriverComponent>(this, TEXT("BotDriver"));
+
+		int32 Seed = FPlatformProcess::GetCurrentProcessId();
+		FParse::Value(FCommandLine::Get(), TEXT("FPSBotSeed="), Seed);
+		BotDriver->SetSeed(Seed);
+		BotDriver->RegisterComponent();
+
+		UE_LOG(LogTemp, Log, TEXT("FPSPlayerController::BeginPlay() - Bot driver enabled (Seed=%d)"), Seed);
+	}
 }
 
 void AFPSPlayerController::SetupInputMapping()
@@ -41,6 +65,11 @@ void AFPSPlayerController::SetupInputMapping()
 
 void AFPSPlayerController::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	if (HUDViewModel)
+	{
+		HUDViewModel->UnbindFromWorld();
+	}
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -77,15 +106,20 @@ void AFPSPlayerController::OnUnPossess()
 
 void AFPSPlayerController::UpdateHealth_Implementation(float Health)
 {
-	AHUD* HUD = GetHUD();
-	if (HUD && HUD->Implements<UPlayerHUDInterface>())
+	if (HUDViewModel)
 	{
-		IPlayerHUDInterface::Execute_UpdateHealth(HUD, Health);
+		HUDViewModel->SetHealth(Health);
 	}
 }
 
 float AFPSPlayerController::GetHealth_Implementation()
 {
+	// Pending (unflushed) value is the current one
+	if (HUDViewModel && HUDViewModel->HasHealth())
+	{
+		return HUDViewModel->GetHealth();
+	}
+
 	AHUD* HUD = GetHUD();
 	if (HUD && HUD->Implements<UPlayerHUDInterface>())
 	{
@@ -105,28 +139,33 @@ void AFPSPlayerController::AddDamageEffect_Implementation()
 
 void AFPSPlayerController::UpdateActiveItem_Implementation(AActor* ActiveItem)
 {
-	AHUD* HUD = GetHUD();
-	if (HUD && HUD->Implements<UPlayerHUDInterface>())
+	if (HUDViewModel)
 	{
-		IPlayerHUDInterface::Execute_UpdateActiveItem(HUD, ActiveItem);
+		HUDViewModel->SetActiveItem(ActiveItem);
 	}
 }
 
 void AFPSPlayerController::UpdateInventory_Implementation(const TArray<AActor*>& Items)
 {
-	AHUD* HUD = GetHUD();
-	if (HUD && HUD->Implements<UPlayerHUDInterface>())
+	if (HUDViewModel)
 	{
-		IPlayerHUDInterface::Execute_UpdateInventory(HUD, Items);
+		HUDViewModel->SetInventory(Items);
 	}
 }
 
 void AFPSPlayerController::UpdateCrossHair_Implementation(bool IsAim, float LeanAlpha)
 {
-	AHUD* HUD = GetHUD();
-	if (HUD && HUD->Implements<UPlayerHUDInterface>())
+	if (HUDViewModel)
+	{
+		HUDViewModel->SetCrossHair(IsAim, LeanAlpha);
+	}
+}
+
+void AFPSPlayerController::UpdateAimOffset_Implementation(UMaterialParameterCollection* Collection, FVector Offset)
+{
+	if (HUDViewModel)
 	{
-		IPlayerHUDInterface::Execute_UpdateCrossHair(HUD, IsAim, LeanAlpha);
+		HUDViewModel->SetAimOffset(Collection, Offset);
 	}
 }
 
@@ -137,6 +176,12 @@ void AFPSPlayerController::SetCrossHair_Implementation(TSubclassOf<UUserWidget>
 	{
 		IPlayerHUDInterface::Execute_SetCrossHair(HUD, CrossHairWidgetClass, AimCrossHairWidgetClass);
 	}
+
+	// New crosshair widgets start without state - re-push on next flush
+	if (HUDViewModel)
+	{
+		HUDViewModel->MarkCrossHairDirty();
+	}
 }
 
 void AFPSPlayerController::SetHUDVisibility_Implementation(bool Visibility)
@@ -146,14 +191,19 @@ void AFPSPlayerController::SetHUDVisibility_Implementation(bool Visibility)
 	{
 		IPlayerHUDInterface::Execute_SetHUDVisibility(HUD, Visibility);
 	}
+
+	// HUD shown again (respawn) - re-push everything on next flush
+	if (Visibility && HUDViewModel)
+	{
+		HUDViewModel->MarkAllDirty();
+	}
 }
 
 void AFPSPlayerController::UpdateItemInfo_Implementation(const FString& Info)
 {
-	AHUD* HUD = GetHUD();
-	if (HUD && HUD->Implements<UPlayerHUDInterface>())
+	if (HUDViewModel)
 	{
-		IPlayerHUDInterface::Execute_UpdateItemInfo(HUD, Info);
+		HUDViewModel->SetItemInfo(Info);
 	}
 }
 
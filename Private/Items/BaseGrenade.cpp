@@ -7,6 +7,9 @@
 #include "Interfaces/CharacterMeshProviderInterface.h"
 #include "Core/FPSGameplayTags.h"
 #include "Net/UnrealNetwork.h"
+#include "Core/FPSCoreStats.h"
+#include "Components/DroppedItemComponent.h"
+#include "Components/ThrowArcPreviewComponent.h"
 
 ABaseGrenade::ABaseGrenade()
 {
@@ -61,6 +64,12 @@ ABaseGrenade::ABaseGrenade()
 	// Performance optimizations
 	TPSMesh->bEnableUpdateRateOptimizations = true;
 	TPSMesh->bComponentUseFixedSkelBounds = true;
+
+	DroppedItemComponent = CreateDefaultSubobject<UDroppedItemComponent>(TEXT("DroppedItemComponent"));
+
+	// Throw arc preview - world-space instances, activated for the local holder only
+	ThrowArcPreview = CreateDefaultSubobject<UThrowArcPreviewComponent>(TEXT("ThrowArcPreview"));
+	ThrowArcPreview->SetupAttachment(SceneRoot);
 }
 
 void ABaseGrenade::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -77,6 +86,8 @@ void ABaseGrenade::BeginPlay()
 
 void ABaseGrenade::OnRep_Owner()
 {
+	FPSCORE_SCOPE_ONREP(ABaseGrenade_OnRep_Owner);
+
 	Super::OnRep_Owner();
 
 	// Setup visibility when owner replicates
@@ -88,10 +99,16 @@ void ABaseGrenade::OnRep_Owner()
 
 void ABaseGrenade::OnRep_HasThrown()
 {
+	FPSCORE_SCOPE_ONREP(ABaseGrenade_OnRep_HasThrown);
+
 	// Client callback when bHasThrown replicates
 	// Hide meshes since grenade has been thrown
 	if (bHasThrown)
 	{
+		if (ThrowArcPreview)
+		{
+			ThrowArcPreview->HidePreview();
+		}
 		if (FPSMesh)
 		{
 			FPSMesh->SetVisibility(false);
@@ -119,6 +136,12 @@ void ABaseGrenade::OnEquipped_Implementation(APawn* NewOwner)
 
 	// Setup visibility
 	SetupMeshVisibility();
+
+	// Arc preview for the holding player only
+	if (ThrowArcPreview && NewOwner->IsLocallyControlled() && !bHasThrown)
+	{
+		ThrowArcPreview->ShowPreview(ProjectileClass);
+	}
 }
 
 void ABaseGrenade::OnUnequipped_Implementation()
@@ -127,6 +150,11 @@ void ABaseGrenade::OnUnequipped_Implementation()
 	bIsEquipping = false;
 	bIsUnequipping = false;
 	bIsThrowing = false;
+
+	if (ThrowArcPreview)
+	{
+		ThrowArcPreview->HidePreview();
+	}
 }
 
 void ABaseGrenade::SetFPSMeshVisibility_Implementation(bool bVisible)
@@ -192,6 +220,12 @@ void ABaseGrenade::UseStart_Implementation(const FUseContext& Ctx)
 	// Server will authorize the actual throw via Server_StartThrow
 	bIsThrowing = true;
 
+	// Throw committed - preview no longer needed
+	if (ThrowArcPreview)
+	{
+		ThrowArcPreview->HidePreview();
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("[GRENADE_THROW] UseStart - Calling Server_StartThrow"));
 
 	// Client calls Server_StartThrow - server will validate and trigger multicast
@@ -201,6 +235,8 @@ void ABaseGrenade::UseStart_Implementation(const FUseContext& Ctx)
 
 void ABaseGrenade::Server_StartThrow_Implementation()
 {
+	FPSCORE_SCOPE_RPC(ABaseGrenade_Server_StartThrow);
+
 	UE_LOG(LogTemp, Log, TEXT("[GRENADE_THROW] Server_StartThrow - %s - bHasThrown=%d, bIsThrowing=%d, bIsEquipping=%d, bIsUnequipping=%d, HasAuthority=%d"),
 		*GetName(), bHasThrown, bIsThrowing, bIsEquipping, bIsUnequipping, HasAuthority());
 
@@ -255,6 +291,11 @@ void ABaseGrenade::OnDropped_Implementation(const FInteractionContext& Ctx)
 	// Reset visibility for world pickup
 	ResetVisibilityForWorld();
 
+	if (ThrowArcPreview)
+	{
+		ThrowArcPreview->HidePreview();
+	}
+
 	// Re-enable TPS mesh physics for world pickup
 	if (TPSMesh)
 	{
@@ -310,58 +351,52 @@ void ABaseGrenade::OnThrowRelease_Implementation()
 		return;
 	}
 
-	// Get spawn location from character's Arms mesh socket (grenade is attached there)
-	FVector SpawnLocation = FVector::ZeroVector;
+	// Spawn location from Arms socket, direction from camera (same launch the arc preview shows)
+	FVector SpawnLocation;
+	FVector ThrowDirection;
+	if (!IThrowableInterface::Execute_GetThrowLaunch(this, SpawnLocation, ThrowDirection))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ABaseGrenade::OnThrowRelease - Socket %s / view point unavailable, using fallback launch: %s, %s"),
+			*CharacterAttachSocket.ToString(), *SpawnLocation.ToString(), *ThrowDirection.ToString());
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[GRENADE_THROW] OnThrowRelease - Calling Server_ExecuteThrow, SpawnLocation=%s, ThrowDirection=%s"),
+		*SpawnLocation.ToString(), *ThrowDirection.ToString());
 
-	// Try to get spawn location from character's Arms mesh
-	if (CurrentOwner->Implements<UCharacterMeshProviderInterface>())
+	// Request server to execute throw
+	Server_ExecuteThrow(SpawnLocation, ThrowDirection);
+}
+
+bool ABaseGrenade::GetThrowLaunch_Implementation(FVector& OutLocation, FVector& OutDirection) const
+{
+	APawn* CurrentOwner = Cast<APawn>(GetOwner());
+	bool bFromSocket = false;
+	bool bFromViewPoint = false;
+
+	// Spawn location from character's Arms mesh socket (grenade is attached there), fallback actor location
+	OutLocation = GetActorLocation();
+	if (CurrentOwner && CurrentOwner->Implements<UCharacterMeshProviderInterface>())
 	{
 		USkeletalMeshComponent* ArmsMesh = ICharacterMeshProviderInterface::Execute_GetArmsMesh(CurrentOwner);
 		if (ArmsMesh && ArmsMesh->DoesSocketExist(CharacterAttachSocket))
 		{
-			SpawnLocation = ArmsMesh->GetSocketLocation(CharacterAttachSocket);
-			UE_LOG(LogTemp, Verbose, TEXT("ABaseGrenade::OnThrowRelease - SpawnLocation from Arms socket %s: %s"),
-				*CharacterAttachSocket.ToString(), *SpawnLocation.ToString());
-		}
-		else
-		{
-			// Fallback to actor location
-			SpawnLocation = GetActorLocation();
-			UE_LOG(LogTemp, Warning, TEXT("ABaseGrenade::OnThrowRelease - Socket %s not found on Arms mesh, using actor location: %s"),
-				*CharacterAttachSocket.ToString(), *SpawnLocation.ToString());
+			OutLocation = ArmsMesh->GetSocketLocation(CharacterAttachSocket);
+			bFromSocket = true;
 		}
 	}
-	else
-	{
-		// Fallback to actor location
-		SpawnLocation = GetActorLocation();
-		UE_LOG(LogTemp, Warning, TEXT("ABaseGrenade::OnThrowRelease - Pawn doesn't implement CharacterMeshProviderInterface, using actor location: %s"),
-			*SpawnLocation.ToString());
-	}
 
-	// Get throw direction from camera via IViewPointProviderInterface
-	FVector ThrowDirection = FVector::ForwardVector;
-	if (CurrentOwner->Implements<UViewPointProviderInterface>())
+	// Direction from camera via IViewPointProviderInterface, fallback pawn forward
+	OutDirection = CurrentOwner ? CurrentOwner->GetActorForwardVector() : GetActorForwardVector();
+	if (CurrentOwner && CurrentOwner->Implements<UViewPointProviderInterface>())
 	{
 		FVector CameraLocation;
 		FRotator CameraRotation;
 		IViewPointProviderInterface::Execute_GetShootingViewPoint(CurrentOwner, CameraLocation, CameraRotation);
-		ThrowDirection = CameraRotation.Vector();
-		UE_LOG(LogTemp, Verbose, TEXT("ABaseGrenade::OnThrowRelease - ThrowDirection from camera: %s"), *ThrowDirection.ToString());
-	}
-	else
-	{
-		// Fallback to pawn forward
-		ThrowDirection = CurrentOwner->GetActorForwardVector();
-		UE_LOG(LogTemp, Warning, TEXT("ABaseGrenade::OnThrowRelease - Pawn doesn't implement ViewPointProviderInterface, using forward: %s"),
-			*ThrowDirection.ToString());
+		OutDirection = CameraRotation.Vector();
+		bFromViewPoint = true;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("[GRENADE_THROW] OnThrowRelease - Calling Server_ExecuteThrow, SpawnLocation=%s, ThrowDirection=%s"),
-		*SpawnLocation.ToString(), *ThrowDirection.ToString());
-
-	// Request server to execute throw
-	Server_ExecuteThrow(SpawnLocation, ThrowDirection);
+	return bFromSocket && bFromViewPoint;
 }
 
 bool ABaseGrenade::CanThrow_Implementation() const
@@ -383,6 +418,8 @@ bool ABaseGrenade::CanThrow_Implementation() const
 
 void ABaseGrenade::Server_ExecuteThrow_Implementation(FVector SpawnLocation, FVector ThrowDirection)
 {
+	FPSCORE_SCOPE_RPC(ABaseGrenade_Server_ExecuteThrow);
+
 	UE_LOG(LogTemp, Log, TEXT("[GRENADE_THROW] Server_ExecuteThrow - %s - SpawnLocation=%s, ThrowDirection=%s, HasAuthority=%d, bHasThrown=%d"),
 		*GetName(), *SpawnLocation.ToString(), *ThrowDirection.ToString(), HasAuthority(), bHasThrown);
 
@@ -504,6 +541,8 @@ AActor* ABaseGrenade::SpawnProjectile(FVector SpawnLocation, FVector ThrowDirect
 
 void ABaseGrenade::Multicast_PlayThrowEffects_Implementation()
 {
+	FPSCORE_SCOPE_RPC(ABaseGrenade_Multicast_PlayThrowEffects);
+
 	// ============================================
 	// STEP 1: DETERMINE VIEW PERSPECTIVE
 	// ============================================
@@ -11,16 +11,36 @@
 #include "NiagaraSystem.h"
 #include "NiagaraComponent.h"
 #include "Net/UnrealNetwork.h"
+#include "GameFramework/GameStateBase.h"
+#include "Core/FPSCoreStats.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogGrenadeProjectile, Log, All);
 
+// Server world time (segment clock shared by server and clients)
+static float GetServerWorldTime(const UWorld* World)
+{
+	const AGameStateBase* GameState = World ? World->GetGameState() : nullptr;
+	if (GameState)
+	{
+		return static_cast<float>(GameState->GetServerWorldTimeSeconds());
+	}
+
+	return World ? World->GetTimeSeconds() : 0.0f;
+}
+
 AGrenadeProjectile::AGrenadeProjectile()
 {
 	PrimaryActorTick.bCanEverTick = false;
 
 	// Replication setup - projectile must replicate to all clients
+	// Movement is simulated locally from LaunchState, not streamed
 	bReplicates = true;
 	bAlwaysRelevant = true;
+	SetReplicateMovement(false);
+
+	// Properties change only per flight segment (ForceNetUpdate on change)
+	SetNetUpdateFrequency(10.0f);
+	SetMinNetUpdateFrequency(2.0f);
 
 	// Create collision component (root)
 	CollisionComponent = CreateDefaultSubobject<USphereComponent>(TEXT("CollisionComponent"));
@@ -50,6 +70,10 @@ AGrenadeProjectile::AGrenadeProjectile()
 	ProjectileMovement->Friction = Friction;
 	ProjectileMovement->ProjectileGravityScale = GravityScale;
 
+	// Fixed integration step - server and clients step the same trajectory regardless of frame rate
+	ProjectileMovement->bForceSubStepping = true;
+	ProjectileMovement->MaxSimulationTimeStep = 1.0f / 60.0f;
+
 	// Don't auto-activate - we'll set velocity in InitializeThrow
 	ProjectileMovement->bAutoActivate = true;
 }
@@ -59,6 +83,7 @@ void AGrenadeProjectile::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& O
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
 	DOREPLIFETIME(AGrenadeProjectile, bHasExploded);
+	DOREPLIFETIME(AGrenadeProjectile, LaunchState);
 }
 
 void AGrenadeProjectile::BeginPlay()
@@ -71,11 +96,20 @@ void AGrenadeProjectile::BeginPlay()
 		ProjectileMovement->Bounciness = Bounciness;
 		ProjectileMovement->Friction = Friction;
 		ProjectileMovement->ProjectileGravityScale = GravityScale;
+
+		// Server decides segment boundaries
+		if (HasAuthority())
+		{
+			ProjectileMovement->OnProjectileBounce.AddDynamic(this, &AGrenadeProjectile::OnProjectileBounce);
+			ProjectileMovement->OnProjectileStop.AddDynamic(this, &AGrenadeProjectile::OnProjectileStop);
+		}
 	}
 }
 
 void AGrenadeProjectile::OnRep_HasExploded()
 {
+	FPSCORE_SCOPE_ONREP(AGrenadeProjectile_OnRep_HasExploded);
+
 	// For late-joiners: if grenade already exploded, hide the mesh
 	if (bHasExploded)
 	{
@@ -124,7 +158,137 @@ void AGrenadeProjectile::InitializeProjectile_Implementation(APawn* InInstigator
 		);
 
 		UE_LOG(LogGrenadeProjectile, Log, TEXT("InitializeProjectile - Fuse started, %.1fs until explosion"), FuseTime);
+
+		// First segment - clients fly the whole throw from this
+		if (ProjectileMovement)
+		{
+			SetLaunchState(GetActorLocation(), ProjectileMovement->Velocity);
+		}
+	}
+}
+
+// ============================================
+// FLIGHT REPLICATION
+// ============================================
+
+void AGrenadeProjectile::SetLaunchState(const FVector& Origin, const FVector& Velocity)
+{
+	// SERVER ONLY
+	if (!HasAuthority())
+	{
+		return;
+	}
+
+	LaunchState.Origin = Origin;
+	LaunchState.Velocity = Velocity;
+	LaunchState.ServerTime = GetServerWorldTime(GetWorld());
+	LaunchState.Bounciness = ProjectileMovement ? ProjectileMovement->Bounciness : Bounciness;
+	LaunchState.Friction = ProjectileMovement ? ProjectileMovement->Friction : Friction;
+	LaunchState.GravityScale = ProjectileMovement ? ProjectileMovement->ProjectileGravityScale : GravityScale;
+	LaunchState.Segment = LaunchState.Segment == MAX_uint8 ? 1 : LaunchState.Segment + 1;
+
+	ForceNetUpdate();
+}
+
+void AGrenadeProjectile::OnProjectileBounce(const FHitResult& ImpactResult, const FVector& ImpactVelocity)
+{
+	if (!HasAuthority() || bHasExploded || !ProjectileMovement)
+	{
+		return;
+	}
+
+	// Rolling / micro-bounces: clients stay close enough, rest state settles them
+	if (ProjectileMovement->Velocity.SizeSquared() < FMath::Square(MinBounceCorrectionSpeed))
+	{
+		return;
+	}
+
+	SetLaunchState(GetActorLocation(), ProjectileMovement->Velocity);
+}
+
+void AGrenadeProjectile::OnProjectileStop(const FHitResult& ImpactResult)
+{
+	if (!HasAuthority() || bHasExploded)
+	{
+		return;
 	}
+
+	SetLaunchState(GetActorLocation(), FVector::ZeroVector);
+}
+
+void AGrenadeProjectile::OnRep_LaunchState()
+{
+	FPSCORE_SCOPE_ONREP(AGrenadeProjectile_OnRep_LaunchState);
+
+	if (!bHasExploded)
+	{
+		ApplyLaunchState();
+	}
+}
+
+void AGrenadeProjectile::ApplyLaunchState()
+{
+	if (!ProjectileMovement || !CollisionComponent || LaunchState.Segment == 0)
+	{
+		return;
+	}
+
+	// Simulate with server tuning (Blueprint / runtime overrides included)
+	ProjectileMovement->Bounciness = LaunchState.Bounciness;
+	ProjectileMovement->Friction = LaunchState.Friction;
+	ProjectileMovement->ProjectileGravityScale = LaunchState.GravityScale;
+
+	const bool bAtRest = LaunchState.Velocity.IsNearlyZero();
+	const float Elapsed = FMath::Max(0.0f, GetServerWorldTime(GetWorld()) - LaunchState.ServerTime);
+	const FVector ExpectedLocation = bAtRest ? FVector(LaunchState.Origin) : PredictSegmentLocation(Elapsed);
+
+	// Local simulation still agrees - keep it (no visible correction)
+	if (FVector::DistSquared(GetActorLocation(), ExpectedLocation) <= FMath::Square(CorrectionTolerance))
+	{
+		if (bAtRest)
+		{
+			ProjectileMovement->StopMovementImmediately();
+		}
+		return;
+	}
+
+	if (bAtRest)
+	{
+		SetActorLocation(ExpectedLocation);
+		ProjectileMovement->StopMovementImmediately();
+		return;
+	}
+
+	// Diverged: rebase on server segment, sweep to where it is now (stops at first blocking hit)
+	SetActorLocation(LaunchState.Origin);
+	SetActorLocation(ExpectedLocation, true);
+
+	// Local sim may have already stopped (StopSimulating clears UpdatedComponent)
+	if (!ProjectileMovement->UpdatedComponent)
+	{
+		ProjectileMovement->SetUpdatedComponent(CollisionComponent);
+	}
+
+	ProjectileMovement->Velocity = FVector(LaunchState.Velocity) + FVector(0.0f, 0.0f, ProjectileMovement->GetGravityZ() * Elapsed);
+	ProjectileMovement->UpdateComponentVelocity();
+	ProjectileMovement->SetActive(true);
+}
+
+FGrenadeLaunchState AGrenadeProjectile::MakeLaunchState(const FVector& Origin, const FVector& Direction) const
+{
+	FGrenadeLaunchState State;
+	State.Origin = Origin;
+	State.Velocity = Direction.GetSafeNormal() * (ProjectileMovement ? ProjectileMovement->InitialSpeed : 0.0f);
+	State.Bounciness = Bounciness;
+	State.Friction = Friction;
+	State.GravityScale = GravityScale;
+	return State;
+}
+
+FVector AGrenadeProjectile::PredictSegmentLocation(float Elapsed) const
+{
+	const float GravityZ = ProjectileMovement ? ProjectileMovement->GetGravityZ() : 0.0f;
+	return FVector(LaunchState.Origin) + FVector(LaunchState.Velocity) * Elapsed + FVector(0.0f, 0.0f, 0.5f * GravityZ * Elapsed * Elapsed);
 }
 
 void AGrenadeProjectile::OnFuseExpired()
@@ -156,7 +320,7 @@ void AGrenadeProjectile::OnFuseExpired()
 
 	// Play effects on all clients
 	UE_LOG(LogGrenadeProjectile, Log, TEXT("OnFuseExpired - Calling Multicast_PlayExplosionEffects"));
-	Multicast_PlayExplosionEffects();
+	Multicast_PlayExplosionEffects(GetActorLocation());
 
 	// Start destroy timer
 	StartDestroyTimer();
@@ -164,6 +328,8 @@ void AGrenadeProjectile::OnFuseExpired()
 
 void AGrenadeProjectile::ApplyExplosionDamage()
 {
+	FPSCORE_SCOPE_CYCLE(STAT_FPSCore_ExplosionDamage);
+
 	// SERVER ONLY
 	if (!HasAuthority())
 	{
@@ -218,14 +384,22 @@ void AGrenadeProjectile::ApplyExplosionDamage()
 
 }
 
-void AGrenadeProjectile::Multicast_PlayExplosionEffects_Implementation()
+void AGrenadeProjectile::Multicast_PlayExplosionEffects_Implementation(FVector_NetQuantize ExplosionLocation)
 {
+	FPSCORE_SCOPE_RPC(AGrenadeProjectile_Multicast_PlayExplosionEffects);
+
+	// Detonation is authoritative - remove any residual local simulation error
+	if (!HasAuthority())
+	{
+		SetActorLocation(ExplosionLocation);
+	}
+
 	if (ExplosionVFX)
 	{
 		UNiagaraFunctionLibrary::SpawnSystemAtLocation(
 			GetWorld(),
 			ExplosionVFX,
-			GetActorLocation(),
+			ExplosionLocation,
 			FRotator::ZeroRotator,
 			FVector(1.0f),
 			true,
@@ -0,0 +1,250 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UI/HUDViewModel.h"
+#include "Interfaces/PlayerHUDInterface.h"
+#include "GameFramework/HUD.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/KismetMaterialLibrary.h"
+#include "Materials/MaterialParameterCollection.h"
+#include "Engine/World.h"
+#include "Core/FPSCoreStats.h"
+
+// MPC_Aim vector parameter (see AFPSCharacter::MPC_Aim)
+static const FName AimOffsetParameterName(TEXT("OffsetDirection"));
+
+// ============================================
+// SETTERS
+// ============================================
+
+void UHUDViewModel::SetHealth(float InHealth)
+{
+	if (bHasHealth && Health == InHealth)
+	{
+		return;
+	}
+
+	Health = InHealth;
+	bHasHealth = true;
+	bHealthDirty = true;
+}
+
+void UHUDViewModel::SetActiveItem(AActor* InActiveItem)
+{
+	// Event-driven (equip / unequip / death) - always forwarded, weak pointer may already be stale
+	ActiveItem = InActiveItem;
+	bHasActiveItem = true;
+	bActiveItemDirty = true;
+}
+
+void UHUDViewModel::SetInventory(const TArray<AActor*>& InItems)
+{
+	bool bChanged = !bHasInventory || Inventory.Num() != InItems.Num();
+	for (int32 Index = 0; !bChanged && Index < InItems.Num(); ++Index)
+	{
+		bChanged = Inventory[Index].Get() != InItems[Index];
+	}
+
+	if (!bChanged)
+	{
+		return;
+	}
+
+	Inventory.Reset(InItems.Num());
+	for (AActor* Item : InItems)
+	{
+		Inventory.Add(Item);
+	}
+
+	bHasInventory = true;
+	bInventoryDirty = true;
+}
+
+void UHUDViewModel::SetCrossHair(bool bInIsAim, float InLeanAlpha)
+{
+	bIsAim = bInIsAim;
+	LeanAlpha = InLeanAlpha;
+
+	// Endpoints always land exactly (crosshair fully closed / fully open)
+	const bool bReachedEndpoint = (InLeanAlpha == 0.0f || InLeanAlpha == 1.0f) && InLeanAlpha != FlushedLeanAlpha;
+
+	if (!bHasCrossHair
+		|| bInIsAim != bFlushedIsAim
+		|| bReachedEndpoint
+		|| FMath::Abs(InLeanAlpha - FlushedLeanAlpha) >= CrossHairAlphaThreshold)
+	{
+		bCrossHairDirty = true;
+	}
+
+	bHasCrossHair = true;
+}
+
+void UHUDViewModel::SetItemInfo(const FString& InInfo)
+{
+	if (ItemInfo.Equals(InInfo, ESearchCase::CaseSensitive))
+	{
+		return;
+	}
+
+	ItemInfo = InInfo;
+	bItemInfoDirty = true;
+}
+
+void UHUDViewModel::SetAimOffset(UMaterialParameterCollection* InCollection, const FVector& InOffset)
+{
+	AimOffset = InOffset;
+
+	const bool bCollectionChanged = AimCollection.Get() != InCollection;
+	AimCollection = InCollection;
+
+	// Zero always lands exactly (no residual sway in the shader at rest)
+	const bool bReachedZero = InOffset.IsZero() && !FlushedAimOffset.IsZero();
+
+	if (!bHasAimOffset
+		|| bCollectionChanged
+		|| bReachedZero
+		|| !InOffset.Equals(FlushedAimOffset, AimOffsetThreshold))
+	{
+		bAimOffsetDirty = true;
+	}
+
+	bHasAimOffset = true;
+}
+
+void UHUDViewModel::MarkAllDirty()
+{
+	bHealthDirty = bHasHealth;
+	bActiveItemDirty = bHasActiveItem;
+	bInventoryDirty = bHasInventory;
+	bCrossHairDirty = bHasCrossHair;
+	bItemInfoDirty = true;
+	bAimOffsetDirty = bHasAimOffset;
+}
+
+// ============================================
+// FLUSH
+// ============================================
+
+void UHUDViewModel::BindToWorld(UWorld* World, APlayerController* InOwner)
+{
+	UnbindFromWorld();
+
+	if (!World || !InOwner)
+	{
+		return;
+	}
+
+	BoundWorld = World;
+	OwnerController = InOwner;
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UHUDViewModel::OnWorldPostActorTick);
+}
+
+void UHUDViewModel::UnbindFromWorld()
+{
+	if (PostActorTickHandle.IsValid())
+	{
+		FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+		PostActorTickHandle.Reset();
+	}
+
+	BoundWorld.Reset();
+}
+
+void UHUDViewModel::BeginDestroy()
+{
+	UnbindFromWorld();
+
+	Super::BeginDestroy();
+}
+
+void UHUDViewModel::OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World == BoundWorld.Get())
+	{
+		Flush();
+	}
+}
+
+void UHUDViewModel::Flush()
+{
+	// Idle frame - nothing changed, no widget or MPC writes
+	if (!bHealthDirty && !bActiveItemDirty && !bInventoryDirty && !bCrossHairDirty && !bItemInfoDirty && !bAimOffsetDirty)
+	{
+		return;
+	}
+
+	FPSCORE_SCOPE_CYCLE(STAT_FPSCore_HUDFlush);
+
+	// ============================================
+	// MPC (no HUD needed)
+	// ============================================
+	if (bAimOffsetDirty)
+	{
+		UMaterialParameterCollection* Collection = AimCollection.Get();
+		if (Collection && BoundWorld.IsValid())
+		{
+			UKismetMaterialLibrary::SetVectorParameterValue(BoundWorld.Get(), Collection, AimOffsetParameterName, FLinearColor(AimOffset));
+			INC_DWORD_STAT(STAT_FPSCore_HUDWrites);
+		}
+
+		FlushedAimOffset = AimOffset;
+		bAimOffsetDirty = false;
+	}
+
+	// ============================================
+	// HUD WIDGETS
+	// ============================================
+	// HUD not spawned yet - keep flags, values arrive on first flush after it exists
+	APlayerController* PC = OwnerController.Get();
+	AHUD* HUD = PC ? PC->GetHUD() : nullptr;
+	if (!HUD || !HUD->Implements<UPlayerHUDInterface>())
+	{
+		return;
+	}
+
+	if (bHealthDirty)
+	{
+		IPlayerHUDInterface::Execute_UpdateHealth(HUD, Health);
+		INC_DWORD_STAT(STAT_FPSCore_HUDWrites);
+		bHealthDirty = false;
+	}
+
+	if (bActiveItemDirty)
+	{
+		IPlayerHUDInterface::Execute_UpdateActiveItem(HUD, ActiveItem.Get());
+		INC_DWORD_STAT(STAT_FPSCore_HUDWrites);
+		bActiveItemDirty = false;
+	}
+
+	if (bInventoryDirty)
+	{
+		TArray<AActor*> Items;
+		Items.Reserve(Inventory.Num());
+		for (const TWeakObjectPtr<AActor>& Item : Inventory)
+		{
+			if (AActor* ItemActor = Item.Get())
+			{
+				Items.Add(ItemActor);
+			}
+		}
+
+		IPlayerHUDInterface::Execute_UpdateInventory(HUD, Items);
+		INC_DWORD_STAT(STAT_FPSCore_HUDWrites);
+		bInventoryDirty = false;
+	}
+
+	if (bCrossHairDirty)
+	{
+		IPlayerHUDInterface::Execute_UpdateCrossHair(HUD, bIsAim, LeanAlpha);
+		INC_DWORD_STAT(STAT_FPSCore_HUDWrites);
+		FlushedLeanAlpha = LeanAlpha;
+		bFlushedIsAim = bIsAim;
+		bCrossHairDirty = false;
+	}
+
+	if (bItemInfoDirty)
+	{
+		IPlayerHUDInterface::Execute_UpdateItemInfo(HUD, ItemInfo);
+		INC_DWORD_STAT(STAT_FPSCore_HUDWrites);
+		bItemInfoDirty = false;
+	}
+}
@@ -7,6 +7,7 @@
 #include "Components/BallisticsComponent.h"
 #include "Interfaces/AmmoConsumerInterface.h"
 #include "Net/UnrealNetwork.h"
+#include "Core/FPSCoreStats.h"
 
 AHKVP9::AHKVP9()
 {
@@ -16,20 +17,12 @@ AHKVP9::AHKVP9()
 	Name = FText::FromString("HK VP9");
 	Description = FText::FromString("9x19mm Parabellum striker-fired pistol with semi-auto fire mode.");
 
-	// ============================================
-	// CALIBER
-	// ============================================
-	AcceptedCaliberType = EAmmoCaliberType::Parabellum_9x19mm;
-
 	// ============================================
 	// COMPONENTS
 	// ============================================
 
 	// Semi-Auto Fire Component
 	SemiAutoFireComponent = CreateDefaultSubobject<USemiAutoFireComponent>(TEXT("SemiAutoFireComponent"));
-	SemiAutoFireComponent->FireRate = 450.0f;      // 450 RPM max (semi-auto limited by trigger speed)
-	SemiAutoFireComponent->SpreadScale = 0.8f;     // Slightly more accurate than rifles
-	SemiAutoFireComponent->RecoilScale = 0.7f;     // Lower recoil than rifles
 
 	// Assign to BaseWeapon's FireComponent pointer for interface compatibility
 	FireComponent = SemiAutoFireComponent;
@@ -45,20 +38,38 @@ AHKVP9::AHKVP9()
 	// Ballistics Component (standard single-projectile)
 	BallisticsComponent = CreateDefaultSubobject<UBallisticsComponent>(TEXT("BallisticsComponent"));
 
-	// ============================================
-	// AIMING DEFAULTS
-	// ============================================
-	AimFOV = 60.0f;          // Wider FOV than rifles (pistol sights)
-	AimLookSpeed = 0.7f;     // Faster look speed than rifles
-	LeaningScale = 0.8f;     // Slightly less lean (lighter weapon)
-	BreathingScale = 0.6f;   // Less sway (lighter weapon)
-
 	// ============================================
 	// VP9 STATE DEFAULTS
 	// ============================================
 	bSlideLockedBack = false;
 }
 
+const FWeaponDefinition& AHKVP9::GetBuiltInDefinition() const
+{
+	static const FWeaponDefinition Definition = []()
+	{
+		FWeaponDefinition Def = MakeDefaultDefinition();
+
+		// Caliber
+		Def.AcceptedCaliberType = EAmmoCaliberType::Parabellum_9x19mm;
+
+		// Fire
+		Def.FireRate = 450.0f;      // 450 RPM max (semi-auto limited by trigger speed)
+		Def.SpreadScale = 0.8f;     // Slightly more accurate than rifles
+		Def.RecoilScale = 0.7f;     // Lower recoil than rifles
+
+		// Aiming
+		Def.AimFOV = 60.0f;          // Wider FOV than rifles (pistol sights)
+		Def.AimLookSpeed = 0.7f;     // Faster look speed than rifles
+		Def.LeaningScale = 0.8f;     // Slightly less lean (lighter weapon)
+		Def.BreathingScale = 0.6f;   // Less sway (lighter weapon)
+
+		return Def;
+	}();
+
+	return Definition;
+}
+
 // ============================================
 // REPLICATION
 // ============================================
@@ -72,6 +83,8 @@ void AHKVP9::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimePr
 
 void AHKVP9::OnRep_SlideLockedBack()
 {
+	FPSCORE_SCOPE_ONREP(AHKVP9_OnRep_SlideLockedBack);
+
 	ForceUpdateWeaponAnimInstances();
 }
 
@@ -79,10 +92,13 @@ void AHKVP9::OnRep_SlideLockedBack()
 // BASEWEAPON OVERRIDES
 // ============================================
 
-void AHKVP9::Multicast_PlayShootEffects_Implementation()
+void AHKVP9::Multicast_PlayShootEffects_Implementation(
+	FVector_NetQuantize TracerOrigin,
+	FVector_NetQuantizeNormal TracerDirection,
+	float TracerDistance)
 {
-	// Call base implementation (muzzle VFX + character shoot anims)
-	Super::Multicast_PlayShootEffects_Implementation();
+	// Call base implementation (muzzle VFX + tracer + character shoot anims)
+	Super::Multicast_PlayShootEffects_Implementation(TracerOrigin, TracerDirection, TracerDistance);
 
 	// VP9-specific: Play slide shoot montage on weapon meshes
 	// This runs on ALL clients (server + remote clients)
@@ -91,10 +107,11 @@ void AHKVP9::Multicast_PlayShootEffects_Implementation()
 
 void AHKVP9::HandleShotFired_Implementation(
 	FVector_NetQuantize MuzzleLocation,
-	FVector_NetQuantizeNormal Direction)
+	FVector_NetQuantizeNormal Direction,
+	float TraceDistance)
 {
 	// Call base implementation (triggers Multicast_PlayShootEffects for character anims + muzzle VFX)
-	Super::HandleShotFired_Implementation(MuzzleLocation, Direction);
+	Super::HandleShotFired_Implementation(MuzzleLocation, Direction, TraceDistance);
 
 	// SERVER ONLY: Check if magazine is empty after this shot → slide locks back
 	if (HasAuthority())
@@ -7,6 +7,7 @@
 #include "Components/BallisticsComponent.h"
 #include "Interfaces/AmmoConsumerInterface.h"
 #include "Net/UnrealNetwork.h"
+#include "Core/FPSCoreStats.h"
 
 AM4A1::AM4A1()
 {
@@ -16,20 +17,12 @@ AM4A1::AM4A1()
 	Name = FText::FromString("M4A1");
 	Description = FText::FromString("5.56x45mm NATO assault rifle with full-auto fire mode.");
 
-	// ============================================
-	// CALIBER
-	// ============================================
-	AcceptedCaliberType = EAmmoCaliberType::NATO_556x45mm;
-
 	// ============================================
 	// COMPONENTS
 	// ============================================
 
 	// Full-Auto Fire Component
 	FullAutoFireComponent = CreateDefaultSubobject<UFullAutoFireComponent>(TEXT("FullAutoFireComponent"));
-	FullAutoFireComponent->FireRate = 800.0f;      // 800 RPM (real M4A1 spec)
-	FullAutoFireComponent->SpreadScale = 1.0f;     // Normal spread
-	FullAutoFireComponent->RecoilScale = 1.0f;     // Normal recoil
 
 	// Assign to BaseWeapon's FireComponent pointer for interface compatibility
 	FireComponent = FullAutoFireComponent;
@@ -45,14 +38,6 @@ AM4A1::AM4A1()
 	// Ballistics Component (standard single-projectile)
 	BallisticsComponent = CreateDefaultSubobject<UBallisticsComponent>(TEXT("BallisticsComponent"));
 
-	// ============================================
-	// AIMING DEFAULTS
-	// ============================================
-	AimFOV = 50.0f;
-	AimLookSpeed = 0.5f;
-	LeaningScale = 1.0f;
-	BreathingScale = 1.0f;
-
 	// ============================================
 	// M4A1 STATE DEFAULTS
 	// ============================================
@@ -60,6 +45,32 @@ AM4A1::AM4A1()
 	bBoltCarrierOpen = false;
 }
 
+const FWeaponDefinition& AM4A1::GetBuiltInDefinition() const
+{
+	static const FWeaponDefinition Definition = []()
+	{
+		FWeaponDefinition Def = MakeDefaultDefinition();
+
+		// Caliber
+		Def.AcceptedCaliberType = EAmmoCaliberType::NATO_556x45mm;
+
+		// Fire
+		Def.FireRate = 800.0f;      // 800 RPM (real M4A1 spec)
+		Def.SpreadScale = 1.0f;     // Normal spread
+		Def.RecoilScale = 1.0f;     // Normal recoil
+
+		// Aiming
+		Def.AimFOV = 50.0f;
+		Def.AimLookSpeed = 0.5f;
+		Def.LeaningScale = 1.0f;
+		Def.BreathingScale = 1.0f;
+
+		return Def;
+	}();
+
+	return Definition;
+}
+
 // ============================================
 // REPLICATION
 // ============================================
@@ -74,11 +85,15 @@ void AM4A1::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimePro
 
 void AM4A1::OnRep_HasFiredOnce()
 {
+	FPSCORE_SCOPE_ONREP(AM4A1_OnRep_HasFiredOnce);
+
 	ForceUpdateWeaponAnimInstances();
 }
 
 void AM4A1::OnRep_BoltCarrierOpen()
 {
+	FPSCORE_SCOPE_ONREP(AM4A1_OnRep_BoltCarrierOpen);
+
 	ForceUpdateWeaponAnimInstances();
 }
 
@@ -86,10 +101,13 @@ void AM4A1::OnRep_BoltCarrierOpen()
 // BASEWEAPON OVERRIDES
 // ============================================
 
-void AM4A1::Multicast_PlayShootEffects_Implementation()
+void AM4A1::Multicast_PlayShootEffects_Implementation(
+	FVector_NetQuantize TracerOrigin,
+	FVector_NetQuantizeNormal TracerDirection,
+	float TracerDistance)
 {
-	// Call base implementation (muzzle VFX + character shoot anims)
-	Super::Multicast_PlayShootEffects_Implementation();
+	// Call base implementation (muzzle VFX + tracer + character shoot anims)
+	Super::Multicast_PlayShootEffects_Implementation(TracerOrigin, TracerDirection, TracerDistance);
 
 	// M4A1-specific: Play bolt carrier shoot montage on weapon meshes
 	// This runs on ALL clients (server + remote clients)
@@ -98,10 +116,11 @@ void AM4A1::Multicast_PlayShootEffects_Implementation()
 
 void AM4A1::HandleShotFired_Implementation(
 	FVector_NetQuantize MuzzleLocation,
-	FVector_NetQuantizeNormal Direction)
+	FVector_NetQuantizeNormal Direction,
+	float TraceDistance)
 {
 	// Call base implementation (triggers Multicast_PlayShootEffects for character anims + muzzle VFX)
-	Super::HandleShotFired_Implementation(MuzzleLocation, Direction);
+	Super::HandleShotFired_Implementation(MuzzleLocation, Direction, TraceDistance);
 
 	// SERVER ONLY: Update M4A1-specific state
 	if (HasAuthority())
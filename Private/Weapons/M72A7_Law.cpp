@@ -7,8 +7,8 @@
 #include "Interfaces/ViewPointProviderInterface.h"
 #include "Animation/AnimInstance.h"
 #include "Components/SkeletalMeshComponent.h"
-#include "NiagaraFunctionLibrary.h"
 #include "Engine/World.h"
+#include "Core/FPSCoreStats.h"
 
 AM72A7_Law::AM72A7_Law()
 {
@@ -35,14 +35,24 @@ AM72A7_Law::AM72A7_Law()
 	// M72A7 DEFAULTS
 	// ============================================
 	bHasFired = false;
+}
 
-	// ============================================
-	// AIMING DEFAULTS
-	// ============================================
-	AimFOV = 55.0f;
-	AimLookSpeed = 0.6f;
-	LeaningScale = 0.8f;
-	BreathingScale = 1.2f;
+const FWeaponDefinition& AM72A7_Law::GetBuiltInDefinition() const
+{
+	static const FWeaponDefinition Definition = []()
+	{
+		FWeaponDefinition Def = MakeDefaultDefinition();
+
+		// Aiming
+		Def.AimFOV = 55.0f;
+		Def.AimLookSpeed = 0.6f;
+		Def.LeaningScale = 0.8f;
+		Def.BreathingScale = 1.2f;
+
+		return Def;
+	}();
+
+	return Definition;
 }
 
 // ============================================
@@ -59,6 +69,8 @@ void AM72A7_Law::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifeti
 
 void AM72A7_Law::OnRep_HasFired()
 {
+	FPSCORE_SCOPE_ONREP(AM72A7_Law_OnRep_HasFired);
+
 	// Sync DisposableComponent state
 	if (DisposableComponent && bHasFired)
 	{
@@ -68,6 +80,8 @@ void AM72A7_Law::OnRep_HasFired()
 
 void AM72A7_Law::OnRep_IsExpanded()
 {
+	FPSCORE_SCOPE_ONREP(AM72A7_Law_OnRep_IsExpanded);
+
 	// Skip if equip animation already playing (normal equip flow on listen server)
 	if (bIsEquipping)
 	{
@@ -229,6 +243,8 @@ void AM72A7_Law::OnDropped_Implementation(const FInteractionContext& Ctx)
 
 void AM72A7_Law::Server_Fire_Implementation()
 {
+	FPSCORE_SCOPE_RPC(AM72A7_Law_Server_Fire);
+
 	// Validate state
 	if (bHasFired)
 	{
@@ -260,63 +276,9 @@ void AM72A7_Law::Server_Fire_Implementation()
 	// Spawn projectile (SERVER ONLY)
 	SpawnProjectile();
 
-	// Play effects on all clients (calls our overridden Multicast_PlayShootEffects_Implementation)
-	Multicast_PlayShootEffects();
-}
-
-// ============================================
-// BASEWEAPON OVERRIDES
-// ============================================
-
-void AM72A7_Law::Multicast_PlayShootEffects_Implementation()
-{
-	// M72A7 uses custom socket for muzzle flash (ProjectileSpawnSocket instead of "barrel")
-	// We need to spawn muzzle VFX BEFORE calling Super, because Super uses "barrel" socket
-	// Then call Super for character animations only
-
-	const bool bIsDedicatedServer = (GetNetMode() == NM_DedicatedServer);
-
-	// Skip muzzle VFX on dedicated server
-	if (!bIsDedicatedServer && MuzzleFlashNiagara)
-	{
-		AActor* WeaponOwner = GetOwner();
-		APawn* OwnerPawn = WeaponOwner ? Cast<APawn>(WeaponOwner) : nullptr;
-		const bool bIsLocallyControlled = OwnerPawn && OwnerPawn->IsLocallyControlled();
-
-		// Use FPSMesh for owner, TPSMesh for others
-		// Niagara visibility is handled by the mesh it's attached to:
-		// - FPSMesh has OnlyOwnerSee=true, TPSMesh has OwnerNoSee=true
-		USkeletalMeshComponent* TargetMesh = bIsLocallyControlled ? FPSMesh : TPSMesh;
-		if (TargetMesh)
-		{
-			UNiagaraFunctionLibrary::SpawnSystemAttached(
-				MuzzleFlashNiagara,
-				TargetMesh,
-				ProjectileSpawnSocket,  // M72A7-specific socket
-				FVector::ZeroVector,
-				FRotator::ZeroRotator,
-				EAttachLocation::SnapToTarget,
-				true,
-				true,
-				ENCPoolMethod::AutoRelease
-			);
-		}
-
-		// Temporarily clear MuzzleFlashNiagara so Super doesn't spawn another one
-		UNiagaraSystem* OriginalMuzzleFlash = MuzzleFlashNiagara;
-		MuzzleFlashNiagara = nullptr;
-
-		// Call base implementation for character animations
-		Super::Multicast_PlayShootEffects_Implementation();
-
-		// Restore MuzzleFlashNiagara
-		MuzzleFlashNiagara = OriginalMuzzleFlash;
-	}
-	else
-	{
-		// Dedicated server or no muzzle flash - just call Super for animations
-		Super::Multicast_PlayShootEffects_Implementation();
-	}
+	// Play effects on all clients (muzzle flash on ProjectileSpawnSocket via GetMuzzleFlashSocket)
+	// No tracer - the projectile is the visual
+	Multicast_PlayShootEffects(FVector::ZeroVector, FVector::ForwardVector, 0.0f);
 }
 
 // ============================================
@@ -15,20 +15,12 @@ ASako85::ASako85()
 	Name = FText::FromString("Sako 85");
 	Description = FText::FromString(".308 Winchester bolt-action precision rifle. High accuracy, manual bolt cycling between shots.");
 
-	// ============================================
-	// CALIBER
-	// ============================================
-	AcceptedCaliberType = EAmmoCaliberType::NATO_762x51mm;  // .308 Win / 7.62x51mm NATO
-
 	// ============================================
 	// COMPONENTS
 	// ============================================
 
 	// Bolt-Action Fire Component
 	BoltActionFireComponent = CreateDefaultSubobject<UBoltActionFireComponent>(TEXT("BoltActionFireComponent"));
-	BoltActionFireComponent->FireRate = 40.0f;       // ~40 RPM (bolt-action limited)
-	BoltActionFireComponent->SpreadScale = 0.3f;     // High accuracy (sniper rifle)
-	BoltActionFireComponent->RecoilScale = 1.5f;     // Higher recoil (.308 is powerful)
 
 	// Assign to BaseWeapon's FireComponent pointer for interface compatibility
 	FireComponent = BoltActionFireComponent;
@@ -44,20 +36,36 @@ ASako85::ASako85()
 
 	// Ballistics Component (standard single-projectile)
 	BallisticsComponent = CreateDefaultSubobject<UBallisticsComponent>(TEXT("BallisticsComponent"));
+}
 
-	// ============================================
-	// ATTACHMENT SOCKETS
-	// ============================================
-	CharacterAttachSocket = FName("weapon_r");     // Right hand (normal hold)
-	ReloadAttachSocket = FName("weapon_l");        // Left hand support during reload/bolt-action
+const FWeaponDefinition& ASako85::GetBuiltInDefinition() const
+{
+	static const FWeaponDefinition Definition = []()
+	{
+		FWeaponDefinition Def = MakeDefaultDefinition();
 
-	// ============================================
-	// AIMING DEFAULTS (Sniper rifle settings)
-	// ============================================
-	AimFOV = 30.0f;              // Narrow FOV for scope zoom
-	AimLookSpeed = 0.3f;         // Slow look speed when scoped
-	LeaningScale = 0.5f;         // Reduced leaning (stable platform)
-	BreathingScale = 1.5f;       // More noticeable breathing sway (precision matters)
+		// Caliber
+		Def.AcceptedCaliberType = EAmmoCaliberType::NATO_762x51mm;  // .308 Win / 7.62x51mm NATO
+
+		// Fire
+		Def.FireRate = 40.0f;       // ~40 RPM (bolt-action limited)
+		Def.SpreadScale = 0.3f;     // High accuracy (sniper rifle)
+		Def.RecoilScale = 1.5f;     // Higher recoil (.308 is powerful)
+
+		// Attachment sockets
+		Def.CharacterAttachSocket = FName("weapon_r");     // Right hand (normal hold)
+		Def.ReloadAttachSocket = FName("weapon_l");        // Left hand support during reload/bolt-action
+
+		// Aiming (sniper rifle settings)
+		Def.AimFOV = 30.0f;              // Narrow FOV for scope zoom
+		Def.AimLookSpeed = 0.3f;         // Slow look speed when scoped
+		Def.LeaningScale = 0.5f;         // Reduced leaning (stable platform)
+		Def.BreathingScale = 1.5f;       // More noticeable breathing sway (precision matters)
+
+		return Def;
+	}();
+
+	return Definition;
 }
 
 // ============================================
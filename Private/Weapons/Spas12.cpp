@@ -7,6 +7,7 @@
 #include "Components/ShotgunBallisticsComponent.h"
 #include "Interfaces/AmmoConsumerInterface.h"
 #include "Net/UnrealNetwork.h"
+#include "Core/FPSCoreStats.h"
 
 ASpas12::ASpas12()
 {
@@ -16,20 +17,12 @@ ASpas12::ASpas12()
 	Name = FText::FromString("SPAS-12");
 	Description = FText::FromString("12 Gauge semi-auto combat shotgun. High damage at close range, shell-by-shell reload.");
 
-	// ============================================
-	// CALIBER
-	// ============================================
-	AcceptedCaliberType = EAmmoCaliberType::Gauge_12;
-
 	// ============================================
 	// COMPONENTS
 	// ============================================
 
 	// Semi-Auto Fire Component (no pump-action during shooting)
 	SemiAutoFireComponent = CreateDefaultSubobject<USemiAutoFireComponent>(TEXT("SemiAutoFireComponent"));
-	SemiAutoFireComponent->FireRate = 300.0f;        // ~300 RPM (semi-auto)
-	SemiAutoFireComponent->SpreadScale = 1.5f;       // Wide spread (shotgun buckshot)
-	SemiAutoFireComponent->RecoilScale = 2.0f;       // Heavy recoil (12 gauge)
 
 	// Assign to BaseWeapon's FireComponent pointer for interface compatibility
 	FireComponent = SemiAutoFireComponent;
@@ -50,26 +43,42 @@ ASpas12::ASpas12()
 	// Assign to BaseWeapon's BallisticsComponent pointer for interface compatibility
 	BallisticsComponent = ShotgunBallistics;
 
-	// ============================================
-	// ATTACHMENT SOCKETS
-	// ============================================
-	CharacterAttachSocket = FName("weapon_r");     // Right hand (normal hold)
-	ReloadAttachSocket = FName("weapon_l");        // Left hand support during reload
-
-	// ============================================
-	// AIMING DEFAULTS (Shotgun settings)
-	// ============================================
-	AimFOV = 55.0f;              // Moderate FOV (iron sights)
-	AimLookSpeed = 0.6f;         // Medium look speed
-	LeaningScale = 0.8f;         // Reduced leaning (heavy weapon)
-	BreathingScale = 0.8f;       // Moderate sway (heavy weapon)
-
 	// ============================================
 	// SPAS-12 STATE DEFAULTS
 	// ============================================
 	BoltCarrierOpen = false;
 }
 
+const FWeaponDefinition& ASpas12::GetBuiltInDefinition() const
+{
+	static const FWeaponDefinition Definition = []()
+	{
+		FWeaponDefinition Def = MakeDefaultDefinition();
+
+		// Caliber
+		Def.AcceptedCaliberType = EAmmoCaliberType::Gauge_12;
+
+		// Fire
+		Def.FireRate = 300.0f;        // ~300 RPM (semi-auto)
+		Def.SpreadScale = 1.5f;       // Wide spread (shotgun buckshot)
+		Def.RecoilScale = 2.0f;       // Heavy recoil (12 gauge)
+
+		// Attachment sockets
+		Def.CharacterAttachSocket = FName("weapon_r");     // Right hand (normal hold)
+		Def.ReloadAttachSocket = FName("weapon_l");        // Left hand support during reload
+
+		// Aiming (shotgun settings)
+		Def.AimFOV = 55.0f;              // Moderate FOV (iron sights)
+		Def.AimLookSpeed = 0.6f;         // Medium look speed
+		Def.LeaningScale = 0.8f;         // Reduced leaning (heavy weapon)
+		Def.BreathingScale = 0.8f;       // Moderate sway (heavy weapon)
+
+		return Def;
+	}();
+
+	return Definition;
+}
+
 // ============================================
 // REPLICATION
 // ============================================
@@ -83,6 +92,8 @@ void ASpas12::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeP
 
 void ASpas12::OnRep_BoltCarrierOpen()
 {
+	FPSCORE_SCOPE_ONREP(ASpas12_OnRep_BoltCarrierOpen);
+
 	ForceUpdateWeaponAnimInstances();
 }
 
@@ -90,10 +101,13 @@ void ASpas12::OnRep_BoltCarrierOpen()
 // BASEWEAPON OVERRIDES
 // ============================================
 
-void ASpas12::Multicast_PlayShootEffects_Implementation()
+void ASpas12::Multicast_PlayShootEffects_Implementation(
+	FVector_NetQuantize TracerOrigin,
+	FVector_NetQuantizeNormal TracerDirection,
+	float TracerDistance)
 {
-	// Call base implementation (muzzle VFX + character shoot anims)
-	Super::Multicast_PlayShootEffects_Implementation();
+	// Call base implementation (muzzle VFX + tracer + character shoot anims)
+	Super::Multicast_PlayShootEffects_Implementation(TracerOrigin, TracerDirection, TracerDistance);
 
 	// SPAS-12-specific: Play bolt carrier shoot montage on weapon meshes
 	// This runs on ALL clients (server + remote clients)
@@ -102,10 +116,11 @@ void ASpas12::Multicast_PlayShootEffects_Implementation()
 
 void ASpas12::HandleShotFired_Implementation(
 	FVector_NetQuantize MuzzleLocation,
-	FVector_NetQuantizeNormal Direction)
+	FVector_NetQuantizeNormal Direction,
+	float TraceDistance)
 {
 	// Call base implementation (triggers Multicast_PlayShootEffects for character anims + muzzle VFX)
-	Super::HandleShotFired_Implementation(MuzzleLocation, Direction);
+	Super::HandleShotFired_Implementation(MuzzleLocation, Direction, TraceDistance);
 
 	// SERVER ONLY: Check if magazine is empty after this shot → bolt locks back
 	if (HasAuthority())
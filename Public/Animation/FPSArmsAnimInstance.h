@@ -0,0 +1,184 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimInstance.h"
+#include "FPSArmsAnimInstance.generated.h"
+
+/**
+ * Procedural arms input snapshot
+ * Gathered on GAME THREAD by FPSCharacter::Tick, consumed on WORKER THREAD
+ * Plain values only - no UObject access during worker evaluation
+ */
+USTRUCT(BlueprintType)
+struct FPSCORE_API FFPSProceduralArmsInput
+{
+	GENERATED_BODY()
+
+	// World velocity of the character (cm/s)
+	FVector Velocity = FVector::ZeroVector;
+
+	// Actor rotation (for world → local velocity transform)
+	FQuat ActorQuat = FQuat::Identity;
+
+	// Controller rotation (for mouse lag/tilt)
+	FRotator ControlRotation = FRotator::ZeroRotator;
+
+	// False when pawn has no controller (mouse influence skipped)
+	bool bHasController = false;
+
+	// Interpolated hip/ADS arms offset (camera space, cm)
+	FVector ArmsOffset = FVector::ZeroVector;
+
+	// Arms component relative transform (camera space) - bone offset is expressed against it
+	FTransform ArmsRelativeTransform = FTransform::Identity;
+
+	// Camera additive offset applied by game thread THIS frame (ADS breathing/lean)
+	FTransform AppliedCameraOffset = FTransform::Identity;
+
+	// Current leaning scale (hip → ADS)
+	float LeaningScale = 1.0f;
+
+	// Current breathing scale (hip → ADS)
+	float BreathingScale = 1.0f;
+
+	// Aiming state (enables camera offset output)
+	bool bIsAiming = false;
+
+	// Reset accumulated state before next update (respawn)
+	bool bResetState = false;
+};
+
+/**
+ * Procedural arms state (weapon lean, walk bob, mouse lag, idle breathing)
+ *
+ * SINGLE RESPONSIBILITY: Pure procedural sway math ONLY
+ *
+ * DOES:
+ * - Velocity-based lean + perpendicular/vertical bob + mouse lag spring
+ * - Idle breathing sway
+ * - Breathing → camera rotation conversion (ADS wobble)
+ *
+ * DOES NOT:
+ * - Touch components or UObjects (→ caller applies results)
+ *
+ * ARCHITECTURE:
+ * - Thread-safe by construction (operates on FFPSProceduralArmsInput only)
+ * - Owned by UFPSArmsAnimInstance (worker thread) or FPSCharacter (game thread fallback)
+ */
+USTRUCT()
+struct FPSCORE_API FFPSProceduralArmsState
+{
+	GENERATED_BODY()
+
+	// ============================================
+	// OUTPUTS
+	// ============================================
+
+	// Leaning vector (cm): X = forward, Y = lateral, Z = vertical
+	FVector LeanVector = FVector::ZeroVector;
+
+	// Breathing vector (cm): X = forward, Y = lateral, Z = vertical
+	FVector BreathingVector = FVector::ZeroVector;
+
+	// RAW mouse angular velocity (deg/s) for crosshair alpha
+	float RawMouseDelta = 0.0f;
+
+	// Final arms offset in camera space: ArmsOffset + LeanVector + BreathingVector
+	FVector FinalArmsOffset = FVector::ZeroVector;
+
+	// Camera additive offset (camera local space) - identity when not aiming
+	FTransform CameraOffset = FTransform::Identity;
+
+	// ============================================
+	// INTERNAL STATE
+	// ============================================
+
+	FVector LeanState_CurrentLean = FVector::ZeroVector;
+	float LeanState_WalkCycleTime = 0.0f;
+	FRotator LeanState_PreviousControlRotation = FRotator::ZeroRotator;
+	FVector2D LeanState_MouseLagOffset = FVector2D::ZeroVector;
+
+	FVector BreathingState_CurrentBreathing = FVector::ZeroVector;
+	float BreathingState_IdleSwayTime = 0.0f;
+	float BreathingState_IdleActivation = 0.0f;
+
+	/** Advance lean/breathing state and refresh all outputs */
+	void Update(const FFPSProceduralArmsInput& Input, float DeltaTime);
+
+	/** Clear accumulated state (respawn) */
+	void Reset(const FRotator& ControlRotation);
+
+	/** Convert breathing offset (cm) to camera rotation (degrees) */
+	static FRotator CalculateBreathingRotation(const FVector& InBreathingVector);
+
+private:
+	FVector CalculateLeanVector(const FFPSProceduralArmsInput& Input, float DeltaTime);
+	FVector CalculateBreathing(const FFPSProceduralArmsInput& Input, float DeltaTime);
+};
+
+/**
+ * FPS Arms Anim Instance
+ * Base class for the first-person Arms AnimBP
+ *
+ * SINGLE RESPONSIBILITY: Evaluate procedural arms/camera sway off the game thread
+ *
+ * DOES:
+ * - Receive game-thread input snapshot (SetProceduralInput)
+ * - Evaluate FFPSProceduralArmsState in NativeThreadSafeUpdateAnimation (worker thread)
+ * - Expose root bone offset for "Transform (Modify) Bone" node in AnimBP
+ * - Expose last evaluated outputs to game thread (MPC, crosshair, camera offset)
+ *
+ * DOES NOT:
+ * - Move Arms/Camera components (no per-frame transform propagation)
+ * - Gather gameplay state (→ FPSCharacter builds input snapshot)
+ *
+ * ARCHITECTURE:
+ * - AnimBP graph: Transform (Modify) Bone on root, Component Space,
+ *   Translation/Rotation = Add to Existing, bound to ArmsRootTranslation/ArmsRootRotation
+ * - Camera sway is applied by FPSCharacter via UCameraComponent::AddAdditiveOffset
+ *   (camera component itself never moves, Arms root compensates for the same offset)
+ * - Camera offset computed on frame N is applied on frame N+1 and fed back as
+ *   AppliedCameraOffset, so arms and camera always agree within a frame
+ *
+ * MULTIPLAYER:
+ * - LOCAL ONLY - Arms mesh is OnlyOwnerSee, no replication
+ */
+UCLASS()
+class FPSCORE_API UFPSArmsAnimInstance : public UAnimInstance
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Set input snapshot for next animation update
+	 * GAME THREAD ONLY - called from FPSCharacter::Tick before Arms mesh ticks
+	 */
+	void SetProceduralInput(const FFPSProceduralArmsInput& Input);
+
+	/** Last evaluated procedural state (GAME THREAD - read after anim update completed) */
+	const FFPSProceduralArmsState& GetProceduralState() const { return ProceduralState; }
+
+protected:
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
+
+	// ============================================
+	// ANIMGRAPH OUTPUTS (Thread-safe property access)
+	// ============================================
+
+	// Root bone translation in component space (cm)
+	UPROPERTY(BlueprintReadOnly, Category = "Procedural")
+	FVector ArmsRootTranslation = FVector::ZeroVector;
+
+	// Root bone rotation in component space
+	UPROPERTY(BlueprintReadOnly, Category = "Procedural")
+	FRotator ArmsRootRotation = FRotator::ZeroRotator;
+
+private:
+	// Pending input snapshot (written on game thread, read on worker thread)
+	FFPSProceduralArmsInput PendingInput;
+
+	// Procedural state (worker thread during update, game thread reads between updates)
+	FFPSProceduralArmsState ProceduralState;
+};
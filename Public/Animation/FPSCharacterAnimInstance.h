@@ -0,0 +1,88 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimInstance.h"
+#include "FPSCharacterAnimInstance.generated.h"
+
+class AFPSCharacter;
+
+/**
+ * Spine aim offset distribution
+ * Splits a single spine pitch (±45°) across spine_03 / spine_04 / spine_05 / neck_01
+ *
+ * Chain is RELATIVE (each bone inherits parent), total ≈ 170% of input pitch
+ * Shared by the Body AnimBP (bone transforms) and FPSCharacter (analytic camera rig)
+ */
+USTRUCT(BlueprintType)
+struct FPSCORE_API FFPSSpineAimOffset
+{
+	GENERATED_BODY()
+
+	// Bone-space pitch per bone (degrees)
+	UPROPERTY(BlueprintReadOnly, Category = "Aim")
+	float Spine03 = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Aim")
+	float Spine04 = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Aim")
+	float Spine05 = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Aim")
+	float Neck01 = 0.0f;
+
+	/** Distribute spine pitch: spine_03(40%) + spine_04(50%) + spine_05(60%) + neck_01(20%) */
+	static FFPSSpineAimOffset FromSpinePitch(float SpinePitch);
+
+	/**
+	 * Approximate input-driven spine pitch from replicated camera pitch
+	 * Inverse of chain amplification: camera_pitch / 1.7 ≈ spine pitch (clamped ±45°)
+	 */
+	static float SpinePitchFromViewPitch(float ViewPitch);
+};
+
+/**
+ * FPS Character Anim Instance
+ * Base class for the third-person Body/Legs AnimBP
+ *
+ * SINGLE RESPONSIBILITY: Drive spine aim offset from replicated pitch in the anim graph
+ *
+ * DOES:
+ * - Read spine pitch from owning FPSCharacter (game thread, one float)
+ * - Compute per-bone spine/neck pitch in NativeThreadSafeUpdateAnimation
+ *
+ * DOES NOT:
+ * - Move any components (camera rig is analytic in FPSCharacter)
+ *
+ * ARCHITECTURE:
+ * - AnimBP graph: Transform (Modify) Bone on spine_03/spine_04/spine_05/neck_01,
+ *   Rotation = Add to Existing, Bone Space, bound to SpineAimOffset.* (Pitch axis)
+ * - SpinePitch also available for AimOffset blendspaces (±45° input range)
+ *
+ * MULTIPLAYER:
+ * - Pitch is replicated (COND_SkipOwner), evaluated identically on server/owner/proxies
+ */
+UCLASS()
+class FPSCORE_API UFPSCharacterAnimInstance : public UAnimInstance
+{
+	GENERATED_BODY()
+
+protected:
+	virtual void NativeInitializeAnimation() override;
+	virtual void NativeUpdateAnimation(float DeltaSeconds) override;
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
+
+	// Input-driven spine pitch (±45°) - LocalPitchAccumulator of owning character
+	UPROPERTY(BlueprintReadOnly, Category = "Aim")
+	float SpinePitch = 0.0f;
+
+	// Per-bone pitch distribution for Transform (Modify) Bone nodes
+	UPROPERTY(BlueprintReadOnly, Category = "Aim")
+	FFPSSpineAimOffset SpineAimOffset;
+
+private:
+	// Owning character (cached in NativeInitializeAnimation)
+	TWeakObjectPtr<AFPSCharacter> OwningCharacter;
+};
@@ -17,6 +17,7 @@
 #include "Kismet/GameplayStatics.h"
 #include "TimerManager.h"
 #include "Core/AmmoCaliberTypes.h"
+#include "Data/WeaponDefinition.h"
 #include "Interfaces/InteractableInterface.h"
 #include "Interfaces/PickupableInterface.h"
 #include "Interfaces/HoldableInterface.h"
@@ -33,7 +34,10 @@ class ABaseMagazine;
 class UBallisticsComponent;
 class UFireComponent;
 class UReloadComponent;
+class UDroppedItemComponent;
 class ABaseSight;
+class UNiagaraComponent;
+class UStaticMesh;
 
 UCLASS()
 class FPSCORE_API ABaseWeapon : public AActor, public IInteractableInterface, public IPickupableInterface, public IHoldableInterface, public ISightInterface, public IUsableInterface, public IAmmoConsumerInterface, public IBallisticsHandlerInterface, public IReloadableInterface, public IItemWidgetProviderInterface
@@ -44,6 +48,8 @@ public:
 	ABaseWeapon();
 
 protected:
+	virtual void PostInitProperties() override;
+	virtual void PostLoad() override;
 	virtual void PostInitializeComponents() override;
 	virtual void BeginPlay() override;
 
@@ -101,6 +107,10 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Weapon|Components")
 	UChildActorComponent* SightComponent;
 
+	// World drop lifecycle (rest freeze, dormancy, proxy mesh) - UFPSDroppedItemSubsystem
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Weapon|Components")
+	UDroppedItemComponent* DroppedItemComponent;
+
 protected:
 	// ============================================
 	// DUAL-MESH SYSTEM (FPS + TPS)
@@ -146,28 +156,57 @@ public:
 	FText ItemInfo;
 
 	// ============================================
-	// DESIGNER DEFAULTS - AIMING
+	// DESIGNER DEFAULTS - DEFINITION
 	// ============================================
 
-	// Field of view when aiming (degrees)
-	// Rifle: 50, Pistol: 60, Shotgun: 55, Sniper: 30, Launcher: 55
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "1 - Defaults|Aiming")
-	float AimFOV = 50.0f;
+	// Shared tuning record (fire, aiming, caliber, sockets, montages)
+	// nullptr = class built-in definition (GetBuiltInDefinition, code defaults without montages)
+	// Blueprints saved with the old per-actor tuning get a generated record on load (MigrateDeprecatedTuning)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "1 - Defaults|Definition")
+	TObjectPtr<UWeaponDefinitionAsset> WeaponDefinition;
 
-	// Look sensitivity multiplier when aiming (1.0 = normal, lower = slower)
-	// Rifle: 0.5, Pistol: 0.7, Shotgun: 0.6, Sniper: 0.3
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "1 - Defaults|Aiming")
-	float AimLookSpeed = 0.5f;
+#if WITH_EDITORONLY_DATA
+	// ============================================
+	// DEPRECATED - folded into WeaponDefinition on load (MigrateDeprecatedTuning)
+	// ============================================
 
-	// Leaning scale multiplier when holding this weapon (1.0 = normal scale)
-	// Rifle: 1.0, Pistol: 0.8, Sniper: 0.5
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "1 - Defaults|Aiming")
-	float LeaningScale = 1.0f;
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to WeaponDefinition"))
+	float AimFOV_DEPRECATED = 50.0f;
 
-	// Breathing sway intensity (hip-fire idle)
-	// Rifle: 1.0, Pistol: 0.6, Sniper: 1.5, Launcher: 1.2
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "1 - Defaults|Aiming")
-	float BreathingScale = 1.0f;
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to WeaponDefinition"))
+	float AimLookSpeed_DEPRECATED = 0.5f;
+
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to WeaponDefinition"))
+	float LeaningScale_DEPRECATED = 1.0f;
+
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to WeaponDefinition"))
+	float BreathingScale_DEPRECATED = 1.0f;
+
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to WeaponDefinition"))
+	EAmmoCaliberType AcceptedCaliberType_DEPRECATED = EAmmoCaliberType::NATO_556x45mm;
+
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to WeaponDefinition"))
+	TSubclassOf<UAnimInstance> AnimLayer_DEPRECATED;
+
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to WeaponDefinition"))
+	TObjectPtr<UAnimMontage> ShootMontage_DEPRECATED = nullptr;
+
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to WeaponDefinition"))
+	TObjectPtr<UAnimMontage> EquipMontage_DEPRECATED = nullptr;
+
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to WeaponDefinition"))
+	TObjectPtr<UAnimMontage> UnequipMontage_DEPRECATED = nullptr;
+
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to WeaponDefinition"))
+	FName CharacterAttachSocket_DEPRECATED = FName("weapon_r");
+
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to WeaponDefinition"))
+	FName ReloadAttachSocket_DEPRECATED = FName("weapon_r");
+#endif
+
+	// ============================================
+	// DESIGNER DEFAULTS - AIMING
+	// ============================================
 
 	// Default aiming point for camera positioning when aiming
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "1 - Defaults|Aiming")
@@ -185,31 +224,6 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "1 - Defaults|Magazine")
 	TSubclassOf<ABaseMagazine> DefaultMagazineClass;
 
-	// Accepted caliber type (for magazine compatibility checks)
-	// NATO_556x45mm, Parabellum_9x19mm, Gauge_12, NATO_762x51mm
-	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "1 - Defaults|Magazine")
-	EAmmoCaliberType AcceptedCaliberType = EAmmoCaliberType::NATO_556x45mm;
-
-	// ============================================
-	// DESIGNER DEFAULTS - ANIMATION
-	// ============================================
-
-	// Animation layer class for weapon-specific animations
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "1 - Defaults|Animation")
-	TSubclassOf<UAnimInstance> AnimLayer;
-
-	// Shooting animation montage (uses slot "DefaultGroup.Shoot")
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "1 - Defaults|Animation")
-	UAnimMontage* ShootMontage;
-
-	// Equip animation montage (draw weapon, unfold launcher, etc.)
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "1 - Defaults|Animation")
-	UAnimMontage* EquipMontage;
-
-	// Unequip animation montage (holster weapon, fold launcher, etc.)
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "1 - Defaults|Animation")
-	UAnimMontage* UnequipMontage;
-
 	// ============================================
 	// DESIGNER DEFAULTS - VFX
 	// ============================================
@@ -218,6 +232,14 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "1 - Defaults|VFX")
 	UNiagaraSystem* MuzzleFlashNiagara;
 
+	// Socket on FPSMesh/TPSMesh where muzzle flash emitters are attached
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "1 - Defaults|VFX")
+	FName MuzzleFlashSocket = FName("barrel");
+
+	// Tracer streak mesh (+X, pivot at tail, 100 units long, 1 unit thick), nullptr = no tracers
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "1 - Defaults|VFX")
+	UStaticMesh* TracerMesh;
+
 	// ============================================
 	// DESIGNER DEFAULTS - UI
 	// ============================================
@@ -230,20 +252,6 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "1 - Defaults|UI")
 	TSubclassOf<UUserWidget> ItemWidgetClass;
 
-	// ============================================
-	// DESIGNER DEFAULTS - ATTACHMENT SOCKETS
-	// ============================================
-
-	// Socket name on CHARACTER where weapon mesh attaches when equipped
-	// Common values: "weapon_r", "hand_r", "weapon_socket"
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "1 - Defaults|Sockets")
-	FName CharacterAttachSocket = FName("weapon_r");
-
-	// Socket name on CHARACTER where weapon mesh attaches during reload
-	// Used by bolt-action rifles, shotguns that require hand repositioning
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "1 - Defaults|Sockets")
-	FName ReloadAttachSocket = FName("weapon_r");
-
 	// ============================================
 	// DESIGNER DEFAULTS - HANDLING
 	// ============================================
@@ -359,11 +367,12 @@ public:
 	/**
 	 * Handle shot fired event (SERVER ONLY)
 	 * Called by BallisticsComponent when shot is fired
-	 * Triggers Multicast RPC to spawn muzzle flash on all clients
+	 * Triggers Multicast RPC to spawn muzzle flash + tracer on all clients
 	 */
 	virtual void HandleShotFired_Implementation(
 		FVector_NetQuantize MuzzleLocation,
-		FVector_NetQuantizeNormal Direction
+		FVector_NetQuantizeNormal Direction,
+		float TraceDistance
 	) override;
 
 	/**
@@ -373,6 +382,7 @@ public:
 	 */
 	virtual void HandleImpactDetected_Implementation(
 		const TSoftObjectPtr<UNiagaraSystem>& ImpactVFX,
+		const TSoftObjectPtr<UMaterialInterface>& ImpactDecal,
 		FVector_NetQuantize Location,
 		FVector_NetQuantizeNormal Normal
 	) override;
@@ -393,17 +403,41 @@ public:
 	// - FPSMesh has SetOnlyOwnerSee(true) → only owning client sees it
 	// - TPSMesh has SetOwnerNoSee(true) → only other clients see it
 	//
-	// NOTE: No parameters needed - VFX spawns on mesh bone socket "barrel"
+	// NOTE: No parameters needed - VFX plays on mesh socket GetMuzzleFlashSocket()
+	//
+	// PERSISTENT EMITTERS:
+	// - One muzzle flash NiagaraComponent per mesh, attached + initialized in BeginPlay
+	// - Each shot resets the existing system in place (no spawn, no attach, no socket lookup)
+	// - Not created on dedicated server
 	// ============================================
 
 protected:
 
+	// Persistent muzzle flash emitters (nullptr on dedicated server / no MuzzleFlashNiagara)
+	UPROPERTY(Transient)
+	UNiagaraComponent* FPSMuzzleFlashComp;
+
+	UPROPERTY(Transient)
+	UNiagaraComponent* TPSMuzzleFlashComp;
+
 	/**
-	 * Helper: Spawn muzzle flash VFX on specified mesh
-	 * @param Mesh - Mesh to attach Niagara to
-	 * @param bIsFirstPerson - True for FPS mesh (OnlyOwnerSee), False for TPS mesh (OwnerNoSee)
+	 * Socket for muzzle flash emitters
+	 * Override for weapons whose muzzle is not MuzzleFlashSocket (e.g. launcher exhaust)
 	 */
-	void SpawnMuzzleFlashOnMesh(USkeletalMeshComponent* Mesh, bool bIsFirstPerson);
+	virtual FName GetMuzzleFlashSocket() const { return MuzzleFlashSocket; }
+
+	/**
+	 * Create muzzle flash emitter attached to mesh (BeginPlay, once per mesh)
+	 * @param Mesh - FPSMesh or TPSMesh
+	 * @return Registered, initialized, inactive component (nullptr if no mesh / system)
+	 */
+	UNiagaraComponent* CreateMuzzleFlashComponent(USkeletalMeshComponent* Mesh);
+
+	/**
+	 * Re-trigger muzzle flash on persistent emitter
+	 * @param bIsFirstPerson - True for FPS mesh emitter (OnlyOwnerSee), False for TPS mesh emitter (OwnerNoSee)
+	 */
+	void PlayMuzzleFlash(bool bIsFirstPerson);
 
 	/**
 	 * Single Multicast RPC for ALL shoot visual effects
@@ -411,20 +445,27 @@ protected:
 	 * - IsLocallyControlled() → FPS view (FPSMesh VFX + Arms animation)
 	 * - !IsLocallyControlled() → TPS view (TPSMesh VFX + Body/Legs animation)
 	 * - DedicatedServer → Skip VFX, keep animations for physics
+	 * - Tracer (TracerMesh) submitted to UFPSTracerSubsystem on every machine that renders
 	 *
 	 * ARCHITECTURE: Replicate the EVENT, not the visuals
 	 * Each client spawns appropriate effects based on their perspective
+	 *
+	 * @param TracerOrigin - Shot origin
+	 * @param TracerDirection - Shot direction
+	 * @param TracerDistance - Distance to first impact (0 = no tracer, e.g. launcher)
 	 */
 	UFUNCTION(NetMulticast, Unreliable)
-	void Multicast_PlayShootEffects();
+	void Multicast_PlayShootEffects(FVector_NetQuantize TracerOrigin, FVector_NetQuantizeNormal TracerDirection, float TracerDistance);
 
 	/**
 	 * Multicast RPC for spawning impact effects on all clients
-	 * Spawns Niagara system (includes particles, sound, decals)
+	 * Submits impact to UFPSImpactEffectSubsystem (batched Niagara system, particles + sound)
+	 * and bullet hole to UFPSDecalSubsystem (pooled decals, placed once per frame)
 	 */
 	UFUNCTION(NetMulticast, Reliable)
 	void Multicast_SpawnImpactEffect(
 		const TSoftObjectPtr<UNiagaraSystem>& ImpactVFX,
+		const TSoftObjectPtr<UMaterialInterface>& ImpactDecal,
 		FVector_NetQuantize Location,
 		FVector_NetQuantizeNormal Normal
 	);
@@ -540,6 +581,9 @@ public:
 	// Get unequip montage
 	virtual UAnimMontage* GetUnequipMontage_Implementation() const override;
 
+	// Shoot/reload montages, VFX and ammo data (cosmetics skipped on dedicated server)
+	virtual void GetPreloadAssets_Implementation(TArray<FSoftObjectPath>& OutAssets) const override;
+
 	// Check if currently equipping
 	virtual bool IsEquipping_Implementation() const override;
 
@@ -690,7 +734,47 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Weapon|Mesh")
 	USkeletalMeshComponent* GetTPSMesh() const { return TPSMesh; }
 
+	// ============================================
+	// WEAPON DEFINITION (shared, read-only)
+	// ============================================
+
+	/** Shared tuning record - WeaponDefinition asset if set, else class built-in record */
+	const FWeaponDefinition& GetDefinition() const
+	{
+		return WeaponDefinition ? WeaponDefinition->Definition : GetBuiltInDefinition();
+	}
+
+	/**
+	 * Definition of the weapon owning a component (Fire/Reload/Ballistics)
+	 * Non-weapon owner → default record
+	 */
+	static const FWeaponDefinition& GetDefinitionFor(const AActor* Actor);
+
 protected:
+	/**
+	 * Code defaults when no WeaponDefinition asset is assigned
+	 * Override in weapon classes with a function-local static (one record per class, never per instance)
+	 */
+	virtual const FWeaponDefinition& GetBuiltInDefinition() const;
+
+	/** Base built-in record (default caliber map) - starting point for class overrides */
+	static FWeaponDefinition MakeDefaultDefinition();
+
+#if WITH_EDITORONLY_DATA
+	/**
+	 * Blueprint CDO saved before WeaponDefinition existed → fold its deprecated tuning
+	 * (actor + Fire/Reload/Ballistics templates) into a generated definition subobject
+	 * No-op when an authored asset is assigned or nothing differs from the inherited definition
+	 */
+	void MigrateDeprecatedTuning();
+
+	/** Definition → deprecated properties (Blueprint deltas load against these archetype values) */
+	void CopyDefinitionToDeprecated(const FWeaponDefinition& Definition);
+
+	/** Deprecated properties → definition */
+	void CopyDeprecatedToDefinition(FWeaponDefinition& Definition) const;
+#endif
+
 	// ============================================
 	// HELPER METHODS FOR CHILD CLASSES
 	// ============================================
@@ -4,12 +4,100 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Engine/HitResult.h"
 #include "Core/AmmoCaliberTypes.h"
 #include "BallisticsComponent.generated.h"
 
 class UAmmoTypeDataAsset;
 class ABaseMagazine;
 class UNiagaraSystem;
+class UBallisticsComponent;
+
+/**
+ * Outcome of a single processed hit (combat replay capture)
+ */
+struct FBallisticsHitOutcome
+{
+	TWeakObjectPtr<AActor> HitActor;
+	FName BoneName;
+	float Damage = 0.0f;
+	float KineticEnergy = 0.0f;
+};
+
+/**
+ * Solved hit (worker thread) - applied on game thread by UBallisticsComponent::ApplyHitCommands
+ */
+struct FBallisticsHitCommand
+{
+	// Index into FBallisticsTrace::Hits
+	int32 HitIndex = INDEX_NONE;
+
+	// Unclamped damage (KE scaled)
+	float Damage = 0.0f;
+
+	// Projectile state on impact (before penetration loss) - telemetry / replay
+	float Speed = 0.0f;
+	float KineticEnergy = 0.0f;
+
+	// Along shot direction, only applied to simulating bodies
+	float ImpulseMagnitude = 0.0f;
+
+	// Physical material name (impact VFX / decal lookup)
+	FName MaterialName;
+
+	// Projectile continued through the surface
+	bool bPenetrated = false;
+};
+
+/**
+ * Per-hit surface data resolved on the game thread at submit time (the solve never touches UObjects)
+ */
+struct FBallisticsHitSurface
+{
+	// Hit had a live actor when traced
+	bool bHasActor = false;
+
+	// Thin material (penetrable with low loss) - see UBallisticsComponent::IsThinMaterial
+	bool bIsThin = false;
+
+	// Physical material name (impact VFX / decal lookup)
+	FName MaterialName;
+};
+
+/**
+ * Ammo properties a hit solve reads (copied at trace time - a reload may swap CurrentAmmoType before the solve)
+ */
+struct FBallisticsAmmoParams
+{
+	float MuzzleVelocity = 0.0f;
+	float ProjectileMass = 0.0f;
+	float PenetrationPower = 0.0f;
+	float DragCoefficient = 0.0f;
+	float Damage = 0.0f;
+};
+
+/**
+ * One traced shot / pellet: trace results in, hit commands out
+ */
+struct FBallisticsTrace
+{
+	TWeakObjectPtr<UBallisticsComponent> Ballistics;
+	TWeakObjectPtr<UAmmoTypeDataAsset> AmmoType;
+	FBallisticsAmmoParams Ammo;
+
+	FVector Location = FVector::ZeroVector;
+	FVector Direction = FVector::ForwardVector;
+	TArray<FHitResult> Hits;
+
+	// Parallel to Hits - the only per-hit input SolveTrace reads
+	TArray<FBallisticsHitSurface, TInlineAllocator<4>> Surfaces;
+
+	// Telemetry id of this trace (0 = not recording)
+	uint32 TelemetryShotId = 0;
+
+	// Filled by UBallisticsComponent::SolveTrace, last command stops the projectile unless bPenetrated
+	TArray<FBallisticsHitCommand, TInlineAllocator<4>> Commands;
+};
 
 /**
  * Ballistics Component
@@ -35,6 +123,9 @@ class UNiagaraSystem;
  * - Called by FireComponent after fire mechanics are processed
  * - Notifies owner (BaseWeapon) via IBallisticsHandlerInterface
  * - Server authority for projectile spawning
+ * - Hits: trace now, solve + apply deferred to UFPSBallisticsSubsystem (one batch per frame,
+ *   solve on worker threads, damage / impulse / VFX on game thread in shot order)
+ * - Replay capture solves + applies immediately (outcomes read right after ShootWithSeed)
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class FPSCORE_API UBallisticsComponent : public UActorComponent
@@ -57,10 +148,14 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "1 - Defaults|Caliber")
 	TSoftObjectPtr<UAmmoTypeDataAsset> CaliberDataAsset;
 
-	// Hash map of caliber types to ammo data assets
-	// Allows quick lookup of ammo properties by caliber type
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "1 - Defaults|Caliber")
-	TMap<EAmmoCaliberType, TSoftObjectPtr<UAmmoTypeDataAsset>> CaliberDataMap;
+#if WITH_EDITORONLY_DATA
+	// ============================================
+	// DEPRECATED - folded into owner's WeaponDefinition on load (ABaseWeapon::MigrateDeprecatedTuning)
+	// ============================================
+
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to ABaseWeapon::WeaponDefinition"))
+	TMap<EAmmoCaliberType, TSoftObjectPtr<UAmmoTypeDataAsset>> CaliberDataMap_DEPRECATED;
+#endif
 
 	// ============================================
 	// RUNTIME STATE
@@ -75,7 +170,7 @@ public:
 	// ============================================
 
 	/**
-	 * Initialize ammo type from caliber type (loads from CaliberDataMap)
+	 * Initialize ammo type from caliber type (cache preloaded from owner weapon definition CaliberDataMap)
 	 * Sets CurrentAmmoType to the loaded ammo data
 	 * @param CaliberType - The caliber type to initialize
 	 * @return True if caliber was found and loaded, false otherwise
@@ -91,6 +186,12 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Ballistics")
 	UAmmoTypeDataAsset* GetAmmoDataForCaliber(EAmmoCaliberType CaliberType) const;
 
+	/**
+	 * Collect ammo data assets (+ their effects once loaded) for async preload
+	 * @param bIncludeCosmetics - Include ammo effects (false on dedicated server)
+	 */
+	void GetPreloadAssets(TArray<FSoftObjectPath>& OutAssets, bool bIncludeCosmetics) const;
+
 	// ============================================
 	// SHOOT API (Core ballistics function)
 	// ============================================
@@ -107,35 +208,73 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Ballistics")
 	virtual void Shoot(FVector Location, FVector Direction);
 
+	/**
+	 * Shoot with explicit RNG seed (pellet spread etc. reproducible from seed)
+	 * Used by FireComponent (seed recorded in telemetry / combat recordings)
+	 */
+	void ShootWithSeed(const FVector& Location, const FVector& Direction, int32 Seed);
+
+	/**
+	 * Replay capture (combat replay benchmark)
+	 * While set: no owner notifications (VFX/RPCs), no damage/impulse applied, outcomes appended
+	 * @param Outcomes - Capture target, nullptr to end replay mode
+	 */
+	void SetReplayCapture(TArray<FBallisticsHitOutcome>* Outcomes) { ReplayOutcomes = Outcomes; }
+
+	// ============================================
+	// HIT PROCESSING (UFPSBallisticsSubsystem)
+	// ============================================
+
+	/**
+	 * Solve all hits of a trace into Trace.Commands
+	 * Pure math (distance decay, kinetic energy, damage, impulse, penetration loss) over plain data
+	 * (Ammo, hit points, Surfaces) - safe on worker threads, no UObject access
+	 */
+	static void SolveTrace(FBallisticsTrace& Trace);
+
+	/**
+	 * Apply solved commands: impact notification, damage, telemetry, impulse (game thread)
+	 * In replay capture: outcomes appended instead of side effects
+	 */
+	void ApplyHitCommands(const FBallisticsTrace& Trace);
+
 protected:
 	// Maximum trace distance in centimeters (1000 meters)
 	const float MaxTraceDistance = 100000.0f;
+
+	// Per-shot RNG (re-seeded by ShootWithSeed) - all ballistic randomness must use this
+	FRandomStream ShotRandom;
+
+	// Seed of current shot (0 = Shoot called without seed)
+	int32 ShotSeed = 0;
+
+	// Replay capture target (nullptr = live gameplay)
+	TArray<FBallisticsHitOutcome>* ReplayOutcomes = nullptr;
+
+	/**
+	 * Bullet query: physics trace for world geometry + hitbox layer for characters
+	 * Ignores weapon and shooter, hits sorted by distance (last world hit may be blocking)
+	 * @return true if anything was hit
+	 */
+	bool TraceShot(const FVector& Start, const FVector& End, TArray<FHitResult>& OutHits) const;
+
 	/**
-	 * Process single hit result
-	 * Handles penetration physics, damage, effects, and impulse
+	 * Notify owner via IBallisticsHandlerInterface::HandleShotFired (skipped in replay capture)
+	 * @param TraceDistance - Distance to first impact (tracer length)
+	 */
+	void NotifyShotFired(const FVector& Location, const FVector& Direction, float TraceDistance);
+
+	/**
+	 * Hand trace results to hit processing
+	 * Resolves per-hit surface data (actor, physical material) here on the game thread
+	 * Live: queued on UFPSBallisticsSubsystem (solved + applied at end of frame)
+	 * Replay capture / no subsystem: solved + applied now
 	 *
-	 * @param Hit - Hit result from line trace
-	 * @param HitIndex - Index in hit array (0 = first hit)
-	 * @param Speed - Current projectile speed (m/s) - modified by reference
-	 * @param Mass - Current projectile mass (grams) - modified by reference
-	 * @param Penetration - Current penetration power - modified by reference
-	 * @param DropFactor - Velocity decay factor per hit
-	 * @param KineticEnergy - Current kinetic energy (Joules) - modified by reference
-	 * @param Direction - Shot direction for impulse calculation
-	 * @param LastHitLocation - Location of previous hit (for distance calculation)
-	 * @return True to continue processing hits, False to stop (bullet stopped)
+	 * @param Location - Trace start (distance decay to first hit)
+	 * @param Direction - Shot direction for impulse / damage
+	 * @param Hits - Trace results sorted by distance (moved)
 	 */
-	bool ProcessHit(
-		const FHitResult& Hit,
-		int32 HitIndex,
-		float& Speed,
-		float& Mass,
-		float& Penetration,
-		float DropFactor,
-		float& KineticEnergy,
-		const FVector& Direction,
-		const FVector& LastHitLocation
-	);
+	void SubmitTrace(const FVector& Location, const FVector& Direction, TArray<FHitResult>&& Hits);
 
 	/**
 	 * Get material name and check if it's a thin material
@@ -148,7 +287,7 @@ protected:
 	 * @param OutMaterialName - Output material name for VFX lookup
 	 * @return True if thin material (contains "Thin"), False if solid material
 	 */
-	bool IsThinMaterial(UPhysicalMaterial* PhysMaterial, FName& OutMaterialName) const;
+	static bool IsThinMaterial(const UPhysicalMaterial* PhysMaterial, FName& OutMaterialName);
 
 	/**
 	 * Apply distance decay to kinetic energy
@@ -160,7 +299,7 @@ protected:
 	 * @param KineticEnergy - Current kinetic energy (Joules) - modified by reference
 	 * @param Distance - Distance traveled since last hit (cm)
 	 */
-	void ApplyDistanceDecay(
+	static void ApplyDistanceDecay(
 		float& Speed,
 		float& Mass,
 		float DropFactor,
@@ -177,16 +316,16 @@ protected:
 	 * @param Penetration - Current penetration power - modified by reference
 	 * @param DropFactor - Velocity decay factor per hit
 	 * @param KineticEnergy - Current kinetic energy (Joules) - modified by reference
-	 * @param PhysMaterial - Physical material that was penetrated
+	 * @param bIsThin - Penetrated surface is a thin material (FBallisticsHitSurface::bIsThin)
 	 * @return True if bullet can continue, False if bullet stopped (penetration threshold reached)
 	 */
-	bool ApplyPenetrationLoss(
+	static bool ApplyPenetrationLoss(
 		float& Speed,
 		float& Mass,
 		float& Penetration,
 		float DropFactor,
 		float& KineticEnergy,
-		UPhysicalMaterial* PhysMaterial
+		bool bIsThin
 	);
 
 public:
@@ -238,10 +377,23 @@ protected:
 	// AMMO TYPE CACHE
 	// ============================================
 
-	/** Pre-loaded ammo type cache (loaded in constructor for CDO, inherited by instances) */
+	/** Loaded ammo type cache (filled in BeginPlay from owner's definition, keeps assets referenced) */
 	UPROPERTY()
 	TMap<EAmmoCaliberType, UAmmoTypeDataAsset*> LoadedAmmoTypes;
 
-	/** Load all ammo types from CaliberDataMap into cache */
+	/** Load all ammo types from owner's definition CaliberDataMap into cache (BeginPlay, never on a shot) */
 	void PreloadAmmoTypes();
+
+	// ============================================
+	// TELEMETRY
+	// ============================================
+
+	// Telemetry id of last recorded trace (0 = not recording), copied into FBallisticsTrace
+	uint32 CurrentTelemetryShotId = 0;
+
+	/**
+	 * Record trace start to UFPSTelemetrySubsystem (no-op unless -FPSTelemetry)
+	 * Sets CurrentTelemetryShotId for the trace submitted afterwards
+	 */
+	void RecordTelemetryShot(const FVector& Location, const FVector& Direction);
 };
@@ -0,0 +1,121 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "InputActionValue.h"
+#include "BotDriverComponent.generated.h"
+
+class AFPSCharacter;
+class UInputAction;
+class UEnhancedInputLocalPlayerSubsystem;
+
+/**
+ * Bot Driver Component
+ * Scripted input for headless load-test clients
+ *
+ * SINGLE RESPONSIBILITY: Generate player input ONLY
+ *
+ * DOES:
+ * - Inject Enhanced Input actions into owning local PlayerController
+ * - Random (seeded) script: move, look (yaw + pitch), sprint, jump, crouch,
+ *   aim, fire bursts, reload, item swaps (grenades are inventory items - slot swap + fire = throw)
+ *
+ * DOES NOT:
+ * - Call character functions directly (input goes through same bindings as a human player)
+ * - Server logic (server sees a normal client - real RPC/replication load)
+ *
+ * ARCHITECTURE:
+ * - Added by AFPSPlayerController::BeginPlay when launched with -FPSBot
+ * - Input actions read from possessed pawn's IA_* properties (FPSCharacter)
+ * - Held actions re-injected every tick, taps injected for a single frame
+ *
+ * LOAD TEST:
+ *   Server:  <Project> <Map> -server -nullrhi -log -FPSLoadReport=5
+ *   Clients: <Project> 127.0.0.1 -game -nullrhi -nosound -FPSBot -FPSBotSeed=<N>   (x N)
+ *   Server logs "LoadReport," lines: players, avg tick interval ms, avg/max game thread ms, in/out bytes per second
+ *
+ * MULTIPLAYER:
+ * - Runs on owning client only (local controller)
+ */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class FPSCORE_API UBotDriverComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UBotDriverComponent();
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	/** Seed script RNG (same seed = same input sequence) */
+	void SetSeed(int32 Seed);
+
+	// ============================================
+	// SCRIPT CONFIGURATION
+	// ============================================
+
+	// Time between script decisions (seconds, random in range)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "1 - Defaults|Bot")
+	FVector2D DecisionInterval = FVector2D(0.5f, 2.0f);
+
+	// Max look input per second (axis units, same scale as mouse delta)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "1 - Defaults|Bot")
+	float MaxLookRate = 200.0f;
+
+	// Chance per decision to start a fire burst
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "1 - Defaults|Bot")
+	float FireChance = 0.5f;
+
+	// Fire burst duration (seconds, random in range)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "1 - Defaults|Bot")
+	FVector2D FireDuration = FVector2D(0.2f, 1.5f);
+
+	// Chance per decision to reload
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "1 - Defaults|Bot")
+	float ReloadChance = 0.15f;
+
+	// Chance per decision to swap to random inventory slot (1-4)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "1 - Defaults|Bot")
+	float SwapChance = 0.1f;
+
+	// Chance per decision to jump
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "1 - Defaults|Bot")
+	float JumpChance = 0.1f;
+
+	// Chance per decision to toggle crouch / sprint / aim
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "1 - Defaults|Bot")
+	float StanceChance = 0.15f;
+
+protected:
+	virtual void BeginPlay() override;
+
+private:
+	FRandomStream Stream;
+
+	// Time until next script decision
+	float DecisionTimer = 0.0f;
+
+	// Time remaining in current fire burst
+	float FireTimer = 0.0f;
+
+	// Held inputs (re-injected each tick)
+	FVector2D MoveInput = FVector2D::ZeroVector;
+	FVector2D LookRate = FVector2D::ZeroVector;
+	bool bHoldSprint = false;
+	bool bHoldCrouch = false;
+	bool bHoldAim = false;
+
+	// One-shot actions queued by MakeDecision (injected for a single frame)
+	TArray<const UInputAction*> PendingTaps;
+
+	/** Pick next set of held inputs + queue one-shot actions */
+	void MakeDecision(const AFPSCharacter* Character);
+
+	/** Inject one frame of input for action (null-safe) */
+	void Inject(const UInputAction* Action, const FInputActionValue& Value);
+
+	/** Input subsystem of owning local player (null on server / non-local) */
+	UEnhancedInputLocalPlayerSubsystem* GetInputSubsystem() const;
+};
@@ -0,0 +1,90 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Engine/NetSerialization.h"
+#include "DroppedItemComponent.generated.h"
+
+class UStaticMesh;
+
+/**
+ * Final resting transform of a dropped item (sent once, then item goes dormant)
+ */
+USTRUCT()
+struct FDroppedItemRestState
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	bool bAtRest = false;
+
+	UPROPERTY()
+	FVector_NetQuantize10 Location = FVector::ZeroVector;
+
+	UPROPERTY()
+	FRotator Rotation = FRotator::ZeroRotator;
+};
+
+/**
+ * UDroppedItemComponent
+ *
+ * CAPABILITY: World Drop Lifecycle
+ * Marks an item as managed by UFPSDroppedItemSubsystem while lying in the world.
+ *
+ * DOES:
+ * - Register owner with UFPSDroppedItemSubsystem at BeginPlay when unowned (level-placed / spawned loose;
+ *   level-placed items are exempt from the dropped item cap)
+ * - Carry replicated rest state (server → clients, one update before dormancy)
+ * - Provide optional static mesh proxy shown while at rest
+ *
+ * DOES NOT:
+ * - Detect rest, freeze physics, manage dormancy or caps (→ UFPSDroppedItemSubsystem)
+ * - Drop / pickup logic (→ AFPSCharacter::PerformDrop / PerformPickup)
+ *
+ * MULTIPLAYER:
+ * - Server decides rest, clients freeze + snap on OnRep_RestState
+ * - Late joiners receive rest state with the dormant item's initial replication
+ */
+UCLASS(ClassGroup = (FPSCore), meta = (BlueprintSpawnableComponent))
+class FPSCORE_API UDroppedItemComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UDroppedItemComponent();
+
+	// ============================================
+	// CONFIGURATION
+	// ============================================
+
+	/**
+	 * Cheap stand-in rendered while item is at rest (TPS mesh hidden, keeps collision)
+	 * Optional - without it the TPS skeletal mesh is kept as a frozen pose snapshot
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Dropped")
+	TObjectPtr<UStaticMesh> RestProxyMesh;
+
+	// ============================================
+	// STATE
+	// ============================================
+
+	UPROPERTY(ReplicatedUsing = OnRep_RestState)
+	FDroppedItemRestState RestState;
+
+	/** SERVER: publish final transform (UFPSDroppedItemSubsystem) */
+	void SetRestState(const FTransform& RestTransform);
+
+	/** SERVER: item moving again (pickup / re-drop) */
+	void ClearRestState();
+
+	FTransform GetRestTransform() const { return FTransform(RestState.Rotation, RestState.Location); }
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	UFUNCTION()
+	void OnRep_RestState();
+};
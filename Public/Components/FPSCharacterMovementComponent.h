@@ -0,0 +1,86 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "FPSCharacterMovementComponent.generated.h"
+
+/**
+ * FPS Character Movement Component
+ * Client-predicted sprint / walk / aim state
+ *
+ * SINGLE RESPONSIBILITY: Carry movement intent flags through the saved-move pipeline ONLY
+ *
+ * DOES:
+ * - Pack bWantsToSprint / bWantsToWalk / bWantsToAim into saved-move compressed flags
+ * - Resolve intent → EFPSMovementMode before each move (client prediction + server replay of the same move)
+ * - Push resolved mode (and aim on server) to AFPSCharacter::ApplyPredictedMovementState
+ *
+ * DOES NOT:
+ * - Read input or decide sprint direction (→ AFPSCharacter sets the flags)
+ * - Map modes to speeds (→ AFPSCharacter::UpdateMovementSpeed)
+ * - Handle crouch (engine FLAG_WantsToCrouch, resolved here as Crouch mode)
+ *
+ * MULTIPLAYER:
+ * - Flags travel with ServerMove (no separate reliable RPCs)
+ * - Speed changes predicted on owning client, corrections replay them
+ * - Simulated proxies get CurrentMovementMode / bIsAiming via replicated properties (COND_SkipOwner)
+ */
+UCLASS()
+class FPSCORE_API UFPSCharacterMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+	// Sprint key held AND moving forward (set by AFPSCharacter::Tick)
+	uint8 bWantsToSprint : 1;
+
+	// Walk key held
+	uint8 bWantsToWalk : 1;
+
+	// Aim active (set by AFPSCharacter::UpdateAimingState)
+	uint8 bWantsToAim : 1;
+
+	UFPSCharacterMovementComponent();
+
+	/** Clear all intent flags (death / reset) */
+	void ClearMovementIntent();
+
+	// UCharacterMovementComponent
+	virtual void UpdateFromCompressedFlags(uint8 Flags) override;
+	virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+
+protected:
+	virtual void UpdateCharacterStateBeforeMovement(float DeltaSeconds) override;
+};
+
+/**
+ * Saved move with FPS intent flags
+ * FLAG_Custom_0 = sprint, FLAG_Custom_1 = walk, FLAG_Custom_2 = aim
+ */
+class FSavedMove_FPSCharacter : public FSavedMove_Character
+{
+public:
+	typedef FSavedMove_Character Super;
+
+	uint8 bSavedWantsToSprint : 1;
+	uint8 bSavedWantsToWalk : 1;
+	uint8 bSavedWantsToAim : 1;
+
+	virtual void Clear() override;
+	virtual uint8 GetCompressedFlags() const override;
+	virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const override;
+	virtual void SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData) override;
+	virtual void PrepMoveFor(ACharacter* C) override;
+};
+
+class FNetworkPredictionData_Client_FPSCharacter : public FNetworkPredictionData_Client_Character
+{
+public:
+	typedef FNetworkPredictionData_Client_Character Super;
+
+	FNetworkPredictionData_Client_FPSCharacter(const UCharacterMovementComponent& ClientMovement);
+
+	virtual FSavedMovePtr AllocateNewMove() override;
+};
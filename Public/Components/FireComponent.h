@@ -33,6 +33,7 @@ class UBallisticsComponent;
  * - NOT replicated - fire logic runs on server via RPC
  * - Decoupled from Magazine (uses IAmmoConsumerInterface)
  * - References BallisticsComponent (sibling component)
+ * - FireRate / SpreadScale / RecoilScale read from owner's FWeaponDefinition (shared per weapon type)
  *
  * FIRE MODES (Subclasses):
  * - USemiAutoFireComponent - One shot per trigger pull
@@ -51,24 +52,20 @@ protected:
 	virtual void BeginPlay() override;
 
 public:
+#if WITH_EDITORONLY_DATA
 	// ============================================
-	// DESIGNER DEFAULTS - FIRE MECHANICS
+	// DEPRECATED - folded into owner's WeaponDefinition on load (ABaseWeapon::MigrateDeprecatedTuning)
 	// ============================================
 
-	// Fire rate in rounds per minute (RPM)
-	// Assault Rifle: 800, SMG: 900, Pistol: 450, Shotgun: 300, Bolt-Action: 40
-	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "1 - Defaults|Fire")
-	float FireRate = 600.0f;
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to ABaseWeapon::WeaponDefinition"))
+	float FireRate_DEPRECATED = 600.0f;
 
-	// Spread scale multiplier (0.0 = laser, 1.0 = normal, 2.0 = inaccurate)
-	// Rifle: 1.0, Pistol: 0.8, Shotgun: 1.5, Sniper: 0.3
-	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "1 - Defaults|Fire")
-	float SpreadScale = 1.0f;
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to ABaseWeapon::WeaponDefinition"))
+	float SpreadScale_DEPRECATED = 1.0f;
 
-	// Recoil intensity multiplier (0.0 = no recoil, 1.0 = normal, 2.0 = heavy)
-	// Rifle: 1.0, Pistol: 0.7, Shotgun: 2.0, Sniper: 1.5
-	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "1 - Defaults|Fire")
-	float RecoilScale = 1.0f;
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to ABaseWeapon::WeaponDefinition"))
+	float RecoilScale_DEPRECATED = 1.0f;
+#endif
 
 	// ============================================
 	// RUNTIME REFERENCES
@@ -128,13 +125,10 @@ public:
 
 	/**
 	 * Get time between shots in seconds
-	 * Calculated from FireRate: 60.0 / FireRate
+	 * Calculated from definition FireRate: 60.0 / FireRate
 	 */
 	UFUNCTION(BlueprintPure, Category = "Fire")
-	float GetTimeBetweenShots() const
-	{
-		return FireRate > 0.0f ? 60.0f / FireRate : 0.0f;
-	}
+	float GetTimeBetweenShots() const;
 
 protected:
 	// ============================================
@@ -146,9 +140,9 @@ protected:
 	 * Override in subclasses for fire mode-specific logic
 	 * Base implementation:
 	 * 1. Consume ammo (via IAmmoConsumerInterface)
-	 * 2. Apply spread to direction (using SpreadScale)
+	 * 2. Apply spread to direction (using definition SpreadScale)
 	 * 3. Call BallisticsComponent->Shoot(Location, SpreadDirection)
-	 * 4. Apply recoil (using RecoilScale)
+	 * 4. Apply recoil (using definition RecoilScale)
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Fire")
 	virtual void Fire();
@@ -6,6 +6,8 @@
 #include "Components/ActorComponent.h"
 #include "HealthComponent.generated.h"
 
+struct FHitResult;
+
 /**
  * Delegate Signatures (Owner reacts via callbacks)
  */
@@ -41,7 +43,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnHealthChangedSignature, float, Ne
  *
  * Responsibilities (CORE GAMEPLAY ONLY):
  * ✅ Health/MaxHealth state management
- * ✅ Damage calculation (bone multipliers)
+ * ✅ Damage calculation (bone multipliers, precompiled per physics body)
  * ✅ Death state tracking
  * ✅ Event broadcasting via delegates
  * ✅ Server authority validation
@@ -170,6 +172,13 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Damage")
 	float GetBoneDamageMultiplier(FName BoneName) const;
 
+	/**
+	 * Precompile multipliers per physics body index (called by UHitboxComponent on build)
+	 * Point damage whose HitInfo.Item/BoneName match a compiled body skips the bone name map
+	 * @param BodyBoneNames - Bone name per body index (PhysicsAsset->SkeletalBodySetups order)
+	 */
+	void CompileBodyDamageMultipliers(const TArray<FName>& BodyBoneNames);
+
 	/**
 	 * Reset health state to default (SERVER ONLY)
 	 * Resets Health = MaxHealth and bIsDeath = false
@@ -188,6 +197,13 @@ public:
 	void ResetHealthState();
 
 private:
+	// Per body index (parallel arrays, see CompileBodyDamageMultipliers)
+	TArray<FName> CompiledBodyBoneNames;
+	TArray<float> CompiledBodyMultipliers;
+
+	/** Body-index multiplier if hit matches a compiled body, otherwise bone name map */
+	float GetHitDamageMultiplier(const FHitResult& HitInfo) const;
+
 	// ============================================
 	// REPLICATION CALLBACKS
 	// ============================================
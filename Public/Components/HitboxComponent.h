@@ -0,0 +1,129 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "HitboxComponent.generated.h"
+
+class USkeletalMeshComponent;
+class UPhysicsAsset;
+class UPhysicalMaterial;
+
+/**
+ * Hitbox Component
+ * Analytic bone capsules for bullet ray queries
+ *
+ * SINGLE RESPONSIBILITY: Character hitbox geometry + ray intersection ONLY
+ *
+ * DOES:
+ * - Build bone-space capsules from body mesh physics asset (Sphyl, Sphere, Box, TaperedCapsule)
+ * - Refresh world-space capsules from bone transforms (at most once per frame, on first query)
+ * - Ray vs capsules: 4-wide SIMD bounding-sphere cull, exact ray-capsule test on survivors
+ * - Push per-body bone names to UHealthComponent (precompiled per-body damage multipliers)
+ *
+ * DOES NOT:
+ * - Query world geometry (→ physics trace in UBallisticsComponent)
+ * - Apply damage (→ UBallisticsComponent / UHealthComponent)
+ *
+ * ARCHITECTURE:
+ * - Registers with UFPSHitboxSubsystem (BeginPlay / EndPlay)
+ * - Body index = index in PhysicsAsset->SkeletalBodySetups (same as FHitResult::Item of physics hits)
+ * - Bodies rebuilt when mesh physics asset changes
+ * - Queryable only while owner + body mesh have collision enabled (dead characters on dedicated server are skipped)
+ *   and the body mesh uses UFPSHitboxSubsystem::BodyObjectType (ragdolls switch type → physics trace hits them)
+ *
+ * MULTIPLAYER:
+ * - NOT replicated - geometry is local to each machine (queries run where ballistics run)
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class FPSCORE_API UHitboxComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UHitboxComponent();
+
+	/**
+	 * Nearest capsule hit along ray
+	 * @param Start - Ray origin
+	 * @param Direction - Unit direction
+	 * @param MaxDistance - Ray length (cm)
+	 * @param OutHit - Filled like a physics hit (Actor, Component, BoneName, Item = body index, PhysMaterial)
+	 * @return true if any capsule was hit
+	 */
+	bool Raycast(const FVector& Start, const FVector& Direction, float MaxDistance, FHitResult& OutHit);
+
+	/** Owner and body mesh currently accept hits */
+	bool IsQueryable() const;
+
+	/** Object type the body mesh must use while answered by the hitbox layer */
+	ECollisionChannel GetBodyObjectType() const { return BodyObjectType; }
+
+	/** Force world-space refresh (e.g. after teleporting owner mid-frame) */
+	void InvalidateHitboxes() { LastUpdateFrame = MAX_uint64; }
+
+	/** Body mesh world bounds (broadphase, valid while queryable) */
+	FBoxSphereBounds GetQueryBounds() const;
+
+	/** Number of capsules (after build) */
+	int32 GetNumCapsules() const { return Capsules.Num(); }
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	// ============================================
+	// BONE-SPACE DEFINITION (built from physics asset)
+	// ============================================
+
+	struct FHitboxCapsule
+	{
+		int32 BoneIndex = INDEX_NONE;
+		int32 BodyIndex = INDEX_NONE;
+		FVector3f LocalA = FVector3f::ZeroVector;
+		FVector3f LocalB = FVector3f::ZeroVector;
+		float Radius = 0.0f;
+	};
+
+	TArray<FHitboxCapsule> Capsules;
+
+	// Per body index
+	TArray<FName> BodyBoneNames;
+	TArray<TWeakObjectPtr<UPhysicalMaterial>> BodyMaterials;
+
+	// ============================================
+	// WORLD-SPACE STATE (refreshed per frame)
+	// ============================================
+
+	// SoA cull spheres, padded to multiple of 4 (padding lanes never hit)
+	TArray<float> CullX;
+	TArray<float> CullY;
+	TArray<float> CullZ;
+	TArray<float> CullRadiusSq;
+
+	// Exact capsule segments
+	TArray<FVector3f> WorldA;
+	TArray<FVector3f> WorldB;
+	TArray<float> WorldRadius;
+
+	UPROPERTY()
+	TObjectPtr<USkeletalMeshComponent> BodyMesh;
+
+	TWeakObjectPtr<UPhysicsAsset> BuiltPhysicsAsset;
+
+	// UFPSHitboxSubsystem::BodyObjectType (cached at BeginPlay)
+	ECollisionChannel BodyObjectType = ECC_Pawn;
+
+	uint64 LastUpdateFrame = MAX_uint64;
+
+	/** Resolve body mesh via ICharacterMeshProviderInterface */
+	USkeletalMeshComponent* ResolveBodyMesh() const;
+
+	/** Build capsules from physics asset, compile damage multipliers */
+	void BuildHitboxes();
+
+	/** Rebuild if physics asset changed, refresh world state once per frame */
+	void UpdateHitboxes();
+};
@@ -16,7 +16,7 @@
  * - Track accumulated recoil (shot count, pitch/yaw offsets)
  * - Calculate recoil kick based on accumulation curve
  * - Apply visual feedback (camera kick for owner, weapon animation for remote)
- * - Interpolate recovery back to center
+ * - Evaluate recovery back to center in closed form (no tick)
  * - Apply ADS reduction modifier
  *
  * DOES NOT:
@@ -27,6 +27,10 @@
  *
  * ARCHITECTURE:
  * - NOT replicated - state tracking on all machines independently
+ * - TICK-FREE: state is anchored at the last shot (value + timestamp) and
+ *   evaluated lazily at query time. Recovery is an analytic function of
+ *   elapsed time, so results do not depend on frame rate and server/client
+ *   agree for the same shot timeline (spread uses GetRecoilFactor())
  * - LOCAL visual feedback (camera/weapon)
  * - Called by FPSCharacter::Multicast_ApplyRecoil() on all clients
  * - Component-based capability pattern (attached to FPSCharacter)
@@ -48,8 +52,6 @@ protected:
 	virtual void BeginPlay() override;
 
 public:
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
-
 	// ============================================
 	// DESIGNER DEFAULTS - RECOIL PATTERN
 	// ============================================
@@ -85,11 +87,17 @@ public:
 	// DESIGNER DEFAULTS - RECOVERY
 	// ============================================
 
-	// Recovery speed (degrees per second) - how fast camera returns to center
+	// Recovery speed (exponential rate, 1/s) - how fast camera returns to center
+	// Offset after recovery starts: Offset * exp(-RecoverySpeed * t)
 	// Subtle: 3.0-8.0, Fast: 15.0+ (arcade feel)
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "1 - Defaults|Recovery")
 	float RecoverySpeed = 5.0f;
 
+	// Accumulated shots decay rate (shots per second) once recovery starts
+	// Linear: 8 accumulated shots fully decay in 1.6s at 5.0
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "1 - Defaults|Recovery")
+	float ShotDecayRate = 5.0f;
+
 	// Delay before recovery starts (seconds)
 	// Quick: 0.05-0.15, Delayed: 0.3+ (sluggish)
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "1 - Defaults|Recovery")
@@ -107,20 +115,24 @@ public:
 	// ============================================
 	// RUNTIME STATE (LOCAL ONLY - NOT REPLICATED)
 	// ============================================
+	// Values below are ANCHORS captured at LastShotTime.
+	// Use the Get* evaluators for the current (recovered) values.
+	// Old names (CurrentRecoilPitch, CurrentRecoilYaw, ShotCount) redirect here (FPSCore.cpp)
 
-	// Current accumulated vertical recoil (degrees)
+	// Accumulated vertical recoil at last shot (degrees)
 	UPROPERTY(BlueprintReadOnly, Category = "Recoil|Runtime")
-	float CurrentRecoilPitch = 0.0f;
+	float AnchorRecoilPitch = 0.0f;
 
-	// Current accumulated horizontal recoil (degrees)
+	// Accumulated horizontal recoil at last shot (degrees)
 	UPROPERTY(BlueprintReadOnly, Category = "Recoil|Runtime")
-	float CurrentRecoilYaw = 0.0f;
+	float AnchorRecoilYaw = 0.0f;
 
-	// Shot count for accumulation calculation
+	// Accumulated shots at last shot (continuous, decays after RecoveryDelay)
 	UPROPERTY(BlueprintReadOnly, Category = "Recoil|Runtime")
-	int32 ShotCount = 0;
+	float AnchorShotCount = 0.0f;
 
-	// Time of last shot (for recovery delay)
+	// Time of last shot (world time seconds) - anchor for closed-form recovery
+	UPROPERTY(BlueprintReadOnly, Category = "Recoil|Runtime")
 	float LastShotTime = 0.0f;
 
 	// ============================================
@@ -129,7 +141,7 @@ public:
 
 	/**
 	 * Add recoil to state tracking (called on SERVER for accumulation)
-	 * Updates ShotCount and LastShotTime
+	 * Re-anchors accumulated shots and LastShotTime
 	 * Does NOT apply visual feedback (that happens in Multicast RPC)
 	 *
 	 * @param Scale - Recoil multiplier from FireComponent
@@ -168,10 +180,50 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Recoil")
 	void ResetRecoil();
 
+	// ============================================
+	// EVALUATION (CLOSED FORM, NO TICK)
+	// ============================================
+
+	/**
+	 * Accumulated shots at current world time
+	 * Linear decay at ShotDecayRate after RecoveryDelay, clamped at 0
+	 */
+	UFUNCTION(BlueprintPure, Category = "Recoil")
+	float GetAccumulatedShots() const;
+
+	/**
+	 * Normalized recoil factor at current world time
+	 * Returns: 0.0 (no shots) → 1.0 (sustained fire, MaxAccumulation reached)
+	 * Used for spread (server) and crosshair/lean feedback (local)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Recoil")
+	float GetRecoilFactor() const;
+
+	/** Remaining vertical recoil offset at current world time (degrees) */
+	UFUNCTION(BlueprintPure, Category = "Recoil")
+	float GetCurrentRecoilPitch() const;
+
+	/** Remaining horizontal recoil offset at current world time (degrees) */
+	UFUNCTION(BlueprintPure, Category = "Recoil")
+	float GetCurrentRecoilYaw() const;
+
+	/** Whole shots accumulated at current world time (former int32 ShotCount) */
+	UFUNCTION(BlueprintPure, Category = "Recoil", meta = (DeprecatedFunction, DeprecationMessage = "Use GetAccumulatedShots (continuous) or GetRecoilFactor"))
+	int32 GetShotCount() const { return FMath::FloorToInt(GetAccumulatedShots()); }
+
 protected:
 	/**
-	 * Get accumulation multiplier based on shot count
-	 * Returns: 1.0 → 2.0 based on (ShotCount / MaxAccumulation)
+	 * Get accumulation multiplier based on accumulated shots
+	 * Returns: 1.0 → 1.4 based on (AccumulatedShots / MaxAccumulation)
 	 */
 	float GetAccumulationMultiplier() const;
+
+	/** Seconds of active recovery at current time (0 while within RecoveryDelay) */
+	float GetRecoveryTime() const;
+
+	/**
+	 * Re-anchor state at current time (called on every shot)
+	 * Folds elapsed recovery into anchors, then adds one shot
+	 */
+	void RecordShot(float PitchKick, float YawKick);
 };
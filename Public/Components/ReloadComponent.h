@@ -47,14 +47,14 @@ protected:
 public:
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
+#if WITH_EDITORONLY_DATA
 	// ============================================
-	// DESIGNER DEFAULTS - ANIMATION
+	// DEPRECATED - folded into owner's WeaponDefinition on load (ABaseWeapon::MigrateDeprecatedTuning)
 	// ============================================
 
-	// Reload animation montage (shared by Body, Arms, Legs)
-	// Uses slot "DefaultGroup.UpperBody"
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "1 - Defaults|Animation")
-	UAnimMontage* ReloadMontage = nullptr;
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Moved to ABaseWeapon::WeaponDefinition"))
+	TObjectPtr<UAnimMontage> ReloadMontage_DEPRECATED = nullptr;
+#endif
 
 	// ============================================
 	// RUNTIME STATE (REPLICATED)
@@ -15,7 +15,7 @@
  * DOES:
  * - Override Shoot() to fire multiple pellets per shot
  * - Apply pellet-specific spread pattern (cone spread)
- * - Single HandleShotFired notification (one muzzle flash per shot)
+ * - Single HandleShotFired notification after pellets (one muzzle flash + tracer per shot)
  * - Multiple line traces (one per pellet)
  *
  * DOES NOT:
@@ -82,10 +82,11 @@ protected:
 	FVector ApplyPelletSpread(const FVector& Direction) const;
 
 	/**
-	 * Fire single pellet (line trace + damage + effects)
-	 * Calls base class hit processing logic
+	 * Fire single pellet (line trace now, damage + effects with the frame's hit batch)
+	 * Hits handed to base class SubmitTrace
 	 * @param Location - Muzzle location
 	 * @param Direction - Pellet direction (with spread applied)
+	 * @return Distance to first impact (MaxTraceDistance if nothing was hit)
 	 */
-	void ShootPellet(const FVector& Location, const FVector& Direction);
+	float ShootPellet(const FVector& Location, const FVector& Direction);
 };
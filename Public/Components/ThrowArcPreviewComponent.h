@@ -0,0 +1,134 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Items/GrenadeProjectile.h"
+#include "ThrowArcPreviewComponent.generated.h"
+
+/**
+ * UThrowArcPreviewComponent
+ *
+ * CAPABILITY: Throw Arc Preview
+ * Predicted flight path of a held throwable, drawn as instanced markers (single draw call)
+ *
+ * DOES:
+ * - Integrate projectile flight with AGrenadeProjectile tuning (speed, gravity, bounciness, friction)
+ * - Restart only when launch point / direction move beyond LocationThreshold / AngleThreshold
+ * - Finish the path in progress before restarting (latest launch held as pending)
+ * - Spread collision sweeps across frames (MaxSweepsPerFrame, PendingSweepsPerFrame while a restart waits)
+ * - Swap markers once per completed path (previous path stays shown meanwhile)
+ *
+ * DOES NOT:
+ * - Decide launch point / direction (→ IThrowableInterface::GetThrowLaunch on owner)
+ * - Decide when the preview is shown (→ ABaseGrenade: local owner holding, not throwing)
+ *
+ * SETUP:
+ * - Assign a marker Static Mesh in Blueprint defaults (no mesh = preview disabled, no cost)
+ *
+ * MULTIPLAYER:
+ * - Local only (owning client), never replicated, OnlyOwnerSee
+ */
+UCLASS(ClassGroup = (FPSCore), meta = (BlueprintSpawnableComponent))
+class FPSCORE_API UThrowArcPreviewComponent : public UInstancedStaticMeshComponent
+{
+	GENERATED_BODY()
+
+public:
+	UThrowArcPreviewComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	// ============================================
+	// CONFIGURATION
+	// ============================================
+
+	/** Launch point movement that restarts the prediction (cm) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Preview")
+	float LocationThreshold = 5.0f;
+
+	/** Launch direction change that restarts the prediction (degrees) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Preview")
+	float AngleThreshold = 0.5f;
+
+	/** Simulated time covered by one sweep (seconds) - free flight is exact, only collision granularity changes */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Preview")
+	float StepTime = 0.05f;
+
+	/** Collision sweeps per frame while a path is being predicted */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Preview")
+	int32 MaxSweepsPerFrame = 6;
+
+	/** Collision sweeps per frame while a newer launch waits for the current path to finish */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Preview")
+	int32 PendingSweepsPerFrame = 12;
+
+	/** Path ends after this many bounces */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Preview")
+	int32 MaxBounces = 2;
+
+	/** Path length in seconds (also capped by projectile FuseTime) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Preview")
+	float MaxSimulationTime = 3.0f;
+
+	/** Distance between markers along the path (cm) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Preview")
+	float MarkerSpacing = 40.0f;
+
+	/** Upper bound on marker instances */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Preview")
+	int32 MaxMarkers = 64;
+
+	// ============================================
+	// API
+	// ============================================
+
+	/** Start predicting for ProjectileClass (must derive from AGrenadeProjectile) */
+	void ShowPreview(TSubclassOf<AActor> InProjectileClass);
+
+	/** Stop predicting, remove markers */
+	void HidePreview();
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+private:
+	/** Begin a new path from launch point / direction */
+	void RestartSimulation(const FVector& Location, const FVector& Direction);
+
+	/** Advance current path by one sweep */
+	void StepSimulation();
+
+	/** Path complete - resample into markers */
+	void FinishSimulation();
+
+	/** Same response as UProjectileMovementComponent::ComputeBounceVelocity (no angle-scaled friction) */
+	FVector ComputeBounceVelocity(const FVector& InVelocity, const FVector& Normal) const;
+
+	// Projectile defaults (CDO of ShowPreview class)
+	TSubclassOf<AGrenadeProjectile> ProjectileClass;
+	ECollisionChannel SweepChannel = ECC_WorldDynamic;
+	FCollisionResponseParams SweepResponse;
+	float SweepRadius = 5.0f;
+	float SimulationDuration = 0.0f;
+
+	// Launch the current path was started from
+	FVector CachedLaunchLocation = FVector::ZeroVector;
+	FVector CachedLaunchDirection = FVector::ZeroVector;
+	bool bHasCachedLaunch = false;
+
+	// Latest launch beyond thresholds - started once the current path completes
+	FVector PendingLaunchLocation = FVector::ZeroVector;
+	FVector PendingLaunchDirection = FVector::ZeroVector;
+	bool bHasPendingLaunch = false;
+
+	// Path in progress
+	FGrenadeLaunchState SimState;
+	FVector SimLocation = FVector::ZeroVector;
+	FVector SimVelocity = FVector::ZeroVector;
+	float SimTime = 0.0f;
+	int32 SimBounces = 0;
+	bool bSimulating = false;
+	TArray<FVector> PathPoints;
+
+	// Marker transforms (reused between paths)
+	TArray<FTransform> MarkerTransforms;
+};
@@ -0,0 +1,82 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/StreamableManager.h"
+#include "FPSAssetPreloadSubsystem.generated.h"
+
+/**
+ * Asset Preload Subsystem
+ * Async streaming of held item assets between pickup and first equip
+ *
+ * SINGLE RESPONSIBILITY: Item asset preload + warm/cold tracking ONLY
+ *
+ * DOES:
+ * - PreloadItem (at pickup): async load anim layer, equip/unequip montages + IHoldableInterface::GetPreloadAssets
+ * - Second pass once loaded: soft references inside freshly loaded data assets (ammo effects)
+ * - Keeps streamable handles alive while item is held (ReleaseItem on drop)
+ * - NotifyEquip: counts equips that found the item still loading (STAT_FPSCore_ColdEquips)
+ *
+ * DOES NOT:
+ * - Block - equip proceeds with whatever is resident, cold equips are only reported
+ * - Decide what an item needs (→ IHoldableInterface::GetPreloadAssets)
+ *
+ * ARCHITECTURE:
+ * - Runs on every machine (each machine equips locally)
+ * - Own FStreamableManager (no AssetManager config required)
+ */
+UCLASS()
+class FPSCORE_API UFPSAssetPreloadSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Start async preload of everything Item needs once equipped (idempotent)
+	 * @param Item - IHoldableInterface item (others ignored)
+	 */
+	void PreloadItem(AActor* Item);
+
+	/** Drop streamable handles for Item (assets may unload once nothing else references them) */
+	void ReleaseItem(AActor* Item);
+
+	/**
+	 * Equip is starting - report if Item assets are still loading
+	 * @return true if everything was resident
+	 */
+	bool NotifyEquip(AActor* Item);
+
+	/** All requested assets for Item are loaded */
+	bool IsItemWarm(AActor* Item) const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+private:
+	struct FItemPreload
+	{
+		// First pass: anim layer, montages, item assets, data assets
+		TSharedPtr<FStreamableHandle> Handle;
+
+		// Second pass: soft references discovered inside first-pass assets
+		TSharedPtr<FStreamableHandle> NestedHandle;
+
+		// First pass completed and nested references were gathered
+		bool bNestedPassStarted = false;
+	};
+
+	FStreamableManager StreamableManager;
+
+	TMap<TWeakObjectPtr<AActor>, FItemPreload> Preloads;
+
+	/** Anim layer + equip/unequip montages + item-specific assets, unresolved only */
+	static void GatherUnloadedAssets(AActor* Item, TArray<FSoftObjectPath>& OutAssets);
+
+	/** First pass done → request newly reachable nested assets */
+	void OnPreloadComplete(TWeakObjectPtr<AActor> WeakItem);
+
+	static void ReleaseHandles(FItemPreload& Preload);
+};
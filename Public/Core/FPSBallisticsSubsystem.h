@@ -0,0 +1,75 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Components/BallisticsComponent.h"
+#include "FPSBallisticsSubsystem.generated.h"
+
+/**
+ * Ballistics Subsystem
+ * Per-frame batch of traced shots awaiting hit processing
+ *
+ * SINGLE RESPONSIBILITY: Hit batch scheduling ONLY
+ *
+ * DOES:
+ * - Collect traces submitted by UBallisticsComponents during the frame
+ * - Solve all traces in parallel (UBallisticsComponent::SolveTrace, worker threads)
+ * - Apply the resulting commands in one game-thread pass, in submission order
+ *   (UBallisticsComponent::ApplyHitCommands: damage, impulse, impact VFX, telemetry)
+ *
+ * DOES NOT:
+ * - Trace (→ UBallisticsComponent::TraceShot, at fire time)
+ * - Hold ballistic math (→ UBallisticsComponent)
+ * - Batch replay capture shots (solved immediately - outcomes read per shot)
+ *
+ * ARCHITECTURE:
+ * - UTickableWorldSubsystem, ticks only while traces are queued
+ * - Ticks after actor tick groups and timers - shots fired this frame are applied this frame
+ * - Solve is pure per trace (own inputs, own command list) - no locks
+ * - Traces of a destroyed component are dropped; actors destroyed by an earlier
+ *   command of the same batch are skipped
+ *
+ * MULTIPLAYER:
+ * - Server only in practice (UBallisticsComponent::Shoot is authority-gated)
+ */
+UCLASS()
+class FPSCORE_API UFPSBallisticsSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================
+	// CONFIGURATION
+	// ============================================
+
+	// Below this many queued traces the solve stays on the game thread (task dispatch costs more)
+	int32 MinParallelTraces = 4;
+
+	// ============================================
+	// API
+	// ============================================
+
+	/** Queue trace for this frame's batch */
+	void QueueTrace(FBallisticsTrace&& Trace);
+
+	/** Solve + apply all queued traces now */
+	void Flush();
+
+	// UTickableWorldSubsystem
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+private:
+	TArray<FBallisticsTrace> PendingTraces;
+
+	// Batch being solved / applied (kept for its allocation)
+	TArray<FBallisticsTrace> ActiveTraces;
+};
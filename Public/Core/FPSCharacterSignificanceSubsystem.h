@@ -0,0 +1,141 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FPSCharacterSignificanceSubsystem.generated.h"
+
+class AFPSCharacter;
+
+/**
+ * Detail level of a remote character proxy (lower = cheaper)
+ */
+UENUM(BlueprintType)
+enum class EFPSProxyDetail : uint8
+{
+	// Close, in view or fighting the local player - everything full rate
+	Full,
+
+	// Mid distance / edge of view - reduced anim rate, secondary-mesh montages off
+	Reduced,
+
+	// Far or off-screen - lowest anim rate, cosmetic montages and effects off
+	Minimal
+};
+
+/**
+ * Character Significance Subsystem
+ * Bounds client cost of remote AFPSCharacter proxies
+ *
+ * SINGLE RESPONSIBILITY: Proxy detail level ONLY
+ *
+ * DOES:
+ * - Score each simulated proxy by distance, view angle and combat relevance
+ * - Map score to EFPSProxyDetail (with hysteresis), cap proxies at Full detail
+ * - Push detail changes to the character (AFPSCharacter::ApplyProxyDetail)
+ * - Answer detail queries for cosmetic paths (montages, muzzle flash, recoil)
+ *
+ * DOES NOT:
+ * - Change gameplay state, replication or server-side animation
+ * - Apply per-mesh settings (→ AFPSCharacter::ApplyProxyDetail)
+ *
+ * ARCHITECTURE:
+ * - UTickableWorldSubsystem, one per world
+ * - Ticks only while characters are registered, re-scores every EvaluationInterval
+ * - Unregistered / non-proxy characters always report Full
+ *
+ * MULTIPLAYER:
+ * - Dedicated server: nothing registers
+ * - Clients / listen server: only ROLE_SimulatedProxy characters are scaled
+ *   (listen-server remotes are authority - bones drive hit registration)
+ */
+UCLASS()
+class FPSCORE_API UFPSCharacterSignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================
+	// BUDGET CONFIGURATION
+	// ============================================
+
+	// Time between re-scores (seconds)
+	float EvaluationInterval = 0.2f;
+
+	// Max proxies kept at Full detail (lowest scores demoted first)
+	int32 MaxFullDetailProxies = 8;
+
+	// Always Full inside this distance (cm)
+	float NearDistance = 1500.0f;
+
+	// Distance score reaches zero here (cm)
+	float FarDistance = 8000.0f;
+
+	// Half-angle considered "in view" (degrees)
+	float ViewHalfAngle = 50.0f;
+
+	// A proxy that fired / was hit within this time counts as in combat (seconds)
+	float CombatRelevanceTime = 3.0f;
+
+	// Score thresholds (hysteresis applied around each)
+	float FullScore = 0.6f;
+	float ReducedScore = 0.25f;
+	float ScoreHysteresis = 0.05f;
+
+	// ============================================
+	// API
+	// ============================================
+
+	/** Track character (no-op on dedicated server) */
+	void RegisterCharacter(AFPSCharacter* Character);
+
+	/** Stop tracking, restore Full detail (EndPlay) */
+	void UnregisterCharacter(AFPSCharacter* Character);
+
+	/** Character fired / was hit - raises significance for CombatRelevanceTime */
+	void NotifyCombatEvent(const AActor* Character);
+
+	/** Current detail of Character (Full if not tracked) */
+	EFPSProxyDetail GetDetail(const AActor* Character) const;
+
+	/** GetDetail through Character's world (Full if no subsystem) */
+	static EFPSProxyDetail GetDetailFor(const AActor* Character);
+
+	/** Convenience for cosmetic call sites */
+	static void NotifyCombatEventFor(const AActor* Character);
+
+	// UTickableWorldSubsystem
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FTrackedCharacter
+	{
+		TWeakObjectPtr<AFPSCharacter> Character;
+		EFPSProxyDetail Detail = EFPSProxyDetail::Full;
+		float Score = 1.0f;
+		float LastCombatTime = -1000.0f;
+	};
+
+	TArray<FTrackedCharacter> TrackedCharacters;
+
+	float TimeSinceEvaluation = 0.0f;
+
+	/** Re-score all entries and push detail changes */
+	void Evaluate();
+
+	/** 0..1 significance of Character for the best local viewpoint */
+	float ScoreCharacter(const AFPSCharacter* Character, bool bInCombat, const TArray<FTransform>& ViewPoints) const;
+
+	/** Score → detail with hysteresis around the current detail */
+	EFPSProxyDetail DetailForScore(float Score, EFPSProxyDetail Current) const;
+
+	FTrackedCharacter* FindEntry(const AActor* Character);
+	const FTrackedCharacter* FindEntry(const AActor* Character) const;
+};
@@ -0,0 +1,133 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tasks/Task.h"
+#include "FPSCombatReplaySubsystem.generated.h"
+
+class UBallisticsComponent;
+
+/**
+ * Recorded target pose at shot time (compact: location + quantized yaw, 18 bytes)
+ * Pawns stay upright - pitch / roll / scale are not recorded
+ */
+struct FFPSCombatTargetPose
+{
+	int32 TargetId = INDEX_NONE;
+	FVector3f Location = FVector3f::ZeroVector;
+
+	// FRotator::CompressAxisToShort
+	uint16 Yaw = 0;
+
+	friend FArchive& operator<<(FArchive& Ar, FFPSCombatTargetPose& Pose)
+	{
+		return Ar << Pose.TargetId << Pose.Location << Pose.Yaw;
+	}
+
+	FTransform ToTransform() const
+	{
+		return FTransform(FRotator(0.0f, FRotator::DecompressAxisFromShort(Yaw), 0.0f), FVector(Location));
+	}
+};
+
+/**
+ * Recorded fire input (everything UBallisticsComponent::ShootWithSeed needs)
+ */
+struct FFPSCombatShot
+{
+	double Time = 0.0;
+	FSoftClassPath WeaponClass;
+	FSoftObjectPath AmmoType;
+	FVector Location = FVector::ZeroVector;
+	FVector Direction = FVector::ForwardVector;
+	int32 Seed = 0;
+	TArray<FFPSCombatTargetPose> Targets;
+
+	friend FArchive& operator<<(FArchive& Ar, FFPSCombatShot& Shot)
+	{
+		return Ar << Shot.Time << Shot.WeaponClass << Shot.AmmoType << Shot.Location << Shot.Direction << Shot.Seed << Shot.Targets;
+	}
+};
+
+/**
+ * Combat Record & Replay Subsystem
+ * Reproducible ballistics workloads for offline benchmarking
+ *
+ * SINGLE RESPONSIBILITY: Record fire inputs, replay them deterministically ONLY
+ *
+ * DOES:
+ * - RECORD (-FPSCombatRecord, server): view point, spread-applied direction, seed,
+ *   weapon class, ammo type and pawn poses (location + yaw) for every seeded shot
+ * - REPLAY (standalone, e.g. -game -nullrhi): spawn weapons + target pawns, restore poses,
+ *   re-run ShootWithSeed in replay capture mode, time each shot
+ * - Digest of outcomes (target, bone, damage bits) for bit-for-bit before/after comparison
+ *
+ * DOES NOT:
+ * - Apply damage / spawn VFX during replay (ballistics replay capture skips side effects)
+ * - Reproduce animation poses (targets use pose of freshly spawned pawn - identical between runs)
+ *
+ * ARCHITECTURE:
+ * - Recording kept in memory, written to Saved/CombatRecordings/*.fpscombat on world teardown
+ *   or every MaxShotsPerRecording shots (one file per segment, memory stays bounded)
+ * - Full segments are moved to a background task that serializes + writes them (no game thread hitch);
+ *   Deinitialize waits for outstanding writes
+ * - Replay triggered from AFPSGameMode::ReplayCombat exec
+ *
+ * MULTIPLAYER:
+ * - Recording on authority only, replay is local (no networking)
+ */
+UCLASS(Config = Game)
+class FPSCORE_API UFPSCombatReplaySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Shots held in memory before the recording is written out as a segment file
+	// (DefaultGame.ini, [/Script/FPSCore.FPSCombatReplaySubsystem])
+	UPROPERTY(Config)
+	int32 MaxShotsPerRecording = 4096;
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/** True while recording */
+	bool IsRecording() const { return bRecording; }
+
+	/** Record seeded shot (called by UBallisticsComponent::ShootWithSeed) */
+	void RecordShot(const UBallisticsComponent* Ballistics, const FVector& Location, const FVector& Direction, int32 Seed);
+
+	/**
+	 * Replay recording against current world
+	 * @param FilePath - .fpscombat recording
+	 * @param ExpectedDigest - Optional digest of baseline run (empty = no comparison)
+	 * @return true if replay ran (and digest matched, when ExpectedDigest given)
+	 */
+	bool Replay(const FString& FilePath, const FString& ExpectedDigest);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	static constexpr uint32 FileMagic = 0x43535046; // 'FPSC'
+	static constexpr uint32 FileVersion = 2;
+
+	bool bRecording = false;
+
+	// Recorded shots of current segment (in memory until full or Deinitialize)
+	TArray<FFPSCombatShot> RecordedShots;
+
+	// Segment files written so far this session (file name suffix)
+	int32 RecordingSegment = 0;
+
+	// Target table: pawn → id, id → class
+	TMap<TWeakObjectPtr<APawn>, int32> TargetIds;
+	TArray<FSoftClassPath> TargetClasses;
+
+	// Last queued segment write (each write waits on the previous one - files complete in order)
+	UE::Tasks::FTask SaveTask;
+
+	/** Hand current segment to a background write (Saved/CombatRecordings), start the next one */
+	void SaveRecording();
+};
@@ -0,0 +1,87 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+/**
+ * FPSCore Stats
+ * Single stat group for all gameplay hot paths
+ *
+ * USAGE:
+ * - Console: stat FPSCore (cycle stats + per-frame counters)
+ * - Insights: -trace=cpu,stats (named CPU scopes + counters)
+ *
+ * CYCLE STATS: Fire/CanFire, Shoot, hit batch/solve/apply (solve on worker threads),
+ *   hitbox raycast/update, Character Tick phases, interaction trace, explosion damage,
+ *   RPC and OnRep bodies (aggregated; per-function names appear as Insights CPU scopes)
+ *
+ * COUNTERS (per frame): shots, hits, penetrations, RPCs executed
+ * - RPCs Executed counts RPC bodies run on this machine, not RPCs sent:
+ *   Server_ on server, Multicast_ on server and clients, Client_ on owner
+ * - RPC send rate and wire size (bits per RPC / bunch): Networking Insights (-trace=net), not counted here
+ *
+ * ACCUMULATORS (session): cold equips (item equipped before its pickup preload finished),
+ *   character skeletal meshes currently running their own pose evaluation (Body/Arms/Legs)
+ */
+
+DECLARE_STATS_GROUP(TEXT("FPSCore"), STATGROUP_FPSCore, STATCAT_Advanced);
+
+// Weapons / ballistics
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Fire"), STAT_FPSCore_Fire, STATGROUP_FPSCore, FPSCORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("CanFire"), STAT_FPSCore_CanFire, STATGROUP_FPSCore, FPSCORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Ballistics Shoot"), STAT_FPSCore_Shoot, STATGROUP_FPSCore, FPSCORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Ballistics Apply Hits"), STAT_FPSCore_ApplyHits, STATGROUP_FPSCore, FPSCORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Ballistics Solve Hits"), STAT_FPSCore_SolveHits, STATGROUP_FPSCore, FPSCORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Ballistics Hit Batch"), STAT_FPSCore_HitBatch, STATGROUP_FPSCore, FPSCORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Grenade Explosion Damage"), STAT_FPSCore_ExplosionDamage, STATGROUP_FPSCore, FPSCORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Throw Arc Preview"), STAT_FPSCore_ThrowArcPreview, STATGROUP_FPSCore, FPSCORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Hitbox Raycast"), STAT_FPSCore_HitboxRaycast, STATGROUP_FPSCore, FPSCORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Hitbox Update"), STAT_FPSCore_HitboxUpdate, STATGROUP_FPSCore, FPSCORE_API);
+
+// Character tick phases
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Character Tick"), STAT_FPSCore_CharacterTick, STATGROUP_FPSCore, FPSCORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Character Sprint Intent"), STAT_FPSCore_SprintIntent, STATGROUP_FPSCore, FPSCORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Character Interaction Trace"), STAT_FPSCore_InteractionTrace, STATGROUP_FPSCore, FPSCORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Character Aiming State"), STAT_FPSCore_AimingState, STATGROUP_FPSCore, FPSCORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Character Procedural Arms"), STAT_FPSCore_ProceduralArms, STATGROUP_FPSCore, FPSCORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Character Leaning Feedback"), STAT_FPSCore_LeaningFeedback, STATGROUP_FPSCore, FPSCORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Proxy Significance"), STAT_FPSCore_ProxySignificance, STATGROUP_FPSCore, FPSCORE_API);
+
+// UI
+DECLARE_CYCLE_STAT_EXTERN(TEXT("HUD Flush"), STAT_FPSCore_HUDFlush, STATGROUP_FPSCore, FPSCORE_API);
+
+// Networking
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RPC Bodies"), STAT_FPSCore_RPC, STATGROUP_FPSCore, FPSCORE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("OnRep Bodies"), STAT_FPSCore_OnRep, STATGROUP_FPSCore, FPSCORE_API);
+
+// Counters
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Shots Fired"), STAT_FPSCore_ShotsFired, STATGROUP_FPSCore, FPSCORE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Hits Processed"), STAT_FPSCore_HitsProcessed, STATGROUP_FPSCore, FPSCORE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Penetrations"), STAT_FPSCore_Penetrations, STATGROUP_FPSCore, FPSCORE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("RPCs Executed"), STAT_FPSCore_RPCsExecuted, STATGROUP_FPSCore, FPSCORE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("OnReps"), STAT_FPSCore_OnReps, STATGROUP_FPSCore, FPSCORE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("HUD Writes"), STAT_FPSCore_HUDWrites, STATGROUP_FPSCore, FPSCORE_API);
+
+// Accumulators (session totals)
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Cold Equips"), STAT_FPSCore_ColdEquips, STATGROUP_FPSCore, FPSCORE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Evaluated Character Meshes"), STAT_FPSCore_EvaluatedCharacterMeshes, STATGROUP_FPSCore, FPSCORE_API);
+
+/** Cycle stat + Insights CPU scope (scope named after the stat) */
+#define FPSCORE_SCOPE_CYCLE(Stat) \
+	TRACE_CPUPROFILER_EVENT_SCOPE(Stat); \
+	SCOPE_CYCLE_COUNTER(Stat)
+
+/** RPC body: named Insights scope, aggregated cycle stat, executed count */
+#define FPSCORE_SCOPE_RPC(Name) \
+	TRACE_CPUPROFILER_EVENT_SCOPE(Name); \
+	SCOPE_CYCLE_COUNTER(STAT_FPSCore_RPC); \
+	INC_DWORD_STAT(STAT_FPSCore_RPCsExecuted)
+
+/** OnRep body: named Insights scope, aggregated cycle stat, count */
+#define FPSCORE_SCOPE_ONREP(Name) \
+	TRACE_CPUPROFILER_EVENT_SCOPE(Name); \
+	SCOPE_CYCLE_COUNTER(STAT_FPSCore_OnRep); \
+	INC_DWORD_STAT(STAT_FPSCore_OnReps)
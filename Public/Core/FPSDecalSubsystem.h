@@ -0,0 +1,114 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FPSDecalSubsystem.generated.h"
+
+class UMaterialInterface;
+class UDecalComponent;
+
+/**
+ * Decal Subsystem
+ * Bullet hole placement on clients
+ *
+ * SINGLE RESPONSIBILITY: Bullet hole decal pooling + placement ONLY
+ *
+ * DOES:
+ * - Distance cull bullet holes against local player cameras (MaxDecalDistance)
+ * - Queue placements, flush once per frame (MaxPlacementsPerFrame, remainder carried over)
+ * - Fixed-capacity ring buffer of decal components per decal material
+ *   (created on demand up to MaxDecalsPerMaterial, then the oldest slot is moved)
+ *
+ * DOES NOT:
+ * - Decide which surfaces get holes (→ UBallisticsComponent::ApplyHitCommands: no skeletal / movable surfaces)
+ * - Decide which decal to use (→ UAmmoTypeDataAsset::ImpactDecalMap)
+ * - Run on dedicated server (nothing renders there)
+ *
+ * ARCHITECTURE:
+ * - UTickableWorldSubsystem, ticks only while placements are queued
+ * - Decal count (memory + draw cost) bounded by MaxDecalsPerMaterial * decal materials,
+ *   independent of match length
+ * - Fed by ABaseWeapon::Multicast_SpawnImpactEffect
+ */
+UCLASS()
+class FPSCORE_API UFPSDecalSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================
+	// CONFIGURATION
+	// ============================================
+
+	// Ring buffer size per decal material (oldest hole reused when full)
+	int32 MaxDecalsPerMaterial = 128;
+
+	// Decals placed per frame (all materials), remainder placed next frame
+	int32 MaxPlacementsPerFrame = 16;
+
+	// Queued placements kept at most, newest dropped beyond this
+	int32 MaxQueuedPlacements = 64;
+
+	// Holes farther than this from every local camera are not placed (cm)
+	float MaxDecalDistance = 6000.0f;
+
+	// Decal box extent (X = projection depth, Y/Z = hole half size)
+	FVector DecalSize = FVector(4.0f, 5.0f, 5.0f);
+
+	// Screen size below which decals fade out (renderer culls small decals)
+	float DecalFadeScreenSize = 0.002f;
+
+	// ============================================
+	// API
+	// ============================================
+
+	/**
+	 * Queue bullet hole for placement (next subsystem tick)
+	 * @param Material - Decal material (one ring buffer per material)
+	 * @param Location - World impact point
+	 * @param Normal - Surface normal
+	 */
+	void AddDecal(UMaterialInterface* Material, const FVector& Location, const FVector& Normal);
+
+	// UTickableWorldSubsystem
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+private:
+	struct FPendingDecal
+	{
+		TWeakObjectPtr<UMaterialInterface> Material;
+		FVector Location = FVector::ZeroVector;
+		FVector Normal = FVector::UpVector;
+	};
+
+	struct FDecalRing
+	{
+		// Grows to MaxDecalsPerMaterial, never shrinks
+		TArray<TWeakObjectPtr<UDecalComponent>> Slots;
+		int32 NextSlot = 0;
+	};
+
+	TMap<TWeakObjectPtr<UMaterialInterface>, FDecalRing> Rings;
+
+	// Owns ring components (outered to the world, not to an actor - only this keeps them from GC)
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UDecalComponent>> DecalComponents;
+
+	// FIFO, placed at most MaxPlacementsPerFrame per tick
+	TArray<FPendingDecal> PendingDecals;
+
+	/** Within MaxDecalDistance of any local player camera */
+	bool IsWithinCullDistance(const FVector& Location) const;
+
+	/** Move oldest slot (or new component while ring isn't full) to the hole */
+	void PlaceDecal(const FPendingDecal& Pending);
+};
@@ -0,0 +1,135 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FPSDroppedItemSubsystem.generated.h"
+
+class UPrimitiveComponent;
+class UStaticMeshComponent;
+
+/**
+ * Dropped Item Subsystem
+ * Bounds physics + replication cost of items lying in the world
+ *
+ * SINGLE RESPONSIBILITY: Dropped item lifecycle ONLY
+ *
+ * DOES:
+ * - Track dropped items (PerformDrop / UDroppedItemComponent::BeginPlay) in drop order
+ * - Detect rest (physics asleep or slow for SettleTime) and freeze physics
+ * - Publish final transform once (UDroppedItemComponent::RestState), then net-dormant
+ * - Swap to static mesh proxy at rest (or frozen skeletal pose snapshot)
+ * - Cap items per world (oldest destroyed first) - real drops only, level-placed
+ *   pickups get rest/dormancy handling but are never destroyed by the cap
+ * - Wake on pickup: restore mesh, flush dormancy
+ *
+ * DOES NOT:
+ * - Drop / pickup attachment (→ AFPSCharacter::PerformDrop / PerformPickup)
+ * - Decide if item can be picked (→ IPickupableInterface)
+ *
+ * ARCHITECTURE:
+ * - UTickableWorldSubsystem, one per world
+ * - Ticks only while at least one dropped item simulates (authority only)
+ * - Physics mesh = IHoldableInterface::GetTPSMeshComponent (non-root, simulates detached)
+ * - Budget tunable per project: DefaultGame.ini, [/Script/FPSCore.FPSDroppedItemSubsystem]
+ *
+ * MULTIPLAYER:
+ * - Server: rest detection, caps, dormancy
+ * - Clients: simulate drop locally (Multicast_DropItem), freeze + snap to server transform on OnRep
+ */
+UCLASS(Config = Game)
+class FPSCORE_API UFPSDroppedItemSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================
+	// BUDGET CONFIGURATION
+	// ============================================
+
+	// Max dropped items per world (oldest destroyed when exceeded, level-placed items not counted)
+	UPROPERTY(Config)
+	int32 MaxDroppedItems = 48;
+
+	// Max linear speed (cm/s) considered "at rest"
+	UPROPERTY(Config)
+	float SettleLinearSpeed = 5.0f;
+
+	// Max angular speed (deg/s) considered "at rest"
+	UPROPERTY(Config)
+	float SettleAngularSpeed = 10.0f;
+
+	// Time at rest before freezing (seconds)
+	UPROPERTY(Config)
+	float SettleTime = 0.5f;
+
+	// Hard cap on simulation time per item (seconds)
+	UPROPERTY(Config)
+	float MaxSimulationTime = 10.0f;
+
+	// ============================================
+	// API
+	// ============================================
+
+	/**
+	 * SERVER: item left a character and simulates physics (re-registering restarts tracking)
+	 * @param bCountTowardCap - false for level-placed pickups (never evicted by MaxDroppedItems)
+	 */
+	void RegisterDroppedItem(AActor* Item, bool bCountTowardCap = true);
+
+	/** Item picked up / leaving world - restore mesh, wake replication (safe for untracked items) */
+	void UnregisterItem(AActor* Item);
+
+	/** CLIENT: server published rest transform - freeze local simulation and snap */
+	void ApplyRestState(AActor* Item, const FTransform& RestTransform);
+
+	/** Items currently tracked (simulating + resting) */
+	int32 GetNumDroppedItems() const { return SimulatingItems.Num() + RestingItems.Num(); }
+
+	// UTickableWorldSubsystem
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FSimulatingItem
+	{
+		TWeakObjectPtr<AActor> Item;
+		TWeakObjectPtr<UPrimitiveComponent> Mesh;
+		float DropTime = 0.0f;
+		float RestTime = 0.0f;
+		bool bCountTowardCap = true;
+	};
+
+	struct FRestingItem
+	{
+		TWeakObjectPtr<AActor> Item;
+		TWeakObjectPtr<UPrimitiveComponent> Mesh;
+		TWeakObjectPtr<UStaticMeshComponent> Proxy;
+		float DropTime = 0.0f;
+		bool bCountTowardCap = true;
+	};
+
+	// Both oldest first
+	TArray<FSimulatingItem> SimulatingItems;
+	TArray<FRestingItem> RestingItems;
+
+	/** Stop simulation, re-attach mesh to root at RestTransform, swap to proxy */
+	void FreezeItem(AActor* Item, UPrimitiveComponent* Mesh, const FTransform& RestTransform, float DropTime, bool bCountTowardCap);
+
+	/** Undo FreezeItem visuals (proxy, pose snapshot) */
+	static void ThawItem(const FRestingItem& Entry);
+
+	/** Destroy oldest capped items until below MaxDroppedItems (authority) */
+	void EnforceItemCap();
+
+	/** Remove entries for Item from both lists (ThawItem on resting entries) */
+	void RemoveEntries(AActor* Item);
+
+	static UPrimitiveComponent* GetPhysicsMesh(AActor* Item);
+};
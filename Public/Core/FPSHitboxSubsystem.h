@@ -0,0 +1,87 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CollisionQueryParams.h"
+#include "FPSHitboxSubsystem.generated.h"
+
+class UHitboxComponent;
+
+/**
+ * Hitbox Subsystem
+ * Character layer of bullet queries
+ *
+ * SINGLE RESPONSIBILITY: Registry of character hitboxes + ray queries against them ONLY
+ *
+ * DOES:
+ * - Track UHitboxComponents (register on BeginPlay, unregister on EndPlay)
+ * - Exclude hitbox-owned body meshes from physics bullet traces by object type (BodyObjectType,
+ *   ignored through the trace's response params - no per-shot ignore list)
+ * - Ray vs all characters: bounds sphere broadphase, then per-character capsule test
+ * - Benchmark hitbox queries vs physics-asset traces (AFPSGameMode::BenchmarkHitboxes)
+ *
+ * DOES NOT:
+ * - Own capsule geometry (→ UHitboxComponent)
+ * - Process hits / damage (→ UBallisticsComponent)
+ *
+ * ARCHITECTURE:
+ * - Body meshes of registered characters use BodyObjectType; meshes with another type
+ *   (ragdoll PhysicsBody) are answered by the physics trace instead of the hitbox layer
+ * - Pawn meshes that should take bullets without a UHitboxComponent need a different object type
+ *   (or point BodyObjectType at a dedicated project object channel, e.g. "Hitbox")
+ * - One hit per character (nearest body), like a blocking body query
+ * - Hits appended with Distance set - caller merges with world hits by distance
+ *
+ * MULTIPLAYER:
+ * - Local per machine, queried where ballistics run (server)
+ */
+UCLASS(Config = Game)
+class FPSCORE_API UFPSHitboxSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Object type of hitbox-owned body meshes - skipped by physics bullet traces
+	// (DefaultGame.ini, [/Script/FPSCore.FPSHitboxSubsystem])
+	UPROPERTY(Config)
+	TEnumAsByte<ECollisionChannel> BodyObjectType = ECC_Pawn;
+
+	void RegisterHitbox(UHitboxComponent* Hitbox);
+	void UnregisterHitbox(UHitboxComponent* Hitbox);
+
+	/** Physics bullet trace = world only: ignore BodyObjectType (characters come from Raycast) */
+	void ExcludeHitboxBodies(FCollisionResponseParams& ResponseParams) const
+	{
+		ResponseParams.CollisionResponse.SetResponse(BodyObjectType, ECR_Ignore);
+	}
+
+	/**
+	 * Ray vs all registered characters
+	 * @param Start - Ray origin
+	 * @param End - Ray end (clamp to first blocking world hit)
+	 * @param IgnoredActors - Owners to skip (shooter, weapon)
+	 * @param OutHits - Nearest hit per character appended (not sorted)
+	 * @return Number of hits appended
+	 */
+	int32 Raycast(const FVector& Start, const FVector& End, TConstArrayView<const AActor*> IgnoredActors, TArray<FHitResult>& OutHits) const;
+
+	/** Force world-space refresh of all hitboxes (poses changed mid-frame, e.g. combat replay teleports) */
+	void InvalidateHitboxes();
+
+	/**
+	 * Time hitbox queries vs physics-asset traces against the same characters
+	 * Pads the world with copies of the first registered character up to NumPlayers
+	 * @param NumPlayers - Characters to test against (default 64)
+	 * @param NumRays - Rays aimed at random characters
+	 */
+	void Benchmark(int32 NumPlayers, int32 NumRays);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	UPROPERTY()
+	TArray<TObjectPtr<UHitboxComponent>> Hitboxes;
+};
@@ -0,0 +1,109 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FPSImpactEffectSubsystem.generated.h"
+
+class UNiagaraSystem;
+class UNiagaraComponent;
+
+/**
+ * Impact Effect Subsystem
+ * Batched bullet impact rendering on clients
+ *
+ * SINGLE RESPONSIBILITY: Impact VFX submission (budget, culling, batching) ONLY
+ *
+ * DOES:
+ * - Distance cull impacts against local player cameras (MaxImpactDistance)
+ * - Per-frame impact budget (MaxImpactsPerFrame, excess dropped)
+ * - BATCHED systems: one long-lived NiagaraComponent per impact VFX asset,
+ *   this frame's impacts written to its array user parameters once per frame
+ * - Other systems: fallback to pooled SpawnSystemAtLocation per impact
+ *
+ * DOES NOT:
+ * - Decide which VFX to play (→ UAmmoTypeDataAsset via UBallisticsComponent)
+ * - Run on dedicated server (nothing renders there)
+ *
+ * BATCHED SYSTEM CONTRACT (Niagara asset authoring):
+ * - User parameter "ImpactPositions" (Array Position) and "ImpactNormals" (Array Vector)
+ * - Arrays hold ONLY impacts of the current frame (emptied the frame after)
+ * - Emitter spawns a burst of particles per array entry per frame (world space, local space off)
+ * - Systems without "ImpactPositions" keep the per-impact spawn path
+ *
+ * ARCHITECTURE:
+ * - UTickableWorldSubsystem, ticks only while batches have impacts to flush / clear
+ * - Fed by ABaseWeapon::Multicast_SpawnImpactEffect
+ */
+UCLASS()
+class FPSCORE_API UFPSImpactEffectSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================
+	// BUDGET CONFIGURATION
+	// ============================================
+
+	// Impacts rendered per frame (all systems), excess dropped
+	int32 MaxImpactsPerFrame = 64;
+
+	// Impacts farther than this from every local camera are dropped (cm)
+	float MaxImpactDistance = 6000.0f;
+
+	// ============================================
+	// API
+	// ============================================
+
+	/**
+	 * Submit impact for rendering this frame
+	 * @param System - Impact VFX (batched if it exposes ImpactPositions)
+	 * @param Location - World impact point
+	 * @param Normal - Surface normal
+	 */
+	void AddImpact(UNiagaraSystem* System, const FVector& Location, const FVector& Normal);
+
+	// UTickableWorldSubsystem
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+private:
+	struct FImpactBatch
+	{
+		TWeakObjectPtr<UNiagaraComponent> Component;
+		TArray<FVector> Positions;
+		TArray<FVector> Normals;
+
+		// Arrays written last frame - must be emptied so particles don't respawn
+		bool bNeedsClear = false;
+	};
+
+	// Per batched VFX asset
+	TMap<TWeakObjectPtr<UNiagaraSystem>, FImpactBatch> Batches;
+
+	// Per VFX asset: exposes ImpactPositions (checked once)
+	TMap<TWeakObjectPtr<UNiagaraSystem>, bool> BatchableSystems;
+
+	// Budget window
+	uint64 BudgetFrame = 0;
+	int32 ImpactsThisFrame = 0;
+
+	// Any batch has impacts to flush or arrays to clear
+	bool bHasPendingWork = false;
+
+	/** True if System exposes the ImpactPositions array user parameter (cached) */
+	bool IsBatchable(UNiagaraSystem* System);
+
+	/** Within MaxImpactDistance of any local player camera */
+	bool IsWithinCullDistance(const FVector& Location) const;
+
+	/** Long-lived component for batched System (spawned on first use) */
+	UNiagaraComponent* GetBatchComponent(UNiagaraSystem* System, FImpactBatch& Batch);
+};
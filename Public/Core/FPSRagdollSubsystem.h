@@ -0,0 +1,111 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FPSRagdollSubsystem.generated.h"
+
+class USkeletalMeshComponent;
+
+/**
+ * Ragdoll Budget Subsystem
+ * Bounds physics cost of dead characters
+ *
+ * SINGLE RESPONSIBILITY: Ragdoll simulation budget ONLY
+ *
+ * DOES:
+ * - Start ragdoll simulation on request (below root bone, e.g. pelvis)
+ * - Cap concurrent simulated ragdolls (oldest is frozen when cap is exceeded)
+ * - Detect settled ragdolls (low velocity for SettleTime) and freeze them
+ * - Freeze = static pose snapshot (physics off, no bone refresh, no tick)
+ * - Skip cosmetic ragdoll on dedicated server entirely
+ *
+ * DOES NOT:
+ * - Character state (capsule, movement, visibility → FPSCharacter)
+ * - Replication (ragdoll is cosmetic, runs locally per machine)
+ *
+ * ARCHITECTURE:
+ * - UTickableWorldSubsystem, one per world
+ * - Ticks only while at least one ragdoll is simulating
+ * - Weak references - destroyed meshes are dropped silently
+ * - Budget tunable per project: DefaultGame.ini, [/Script/FPSCore.FPSRagdollSubsystem]
+ *
+ * MULTIPLAYER:
+ * - Dedicated server: BeginRagdoll returns false, mesh keeps animated pose
+ * - Listen server / clients: local budget per machine
+ */
+UCLASS(Config = Game)
+class FPSCORE_API UFPSRagdollSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================
+	// BUDGET CONFIGURATION
+	// ============================================
+
+	// Max ragdolls simulating at once (oldest frozen first when exceeded)
+	UPROPERTY(Config)
+	int32 MaxSimulatedRagdolls = 6;
+
+	// Max body linear speed (cm/s) considered "at rest"
+	UPROPERTY(Config)
+	float SettleVelocityThreshold = 15.0f;
+
+	// Time at rest before freezing (seconds)
+	UPROPERTY(Config)
+	float SettleTime = 0.5f;
+
+	// Hard cap on simulation time per ragdoll (seconds)
+	UPROPERTY(Config)
+	float MaxSimulationTime = 8.0f;
+
+	// ============================================
+	// API
+	// ============================================
+
+	/**
+	 * Start ragdoll on mesh (bodies below RootBone simulate)
+	 * @return false if ragdoll skipped (dedicated server) - caller keeps animated pose
+	 */
+	bool BeginRagdoll(USkeletalMeshComponent* Mesh, FName RootBone);
+
+	/**
+	 * Stop ragdoll and restore mesh to animated state (respawn)
+	 * Safe to call for meshes that were never registered
+	 */
+	void EndRagdoll(USkeletalMeshComponent* Mesh);
+
+	/** Number of ragdolls currently simulating */
+	int32 GetNumSimulatedRagdolls() const { return ActiveRagdolls.Num(); }
+
+	// UTickableWorldSubsystem
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FActiveRagdoll
+	{
+		TWeakObjectPtr<USkeletalMeshComponent> Mesh;
+		float StartTime = 0.0f;
+		float RestTime = 0.0f;
+	};
+
+	// Simulating ragdolls, oldest first
+	TArray<FActiveRagdoll> ActiveRagdolls;
+
+	// Frozen ragdolls (pose snapshot) - tracked so EndRagdoll can restore them
+	TArray<TWeakObjectPtr<USkeletalMeshComponent>> FrozenRagdolls;
+
+	/** Stop simulation and keep current pose as static snapshot */
+	void FreezeRagdoll(USkeletalMeshComponent* Mesh);
+
+	/** Max linear speed across simulated bodies (cm/s) */
+	static float GetMaxBodySpeed(const USkeletalMeshComponent* Mesh);
+};
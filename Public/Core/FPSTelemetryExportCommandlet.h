@@ -0,0 +1,33 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "FPSTelemetryExportCommandlet.generated.h"
+
+/**
+ * Telemetry Export Commandlet
+ * Converts binary shot/hit recordings (.fpstel) to CSV
+ *
+ * SINGLE RESPONSIBILITY: Offline conversion ONLY
+ *
+ * USAGE:
+ *   <Editor>-Cmd <Project> -run=FPSTelemetryExport -In=<File.fpstel> [-Out=<BasePath>]
+ *   Writes <BasePath>_shots.csv and <BasePath>_hits.csv (BasePath defaults to input path without extension)
+ *
+ * ARCHITECTURE:
+ * - Record layout shared with UFPSTelemetrySubsystem (FPSTelemetrySubsystem.h)
+ * - Name ids resolved via Name records (always precede first use)
+ * - Hits join to shots by ShotId
+ */
+UCLASS()
+class FPSCORE_API UFPSTelemetryExportCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UFPSTelemetryExportCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
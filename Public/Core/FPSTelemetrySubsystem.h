@@ -0,0 +1,138 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FPSTelemetrySubsystem.generated.h"
+
+class FFPSTelemetryWriter;
+
+// ============================================
+// BINARY RECORD FORMAT
+// ============================================
+// File: FFPSTelemetryFileHeader followed by fixed-size FFPSTelemetryRecord entries
+// Names are interned per file: a Name record precedes the first record referencing its id
+
+enum class EFPSTelemetryRecordType : uint8
+{
+	Shot,
+	Hit,
+	Name
+};
+
+struct FFPSTelemetryShot
+{
+	double Time;			// World time (seconds)
+	uint32 ShotId;			// Unique per file, referenced by hits
+	uint32 ShooterName;		// Name id
+	uint32 WeaponName;		// Name id (weapon class)
+	int32 Seed;				// Spread RNG seed (0 = unseeded)
+	float Origin[3];		// World location (cm) - plain floats keep the record trivially copyable
+	float Direction[3];		// Unit vector
+};
+
+struct FFPSTelemetryHit
+{
+	double Time;
+	uint32 ShotId;
+	uint32 ActorName;		// Name id
+	uint32 BoneName;		// Name id
+	uint32 MaterialName;	// Name id
+	float Speed;			// m/s at impact
+	float KineticEnergy;	// Joules at impact
+	float Damage;			// Applied damage (before bone multipliers)
+};
+
+struct FFPSTelemetryName
+{
+	uint32 Id;
+	ANSICHAR Text[44];		// Truncated, null-terminated
+};
+
+struct FFPSTelemetryRecord
+{
+	EFPSTelemetryRecordType Type;
+	uint8 Padding[7];
+
+	union
+	{
+		FFPSTelemetryShot Shot;
+		FFPSTelemetryHit Hit;
+		FFPSTelemetryName Name;
+	};
+};
+
+static_assert(sizeof(FFPSTelemetryRecord) == 56, "Telemetry record layout changed - bump FFPSTelemetryFileHeader::CurrentVersion");
+static_assert(TIsTriviallyDestructible<FFPSTelemetryRecord>::Value, "Telemetry records are copied as raw bytes");
+
+struct FFPSTelemetryFileHeader
+{
+	static constexpr uint32 ExpectedMagic = 0x54535046; // 'FPST'
+	static constexpr uint32 CurrentVersion = 1;
+
+	uint32 Magic = ExpectedMagic;
+	uint32 Version = CurrentVersion;
+	uint32 RecordSize = sizeof(FFPSTelemetryRecord);
+	uint32 Reserved = 0;
+};
+
+/**
+ * Shot/Hit Telemetry Subsystem
+ * Per-shot balancing / hit-reg data at near-zero game thread cost
+ *
+ * SINGLE RESPONSIBILITY: Record shots and hits to binary file ONLY
+ *
+ * DOES:
+ * - Copy fixed-size POD records into lock-free SPSC ring buffer (game thread)
+ * - Drain ring to Saved/Telemetry/*.fpstel on background thread
+ * - Intern names (shooter, weapon, actor, bone, material) as per-file ids
+ * - Drop records (counted) when ring is full - never blocks game thread
+ *
+ * DOES NOT:
+ * - Text formatting / logging (offline: FPSTelemetryExport commandlet → CSV)
+ * - Gameplay decisions
+ *
+ * ARCHITECTURE:
+ * - Enabled with -FPSTelemetry on server (authority worlds only)
+ * - Producer: BallisticsComponent (Shoot / ApplyHitCommands), game thread only
+ * - Consumer: FFPSTelemetryWriter (FRunnable, buffered sequential writes)
+ *
+ * MULTIPLAYER:
+ * - Server only (clients never record)
+ */
+UCLASS()
+class FPSCORE_API UFPSTelemetrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/** True while recording (check before gathering record data) */
+	bool IsRecording() const { return Writer != nullptr; }
+
+	/**
+	 * Record shot (returns ShotId for subsequent hits, 0 if not recording)
+	 */
+	uint32 RecordShot(const AActor* Shooter, const AActor* Weapon, const FVector& Origin, const FVector& Direction, int32 Seed = 0);
+
+	/** Record hit of previously recorded shot */
+	void RecordHit(uint32 ShotId, const AActor* HitActor, FName BoneName, FName MaterialName, float Speed, float KineticEnergy, float Damage);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	// Owned - created in OnWorldBeginPlay, flushed + deleted in Deinitialize
+	FFPSTelemetryWriter* Writer = nullptr;
+
+	// Per-file name ids (game thread only)
+	TMap<FName, uint32> NameIds;
+
+	uint32 NextShotId = 1;
+
+	/** Get id for name, pushing Name record on first use */
+	uint32 InternName(FName Name);
+};
@@ -0,0 +1,120 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FPSTracerSubsystem.generated.h"
+
+class UStaticMesh;
+class UInstancedStaticMeshComponent;
+
+/**
+ * Tracer Subsystem
+ * Bullet tracer rendering on clients
+ *
+ * SINGLE RESPONSIBILITY: Tracer simulation + batched submission ONLY
+ *
+ * DOES:
+ * - Fixed-capacity ring buffer per tracer mesh (oldest tracer overwritten when full)
+ * - Tracer = streak of TracerLength moving at TracerSpeed from origin to first impact
+ * - Per frame: cull by distance + view cone, write visible streaks into one
+ *   instanced static mesh per tracer mesh (one draw, no per-tracer allocation)
+ *
+ * DOES NOT:
+ * - Decide which shots get tracers (→ ABaseWeapon::Multicast_PlayShootEffects)
+ * - Run on dedicated server (nothing renders there)
+ *
+ * ARCHITECTURE:
+ * - UTickableWorldSubsystem, ticks only while tracers are in flight (plus one frame to hide them)
+ * - Instances are allocated once (TracerCapacity), hidden slots get zero scale
+ */
+UCLASS()
+class FPSCORE_API UFPSTracerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================
+	// CONFIGURATION
+	// ============================================
+
+	// Ring buffer size per tracer mesh (instances allocated up front)
+	int32 TracerCapacity = 256;
+
+	// Streak travel speed (cm/s) - visual only, slower than real muzzle velocity
+	float TracerSpeed = 30000.0f;
+
+	// Streak length (cm)
+	float TracerLength = 400.0f;
+
+	// Streak thickness (mesh Y/Z scale)
+	float TracerWidth = 1.5f;
+
+	// Streak skipped within this distance of its origin (shooter's own view)
+	float TracerStartOffset = 150.0f;
+
+	// Tracers farther than this from every local camera are not drawn (cm)
+	float MaxTracerDistance = 15000.0f;
+
+	// ============================================
+	// API
+	// ============================================
+
+	/**
+	 * Start tracer (overwrites oldest slot if ring is full)
+	 * @param Mesh - Tracer streak mesh (one batch per mesh)
+	 * @param Origin - Shot origin
+	 * @param Direction - Unit shot direction
+	 * @param Distance - Distance to first impact
+	 */
+	void AddTracer(UStaticMesh* Mesh, const FVector& Origin, const FVector& Direction, float Distance);
+
+	// UTickableWorldSubsystem
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+private:
+	struct FTracer
+	{
+		FVector Origin = FVector::ZeroVector;
+		FVector Direction = FVector::ForwardVector;
+		float Distance = 0.0f;
+		double StartTime = 0.0;
+		bool bActive = false;
+	};
+
+	struct FTracerBatch
+	{
+		TWeakObjectPtr<UInstancedStaticMeshComponent> Instances;
+
+		// Ring buffer (fixed size = TracerCapacity)
+		TArray<FTracer> Tracers;
+		int32 NextSlot = 0;
+		int32 NumActive = 0;
+
+		// Per-instance transforms written each frame (reused, no allocation)
+		TArray<FTransform> Transforms;
+
+		// Instances visible last frame - must be hidden once
+		bool bNeedsHide = false;
+	};
+
+	TMap<TWeakObjectPtr<UStaticMesh>, FTracerBatch> Batches;
+
+	// Owns batch components (outered to the world, not to an actor - only this keeps them from GC)
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UInstancedStaticMeshComponent>> BatchComponents;
+
+	// Any batch has tracers in flight or instances to hide
+	bool bHasPendingWork = false;
+
+	/** Instanced mesh component for batch (created with TracerCapacity hidden instances on first use) */
+	UInstancedStaticMeshComponent* GetBatchInstances(UStaticMesh* Mesh, FTracerBatch& Batch);
+};
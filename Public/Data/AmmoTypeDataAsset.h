@@ -9,6 +9,8 @@
 #include "Core/AmmoCaliberTypes.h"
 #include "AmmoTypeDataAsset.generated.h"
 
+class UMaterialInterface;
+
 /**
  * Data asset for ammunition types
  * Contains ballistic properties, damage stats, and impact effects per material
@@ -104,6 +106,11 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Ammo|Effects")
 	TMap<FName, TSoftObjectPtr<UNiagaraSystem>> ImpactVFXMap;
 
+	// Material-specific bullet hole decals (Key = Physical Material name, same keys as ImpactVFXMap)
+	// Only placed on static/stationary non-skeletal surfaces (see UFPSDecalSubsystem)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Ammo|Effects")
+	TMap<FName, TSoftObjectPtr<UMaterialInterface>> ImpactDecalMap;
+
 	// ============================================
 	// HELPERS
 	// ============================================
@@ -121,4 +128,39 @@ public:
 		}
 		return nullptr;
 	}
+
+	/**
+	 * Collect soft references for async preload (UFPSAssetPreloadSubsystem)
+	 * @param bIncludeCosmetics - Shell mesh, impact VFX and decals (false on dedicated server)
+	 */
+	void GetPreloadAssets(TArray<FSoftObjectPath>& OutAssets, bool bIncludeCosmetics) const
+	{
+		if (!bIncludeCosmetics)
+		{
+			return;
+		}
+
+		OutAssets.Add(AmmoShell.ToSoftObjectPath());
+		for (const TPair<FName, TSoftObjectPtr<UNiagaraSystem>>& Pair : ImpactVFXMap)
+		{
+			OutAssets.Add(Pair.Value.ToSoftObjectPath());
+		}
+		for (const TPair<FName, TSoftObjectPtr<UMaterialInterface>>& Pair : ImpactDecalMap)
+		{
+			OutAssets.Add(Pair.Value.ToSoftObjectPath());
+		}
+	}
+
+	/**
+	 * Get bullet hole decal for specific physical material
+	 * Not loaded - server only forwards the reference, clients load on placement
+	 */
+	TSoftObjectPtr<UMaterialInterface> GetImpactDecal(FName PhysicalMaterialName) const
+	{
+		if (const TSoftObjectPtr<UMaterialInterface>* FoundDecal = ImpactDecalMap.Find(PhysicalMaterialName))
+		{
+			return *FoundDecal;
+		}
+		return nullptr;
+	}
 };
@@ -0,0 +1,136 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Core/AmmoCaliberTypes.h"
+#include "WeaponDefinition.generated.h"
+
+class UAnimInstance;
+class UAnimMontage;
+class UAmmoTypeDataAsset;
+
+/**
+ * Immutable tuning record shared by every instance of a weapon type
+ *
+ * FLYWEIGHT:
+ * - Weapon instances hold one pointer (ABaseWeapon::WeaponDefinition), never a copy
+ * - Fire/Reload/Ballistics components read it through ABaseWeapon::GetDefinitionFor(GetOwner())
+ * - No asset assigned → per-class built-in record (ABaseWeapon::GetBuiltInDefinition, code defaults only)
+ * - Old Blueprint tuning (_DEPRECATED properties) → generated record on the Blueprint CDO (ABaseWeapon::MigrateDeprecatedTuning)
+ *
+ * Only read-only tuning lives here - mutable state (ammo, aiming, bolt state) stays on the instance
+ */
+USTRUCT(BlueprintType)
+struct FPSCORE_API FWeaponDefinition
+{
+	GENERATED_BODY()
+
+	// ============================================
+	// CALIBER
+	// ============================================
+
+	// Accepted caliber type (for magazine compatibility checks)
+	// NATO_556x45mm, Parabellum_9x19mm, Gauge_12, NATO_762x51mm
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Caliber")
+	EAmmoCaliberType AcceptedCaliberType = EAmmoCaliberType::NATO_556x45mm;
+
+	// Caliber type → ammo data asset (ballistics, damage, impact effects)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Caliber")
+	TMap<EAmmoCaliberType, TSoftObjectPtr<UAmmoTypeDataAsset>> CaliberDataMap;
+
+	// ============================================
+	// FIRE
+	// ============================================
+
+	// Fire rate in rounds per minute (RPM)
+	// Assault Rifle: 800, SMG: 900, Pistol: 450, Shotgun: 300, Bolt-Action: 40
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Fire")
+	float FireRate = 600.0f;
+
+	// Spread scale multiplier (0.0 = laser, 1.0 = normal, 2.0 = inaccurate)
+	// Rifle: 1.0, Pistol: 0.8, Shotgun: 1.5, Sniper: 0.3
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Fire")
+	float SpreadScale = 1.0f;
+
+	// Recoil intensity multiplier (0.0 = no recoil, 1.0 = normal, 2.0 = heavy)
+	// Rifle: 1.0, Pistol: 0.7, Shotgun: 2.0, Sniper: 1.5
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Fire")
+	float RecoilScale = 1.0f;
+
+	// ============================================
+	// AIMING
+	// ============================================
+
+	// Field of view when aiming (degrees)
+	// Rifle: 50, Pistol: 60, Shotgun: 55, Sniper: 30, Launcher: 55
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Aiming")
+	float AimFOV = 50.0f;
+
+	// Look sensitivity multiplier when aiming (1.0 = normal, lower = slower)
+	// Rifle: 0.5, Pistol: 0.7, Shotgun: 0.6, Sniper: 0.3
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Aiming")
+	float AimLookSpeed = 0.5f;
+
+	// Leaning scale multiplier when holding this weapon (1.0 = normal scale)
+	// Rifle: 1.0, Pistol: 0.8, Sniper: 0.5
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Aiming")
+	float LeaningScale = 1.0f;
+
+	// Breathing sway intensity (hip-fire idle)
+	// Rifle: 1.0, Pistol: 0.6, Sniper: 1.5, Launcher: 1.2
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Aiming")
+	float BreathingScale = 1.0f;
+
+	// ============================================
+	// ATTACHMENT SOCKETS
+	// ============================================
+
+	// Socket name on CHARACTER where weapon mesh attaches when equipped
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Sockets")
+	FName CharacterAttachSocket = FName("weapon_r");
+
+	// Socket name on CHARACTER where weapon mesh attaches during reload
+	// Used by bolt-action rifles, shotguns that require hand repositioning
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Sockets")
+	FName ReloadAttachSocket = FName("weapon_r");
+
+	// ============================================
+	// ANIMATION
+	// ============================================
+
+	// Animation layer class for weapon-specific animations
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Animation")
+	TSubclassOf<UAnimInstance> AnimLayer;
+
+	// Shooting animation montage (uses slot "DefaultGroup.Shoot")
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Animation")
+	TObjectPtr<UAnimMontage> ShootMontage = nullptr;
+
+	// Equip animation montage (draw weapon, unfold launcher, etc.)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Animation")
+	TObjectPtr<UAnimMontage> EquipMontage = nullptr;
+
+	// Unequip animation montage (holster weapon, fold launcher, etc.)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Animation")
+	TObjectPtr<UAnimMontage> UnequipMontage = nullptr;
+
+	// Character reload montage (Body/Arms/Legs), played by UReloadComponent
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Animation")
+	TObjectPtr<UAnimMontage> ReloadMontage = nullptr;
+};
+
+/**
+ * Data asset wrapping one FWeaponDefinition
+ * One asset per weapon type, referenced (not copied) by every instance
+ */
+UCLASS(BlueprintType)
+class FPSCORE_API UWeaponDefinitionAsset : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon", meta = (ShowOnlyInnerProperties))
+	FWeaponDefinition Definition;
+};
@@ -10,9 +10,11 @@
 #include "Interfaces/RecoilHandlerInterface.h"
 #include "Interfaces/CharacterMeshProviderInterface.h"
 #include "Interfaces/DamageableInterface.h"
+#include "Animation/FPSArmsAnimInstance.h"
 #include "FPSCharacter.generated.h"
 
 class UInputAction;
+enum class EFPSProxyDetail : uint8;
 
 UENUM(BlueprintType)
 enum class EFPSMovementMode : uint8
@@ -23,13 +25,47 @@ enum class EFPSMovementMode : uint8
 	Crouch
 };
 
+UENUM()
+enum class EFPSWeaponSwitchPhase : uint8
+{
+	// ActiveItem in hands (equip montage started at StartTime), or empty hands
+	Equipped,
+	// ActiveItem being holstered (unequip montage started at StartTime), PendingItem equipped next
+	Unequipping
+};
+
+/**
+ * Replicated weapon selection state
+ * Every machine derives holster/equip + montage position from this alone (late joiners included)
+ */
+USTRUCT()
+struct FFPSWeaponSwitchState
+{
+	GENERATED_BODY()
+
+	// Item in hands (Equipped) or being holstered (Unequipping)
+	UPROPERTY()
+	AActor* ActiveItem = nullptr;
+
+	// Item equipped once unequip finishes (Unequipping only)
+	UPROPERTY()
+	AActor* PendingItem = nullptr;
+
+	UPROPERTY()
+	EFPSWeaponSwitchPhase Phase = EFPSWeaponSwitchPhase::Equipped;
+
+	// Server world time the phase started (montage position = now - StartTime)
+	UPROPERTY()
+	float StartTime = 0.0f;
+};
+
 UCLASS()
 class FPSCORE_API AFPSCharacter : public ACharacter, public IViewPointProviderInterface, public IItemCollectorInterface, public IRecoilHandlerInterface, public ICharacterMeshProviderInterface, public IDamageableInterface
 {
 	GENERATED_BODY()
 
 public:
-	AFPSCharacter();
+	AFPSCharacter(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 	// IViewPointProviderInterface implementation
 	virtual void GetShootingViewPoint_Implementation(FVector& OutLocation, FRotator& OutRotation) const override;
@@ -62,13 +98,28 @@ public:
 	virtual bool IsDead_Implementation() override;
 	virtual void ResetAfterDeath_Implementation() override;
 
+	/**
+	 * Apply state resolved inside a predicted move (called by UFPSCharacterMovementComponent)
+	 * Runs on owning client (prediction + replay) and server (authoritative replay of the same move)
+	 * @param NewMode - Movement mode resolved from sprint/walk/crouch intent
+	 * @param bNewAiming - Aim intent (applied on server for remote players, owner sets bIsAiming locally)
+	 */
+	void ApplyPredictedMovementState(EFPSMovementMode NewMode, bool bNewAiming);
+
+	/**
+	 * Scale cost of this character as a remote proxy (called by UFPSCharacterSignificanceSubsystem)
+	 * Anim update rate of Body and actor tick interval - cosmetic only
+	 * Full restores the settings captured at BeginPlay
+	 */
+	void ApplyProxyDetail(EFPSProxyDetail Detail);
+
 protected:
 	virtual void PostInitializeComponents() override;
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
-	// Initialize spine components from mesh bind pose
+	// Initialize analytic spine/camera chain from mesh bind pose
 	void InitializeSpineComponents();
 
 	// Enhanced Input callbacks
@@ -128,27 +179,22 @@ protected:
 	// Left/Right/Back/Back-Left/Back-Right: reduced sprint speed
 	float GetSprintDirectionMultiplier(const FVector2D& MovementInput) const;
 
-	// Server RPC to change movement mode
-	UFUNCTION(Server, Reliable)
-	void Server_SetMovementMode(EFPSMovementMode NewMode);
-
 	// Server RPC to update pitch
 	UFUNCTION(Server, Unreliable)
 	void Server_UpdatePitch(float NewPitch);
 
-	// Server RPC to set aiming state
-	// Called from AimingPressed/AimingReleased to replicate bIsAiming to all clients
-	UFUNCTION(Server, Reliable)
-	void Server_SetAiming(bool bNewAiming);
-
 	// Client RPC to setup camera, input, and hands on owning client
 	// This ensures proper setup for listen server remote clients
 	UFUNCTION(Client, Reliable)
 	void Client_OnPossessed();
 
-	// Helper function to update spine rotations based on current Pitch
-	// Called from UpdatePitch, Server_UpdatePitch, and OnRep_Pitch
-	void UpdateSpineRotations();
+	// Camera-to-mesh transform for given spine pitch (analytic spine_03 → neck_01 → camera chain)
+	// Pure function - used by local camera update and by GetShootingViewPoint on every role
+	FTransform CalculateCameraRelativeTransform(float SpinePitch) const;
+
+	// Apply CalculateCameraRelativeTransform(LocalPitchAccumulator) to Camera (LOCAL ONLY)
+	// Called from UpdatePitch and crouch changes - one relative transform update per event
+	void UpdateCameraTransform();
 
 	// Calculate network pitch from actual camera direction (inverse calculation)
 	// This ensures ViewPointProvider returns the same direction as local camera
@@ -165,6 +211,7 @@ public:
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 	virtual void PossessedBy(AController* NewController) override;
 	virtual void UnPossessed() override;
+	virtual void NotifyControllerChanged() override;
 
 	/**
 	 * Check if character can perform reload action
@@ -193,6 +240,13 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Health")
 	class UHealthComponent* HealthComp;
 
+	/**
+	 * Hitbox component (analytic bone capsules for bullet queries)
+	 * Built from Body physics asset, queried via UFPSHitboxSubsystem
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Health")
+	class UHitboxComponent* HitboxComp;
+
 	// ============================================
 	// RECOIL COMPONENT (WEAPON RECOIL SYSTEM)
 	// ============================================
@@ -298,6 +352,7 @@ public:
 	/**
 	 * Enable ragdoll physics on character
 	 * Disables movement, collision capsule, and enables physics on body mesh
+	 * Simulation is budgeted by UFPSRagdollSubsystem (capped, frozen when settled, skipped on dedicated server)
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Death")
 	void EnableRagdoll();
@@ -328,7 +383,7 @@ public:
 	void OnRep_Pitch();
 
 	UFUNCTION()
-	void OnRep_ActiveItem(AActor* OldActiveItem);
+	void OnRep_WeaponSwitchState();
 
 	UFUNCTION()
 	void OnRep_CurrentMovementMode();
@@ -368,7 +423,7 @@ public:
 
 	// Sprint intent flag (local only, not replicated)
 	// When true, character WANTS to sprint (sprint key is held)
-	// Actual Sprint mode is activated only when moving forward (checked in Tick)
+	// Movement bWantsToSprint is raised only when moving forward (checked in Tick)
 	bool bSprintIntentActive = false;
 
 	UPROPERTY(BlueprintReadWrite, Category = "Look")
@@ -415,40 +470,49 @@ public:
 
 	// Current leaning vector (3D offset in cm): X = forward/backward, Y = lateral (left/right), Z = vertical (up/down)
 	// Applied as postprocess on top of base arms position (does not affect aiming interpolation)
+	// Mirrored from last procedural arms evaluation (see UpdateProceduralArms)
 	UPROPERTY(BlueprintReadOnly, Category = "Leaning")
 	FVector LeanVector = FVector::ZeroVector;
 
+	// Current breathing vector (3D offset in cm, idle breathing sway)
+	// Mirrored from last procedural arms evaluation (see UpdateProceduralArms)
+	UPROPERTY(BlueprintReadOnly, Category = "Leaning")
+	FVector BreathingVector = FVector::ZeroVector;
+
 	// Current breathing rotation (camera sway when aiming)
-	// Applied to camera rotation during ADS to simulate breathing-induced aim wobble
+	// Applied to camera during ADS to simulate breathing-induced aim wobble
 	UPROPERTY(BlueprintReadOnly, Category = "Leaning")
 	FRotator BreathingRotation = FRotator::ZeroRotator;
 
-	// Calculate leaning vector based on movement (velocity-based lean + perpendicular bob + vertical bob)
-	// Self-contained function with hardcoded parameters and internal static state tracking
-	// Returns 3D offset: X = forward offset (cm), Y = lateral offset (cm), Z = vertical offset (cm)
-	UFUNCTION(BlueprintCallable, Category = "Leaning")
+	// Feed procedural arms/camera sway (LOCAL ONLY - called from Tick)
+	// Preferred path: snapshot inputs to UFPSArmsAnimInstance, evaluated on animation worker thread,
+	// applied as root bone offset + camera additive offset (no component transform updates)
+	// Fallback (Arms AnimBP not derived from UFPSArmsAnimInstance): evaluate here, move components
+	void UpdateProceduralArms(float DeltaTime);
+
+	// Arms anim instance if Arms AnimBP derives from UFPSArmsAnimInstance, nullptr otherwise
+	UFPSArmsAnimInstance* GetArmsAnimInstance() const;
+
+	// Last evaluated procedural arms state (anim instance or game-thread fallback)
+	const FFPSProceduralArmsState& GetProceduralArmsState() const;
+
+	// Deprecated Blueprint entry points (state now advances once per Tick in UpdateProceduralArms)
+	// Return last evaluated outputs - DeltaTime ignored, calling them no longer advances lean/breathing
+	UFUNCTION(BlueprintCallable, Category = "Leaning", meta = (DeprecatedFunction, DeprecationMessage = "Read LeanVector (evaluated in UpdateProceduralArms)"))
 	FVector CalculateLeanVector(float DeltaTime);
 
-	// Calculate breathing sway offset (idle breathing effect)
-	// Self-contained function with hardcoded parameters and internal static state tracking
-	// Uses CurrentBreathingScale from ActiveItem (hip) or AimBreathingScale (ADS)
-	// Returns 3D offset: X = forward offset (cm), Y = lateral offset (cm), Z = vertical offset (cm)
-	UFUNCTION(BlueprintCallable, Category = "Leaning")
+	UFUNCTION(BlueprintCallable, Category = "Leaning", meta = (DeprecatedFunction, DeprecationMessage = "Read BreathingVector (evaluated in UpdateProceduralArms)"))
 	FVector CalculateBreathing(float DeltaTime);
 
-	// Calculate breathing rotation for camera sway (ADS aim wobble)
-	// Converts breathing offset vector to Pitch/Yaw rotation
-	// Input: BreathingVector from CalculateBreathing()
-	// Returns: FRotator with Pitch (vertical) and Yaw (horizontal) rotation in degrees
-	UFUNCTION(BlueprintCallable, Category = "Leaning")
-	FRotator CalculateBreathingRotation(const FVector& BreathingVector) const;
+	UFUNCTION(BlueprintCallable, Category = "Leaning", meta = (DeprecatedFunction, DeprecationMessage = "Read BreathingRotation (evaluated in UpdateProceduralArms)"))
+	FRotator CalculateBreathingRotation(const FVector& InBreathingVector) const;
 
 	// Update leaning visual feedback systems (Material Parameter Collection + Crosshair)
 	// Combines LeanVector and BreathingVector to update shader effects and crosshair expansion
 	// LOCAL ONLY - called from Tick() for locally controlled players
-	// @param BreathingVector - Output from CalculateBreathing() for current frame
+	// @param InBreathingVector - Breathing offset for current frame
 	UFUNCTION(BlueprintCallable, Category = "Leaning")
-	void UpdateLeaningVisualFeedback(const FVector& BreathingVector);
+	void UpdateLeaningVisualFeedback(const FVector& InBreathingVector);
 
 private:
 	// ============================================
@@ -464,24 +528,19 @@ private:
 	// LEANING & BREATHING STATE TRACKING (LOCAL ONLY)
 	// ============================================
 
-	// Leaning state (replaces static TMap)
-	FVector LeanState_CurrentLean = FVector::ZeroVector;
-	float LeanState_WalkCycleTime = 0.0f;
-	FRotator LeanState_PreviousControlRotation = FRotator::ZeroRotator;
-	FVector2D LeanState_MouseLagOffset = FVector2D::ZeroVector;
-	float LeanState_RawMouseDelta = 0.0f; // RAW mouse angular velocity for crosshair alpha
+	// Game-thread fallback state (used only when Arms AnimBP is not a UFPSArmsAnimInstance)
+	FFPSProceduralArmsState ProceduralArmsState;
 
-	// Breathing state (replaces static TMap)
-	FVector BreathingState_CurrentBreathing = FVector::ZeroVector;
-	float BreathingState_IdleSwayTime = 0.0f;
-	float BreathingState_IdleActivation = 0.0f;
+	// Reset request forwarded with next procedural input snapshot (respawn)
+	bool bPendingProceduralArmsReset = false;
 
 public:
 	// ============================================
 	// INVENTORY SYSTEM
 	// ============================================
 	// ARCHITECTURE NOTE:
-	// - ActiveItem is the SINGLE SOURCE OF TRUTH for currently equipped item (REPLICATED)
+	// - WeaponSwitchState is the SINGLE SOURCE OF TRUTH for weapon selection (REPLICATED)
+	// - ActiveItem is each machine's item in hands, derived from WeaponSwitchState
 	// - InventoryComp->Items is storage-only array (no active item tracking)
 	// - External code should use IItemCollectorInterface::Execute_GetActiveItem() for access
 
@@ -489,11 +548,16 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Inventory")
 	class UInventoryComponent* InventoryComp;
 
-	// Currently equipped item (active in hands) - SINGLE SOURCE OF TRUTH
+	// Currently equipped item (active in hands) - LOCAL, applied from WeaponSwitchState
 	// External access: IItemCollectorInterface::Execute_GetActiveItem()
-	UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_ActiveItem, Category = "Inventory")
+	UPROPERTY(BlueprintReadOnly, Category = "Inventory")
 	AActor* ActiveItem = nullptr;
 
+	// Weapon selection state machine (active item, pending item, phase, start time)
+	// Written by server only (SetWeaponSwitchState), applied on every machine
+	UPROPERTY(ReplicatedUsing = OnRep_WeaponSwitchState)
+	FFPSWeaponSwitchState WeaponSwitchState;
+
 	// Server RPC to pickup item from world
 	UFUNCTION(Server, Reliable)
 	void Server_PickupItem(AActor* Item);
@@ -503,12 +567,6 @@ public:
 	UFUNCTION(NetMulticast, Reliable)
 	void Multicast_PickupItem(AActor* Item);
 
-	// Multicast RPC for first item equip (when ActiveItem was nullptr)
-	// Pre-links anim layer BEFORE equip montage to prevent visual glitch
-	// Called from OnInventoryItemAdded when picking up first item
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_FirstItemEquip(AActor* Item);
-
 	// Physical pickup implementation (called by Multicast)
 	void PerformPickup(AActor* Item);
 
@@ -517,16 +575,10 @@ public:
 	void Server_DropItem(AActor* Item);
 
 	// Server RPC to select item from inventory by index
-	// Validates index, checks if item can be equipped, updates ActiveItem
+	// Validates index, checks if item can be equipped, updates WeaponSwitchState
 	UFUNCTION(Server, Reliable)
 	void Server_SelectItem(int32 Index);
 
-	// Multicast RPC for weapon switch visual transition
-	// ATOMIC: All clients receive OldItem + NewItem in single packet
-	// Triggers: pre-link anim layer, play unequip montage
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_WeaponSwitch(AActor* OldItem, AActor* NewItem);
-
 	// Multicast RPC for physical drop setup (runs on ALL clients)
 	// Detaches from character, enables physics, places in world
 	UFUNCTION(NetMulticast, Reliable)
@@ -547,10 +599,11 @@ public:
 	/**
 	 * Equip item from inventory
 	 * Starts equip montage if available, attaches item to weapon_r
-	 * LOCAL operation - runs on all machines (server calls immediately, clients via OnRep)
+	 * LOCAL operation - runs on all machines (applied from WeaponSwitchState)
 	 * @param Item - Item to equip
+	 * @param MontagePosition - Time into equip montage (late join / catch-up), past its end = no montage
 	 */
-	void EquipItem(AActor* Item);
+	void EquipItem(AActor* Item, float MontagePosition = 0.0f);
 
 	/**
 	 * Unequip item (start unequip sequence)
@@ -575,36 +628,64 @@ public:
 	 * Play equip/unequip montage on character meshes (Body/Arms/Legs)
 	 * @param Montage - Montage to play
 	 * @param bBindEndDelegate - If true, binds OnMontageEnded delegate for fallback
+	 * @param StartPosition - Time into montage to start from (derived from WeaponSwitchState.StartTime)
 	 */
-	void PlayEquipMontage(UAnimMontage* Montage, bool bBindEndDelegate = false);
+	void PlayEquipMontage(UAnimMontage* Montage, bool bBindEndDelegate = false, float StartPosition = 0.0f);
 
 private:
 	// ============================================
-	// WEAPON SWITCH STATE (LOCAL)
+	// WEAPON SWITCH STATE MACHINE
 	// ============================================
-	// HYBRID ARCHITECTURE:
-	// - ActiveItem = REPLICATED (gameplay state, single source of truth)
-	// - PendingEquipItem/UnequippingItem = LOCAL (visual transition state)
+	// ARCHITECTURE:
+	// - WeaponSwitchState = REPLICATED (ActiveItem, PendingItem, Phase, StartTime)
+	// - ActiveItem/PendingEquipItem/UnequippingItem = LOCAL (what this machine has applied)
 	//
 	// FLOW:
-	// 1. Server calls Multicast_WeaponSwitch(OldItem, NewItem)
-	//    ALL MACHINES: Set local state, pre-link anim layer, play unequip montage
-	// 2. Server montage ends → ActiveItem = NewItem (triggers OnRep on clients)
-	// 3. OnRep_ActiveItem: EquipItem (layer already pre-linked)
+	// 1. Server_SelectItem → Unequipping(Old, New) if Old has unequip montage, else Equipped(New)
+	// 2. Unequip montage finishes on server → Equipped(New)
+	//    (montage interrupted / never played: UnequipTimeoutHandle forces it after montage length + grace)
+	// 3. Every machine (server immediately, clients in OnRep) runs ApplyWeaponSwitchState:
+	//    diff local state vs replicated state, play montages from (ServerTime - StartTime)
 	//
 	// BENEFITS:
-	// - 1 Multicast + 1 OnRep (vs 6 OnRep calls)
-	// - ATOMIC data delivery (no race conditions)
-	// - Minimal bandwidth
+	// - One property, no reliable multicasts
+	// - Late joiners / missed intermediate states converge to the same hands + montage position
 
 	// Item waiting to be equipped after current unequip completes
-	// LOCAL: Set by Multicast_WeaponSwitch, cleared after equip
+	// LOCAL: Set when applying Unequipping phase, cleared after equip
 	AActor* PendingEquipItem = nullptr;
 
 	// Item currently being unequipped
-	// LOCAL: Set by Multicast_WeaponSwitch, cleared after holster
+	// LOCAL: Set when applying Unequipping phase, cleared after holster
 	AActor* UnequippingItem = nullptr;
 
+	/**
+	 * Enter new weapon switch phase (SERVER ONLY)
+	 * Stamps StartTime and applies locally (replicates to clients)
+	 */
+	void SetWeaponSwitchState(AActor* NewActiveItem, AActor* NewPendingItem, EFPSWeaponSwitchPhase NewPhase);
+
+	/** Bring local hands/montages in line with WeaponSwitchState (LOCAL operation - runs on ALL machines) */
+	void ApplyWeaponSwitchState();
+
+	/**
+	 * Holster UnequippingItem and run its completion side effects (OnUnequipMontageComplete, anim layer)
+	 * LOCAL operation - unequip notify / montage end, or client catch-up when the server already moved on
+	 */
+	void FinishUnequip();
+
+	// Server fallback for an Unequipping phase whose montage never reports completion
+	FTimerHandle UnequipTimeoutHandle;
+
+	// Time past unequip montage length before the fallback fires (seconds)
+	static constexpr float UnequipTimeoutGrace = 0.5f;
+
+	/** Unequip montage overdue - complete switch to PendingItem (SERVER ONLY) */
+	void OnUnequipTimeout();
+
+	/** Seconds since WeaponSwitchState.StartTime (server-synchronized clock) */
+	float GetWeaponSwitchElapsed() const;
+
 	// Setup active item local visual state (LOCAL operation - runs on ALL machines)
 	void SetupActiveItemLocal();
 
@@ -692,25 +773,21 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "UI")
 	TSubclassOf<UUserWidget> DefaultCrossHair;
 
-	// Character Movement Component (cached reference)
+	// Character Movement Component (cached reference, carries sprint/walk/aim in saved moves)
 	UPROPERTY()
-	class UCharacterMovementComponent* CMC;
-
-	// Scene components for skeleton hierarchy
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
-	class USceneComponent* Spine_03;
+	class UFPSCharacterMovementComponent* CMC;
 
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
-	class USceneComponent* Spine_04;
-
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
-	class USceneComponent* Spine_05;
+	// Analytic spine chain (bind pose, cached in InitializeSpineComponents)
+	// Original spine_03 location in mesh space
+	FVector OriginalSpineLocation = FVector::ZeroVector;
 
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
-	class USceneComponent* Neck_01;
+	// Parent-relative offsets: spine_03 → spine_04 → spine_05 → neck_01
+	FVector SpineChainSpine04Offset = FVector::ZeroVector;
+	FVector SpineChainSpine05Offset = FVector::ZeroVector;
+	FVector SpineChainNeck01Offset = FVector::ZeroVector;
 
-	// Original Spine_03 location (for crouch offset)
-	FVector OriginalSpineLocation = FVector::ZeroVector;
+	// Crouch camera offset applied at spine_03 (LOCAL ONLY)
+	FVector SpineCrouchOffset = FVector::ZeroVector;
 
 	// Camera component
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera")
@@ -720,7 +797,7 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Camera")
 	float DefaultFOV = 90.0f;
 
-	// Base camera location (relative to Neck_01, set in constructor)
+	// Base camera location (relative to neck_01 in analytic spine chain)
 	// Used as reference for applying LeanVector during ADS
 	UPROPERTY(BlueprintReadOnly, Category = "Camera")
 	FVector BaseCameraLocation = FVector(15.0f, 0.0f, 0.0f);
@@ -746,6 +823,11 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Mesh")
 	USkeletalMeshComponent* Legs;
 
+	// Non-local characters: Legs follow Body pose (leader pose), Arms skip pose evaluation
+	// Disable to compare per-character anim cost (stat FPSCore → Evaluated Character Meshes, stat anim)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Mesh")
+	bool bShareRemotePose = true;
+
 	// Enhanced Input Actions
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Input")
 	UInputAction* IA_Look_Yaw;
@@ -809,7 +891,7 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Movement")
 	float CrouchSpeed = 150.0f;
 
-	// Current movement mode (replicated for animations)
+	// Current movement mode (resolved in predicted moves, replicated to simulated proxies for animations)
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_CurrentMovementMode, Category = "Movement")
 	EFPSMovementMode CurrentMovementMode = EFPSMovementMode::Jog;
 
@@ -853,6 +935,18 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Interaction")
 	float InteractionDistance = 200.0f;
 
+	// Anim tick options captured at BeginPlay
+	// Body restored by ApplyProxyDetail(Full), Arms / Legs by UpdateOwnerOnlyMeshes when locally controlled
+	EVisibilityBasedAnimTickOption DefaultBodyAnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+	EVisibilityBasedAnimTickOption DefaultArmsAnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPose;
+	EVisibilityBasedAnimTickOption DefaultLegsAnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+
+	// True while Legs follow Body pose and Arms skip evaluation (non-local character)
+	bool bOwnerOnlyMeshesFollowBody = false;
+
+	// Switch Arms / Legs between full evaluation (local) and shared Body pose (remote)
+	void UpdateOwnerOnlyMeshes();
+
 	// Last actor we looked at (for clearing HUD when looking away)
 	UPROPERTY()
 	AActor* LastInteractableActor = nullptr;
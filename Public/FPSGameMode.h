@@ -31,8 +31,72 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Respawn")
 	void RespawnPlayer(AController* PlayerController);
 
+	/**
+	 * Find respawn location from precomputed spawn index (no traces at runtime)
+	 * Scores candidates by distance to living players and recent spawns
+	 * Falls back to FindRespawnLocationByTrace() if index is empty
+	 *
+	 * @param OutLocation - Chosen spawn location (ground + SpawnGroundOffset)
+	 * @param RespawningController - Controller being respawned (its pawn is ignored for scoring)
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Respawn")
-	bool FindRespawnLocation(FVector& OutLocation);
+	bool FindRespawnLocation(FVector& OutLocation, AController* RespawningController = nullptr);
+
+	/**
+	 * Legacy random-point search with downward line traces (up to MaxSpawnAttempts)
+	 * Only used when spawn index has no candidates
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Respawn")
+	bool FindRespawnLocationByTrace(FVector& OutLocation);
+
+	/**
+	 * Bake spawn candidates into cell index (SERVER ONLY)
+	 * Grid over SpawnArea at SpawnCandidateSpacing, one downward trace per grid point + PlayerStarts
+	 * Called once from BeginPlay - call again after streaming in new spawn geometry
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Respawn")
+	void BuildSpawnIndex();
+
+	/**
+	 * Benchmark mass-respawn queries against current player positions
+	 * Console: BenchmarkSpawnQueries 1000
+	 */
+	UFUNCTION(Exec)
+	void BenchmarkSpawnQueries(int32 NumQueries = 1000);
+
+	/**
+	 * Replay combat recording (-FPSCombatRecord output) and report ballistics cost per shot
+	 * Run standalone without networking/rendering:
+	 *   <Project> <Map> -game -nullrhi -ExecCmds="ReplayCombat <File.fpscombat> [ExpectedDigest]"
+	 * Outcome digest must match between runs before/after a ballistics optimization
+	 */
+	UFUNCTION(Exec)
+	void ReplayCombat(const FString& FilePath, const FString& ExpectedDigest = TEXT(""));
+
+	/**
+	 * Benchmark character hit queries: analytic hitboxes vs physics-asset traces
+	 * Pads the world with copies of the first character up to NumPlayers
+	 * Console: BenchmarkHitboxes 64 10000
+	 */
+	UFUNCTION(Exec)
+	void BenchmarkHitboxes(int32 NumPlayers = 64, int32 NumRays = 10000);
+
+	// ============================================
+	// LOAD TEST REPORT
+	// ============================================
+
+	/**
+	 * Log server load every Interval seconds (SERVER ONLY)
+	 * "LoadReport,<Players>,<AvgTickIntervalMs>,<AvgGameThreadMs>,<MaxGameThreadMs>,<InBytesPerSec>,<OutBytesPerSec>"
+	 * - Game thread ms = work time per frame (GGameThreadTime), not capped by NetServerMaxTickRate / time dilation
+	 * - Tick interval ms = DeltaSeconds (tick rate only - hides cost until the server is over budget)
+	 * Enabled at startup with -FPSLoadReport=<Seconds>, pair with -FPSBot clients
+	 * Console: StartLoadReport 5 / StartLoadReport 0 (stop)
+	 */
+	UFUNCTION(Exec)
+	void StartLoadReport(float Interval = 5.0f);
+
+	virtual void Tick(float DeltaSeconds) override;
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Respawn")
 	float RespawnDelay = 5.0f;
@@ -52,6 +116,26 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Respawn")
 	int32 MaxSpawnAttempts = 10;
 
+	// ============================================
+	// SPAWN INDEX
+	// ============================================
+
+	// Grid spacing for baked spawn candidates (cm)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Respawn|Index")
+	float SpawnCandidateSpacing = 500.0f;
+
+	// Cell size for spawn index (cm) - query cost scales with cell count, not candidate count
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Respawn|Index")
+	float SpawnCellSize = 2500.0f;
+
+	// Randomize among N best-scoring cells (1 = always safest cell, predictable)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Respawn|Index")
+	int32 SpawnCellChoices = 3;
+
+	// Recently used spawn points count as occupied for this long (mass-respawn spreading)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Respawn|Index")
+	float SpawnReservationTime = 3.0f;
+
 protected:
 	UPROPERTY(BlueprintReadOnly, Category = "Game")
 	TArray<APlayerController*> PlayerControllers;
@@ -61,4 +145,45 @@ protected:
 
 private:
 	TMap<AController*, FTimerHandle> PendingRespawnTimers;
+
+	// ============================================
+	// SPAWN INDEX STATE (SERVER ONLY)
+	// ============================================
+
+	// Spawn cell: contiguous range in SpawnCandidates (sorted by cell at bake time)
+	struct FSpawnCell
+	{
+		FVector Center = FVector::ZeroVector;
+		int32 FirstCandidate = 0;
+		int32 NumCandidates = 0;
+	};
+
+	// Baked spawn locations (ground + SpawnGroundOffset), grouped by cell
+	TArray<FVector> SpawnCandidates;
+
+	// Non-empty cells of the index
+	TArray<FSpawnCell> SpawnCells;
+
+	// Recently chosen spawn locations (Location, WorldTime)
+	TArray<TPair<FVector, float>> RecentSpawns;
+
+	// Collect positions that make a spawn unsafe (living players + reserved spawns)
+	void GatherOccupiedLocations(AController* RespawningController, TArray<FVector>& OutLocations);
+
+	// Squared 2D distance to closest occupied location (MAX_flt if none)
+	static float GetClosestDistanceSquared(const FVector& Location, const TArray<FVector>& Occupied);
+
+	// Pick best candidate from index (no traces)
+	// O(cells × occupied + candidates per cell) - linear in cell count, bounded by SpawnCellSize
+	bool QuerySpawnIndex(const TArray<FVector>& Occupied, FVector& OutLocation) const;
+
+	// ============================================
+	// LOAD TEST REPORT STATE
+	// ============================================
+
+	float LoadReportInterval = 0.0f;
+	float LoadReportElapsed = 0.0f;
+	double LoadReportGameThreadMs = 0.0;
+	double LoadReportMaxGameThreadMs = 0.0;
+	int32 LoadReportFrames = 0;
 };
@@ -9,6 +9,7 @@
 #include "FPSPlayerController.generated.h"
 
 class UInputMappingContext;
+class UHUDViewModel;
 
 UCLASS()
 class FPSCORE_API AFPSPlayerController : public APlayerController, public IPlayerHUDInterface, public IPlayerDeathHandlerInterface
@@ -35,10 +36,15 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Input")
 	UInputMappingContext* InputMappingContext;
 
+	// HUD state batched per frame (Update* calls land here, flushed after all actor ticks)
+	UPROPERTY(Transient, BlueprintReadOnly, Category = "HUD")
+	TObjectPtr<UHUDViewModel> HUDViewModel;
+
 	// ============================================
 	// PLAYER HUD INTERFACE IMPLEMENTATION
 	// ============================================
-	// Delegates all calls to HUD widget (via GetHUD())
+	// State updates (Update*) → HUDViewModel, one flush per frame on change
+	// Events (AddDamageEffect, SetCrossHair, SetHUDVisibility) → HUD widget immediately (via GetHUD())
 
 	virtual void UpdateHealth_Implementation(float Health) override;
 	virtual float GetHealth_Implementation() override;
@@ -46,6 +52,7 @@ public:
 	virtual void UpdateActiveItem_Implementation(AActor* ActiveItem) override;
 	virtual void UpdateInventory_Implementation(const TArray<AActor*>& Items) override;
 	virtual void UpdateCrossHair_Implementation(bool IsAim, float LeanAlpha) override;
+	virtual void UpdateAimOffset_Implementation(UMaterialParameterCollection* Collection, FVector Offset) override;
 	virtual void SetCrossHair_Implementation(TSubclassOf<UUserWidget> CrossHairWidgetClass, TSubclassOf<UUserWidget> AimCrossHairWidgetClass) override;
 	virtual void SetHUDVisibility_Implementation(bool Visibility) override;
 	virtual void UpdateItemInfo_Implementation(const FString& Info) override;
@@ -7,6 +7,7 @@
 #include "BallisticsHandlerInterface.generated.h"
 
 class UNiagaraSystem;
+class UMaterialInterface;
 
 /**
  * CAPABILITY: BallisticsHandler
@@ -33,14 +34,15 @@ public:
 	 * Handle shot fired event (SERVER ONLY)
 	 * Called by BallisticsComponent when shot is fired
 	 *
-	 * Typical usage: Spawn muzzle flash via Multicast RPC
+	 * Typical usage: Spawn muzzle flash + tracer via Multicast RPC
 	 *
 	 * @param MuzzleLocation - Location where shot originated
 	 * @param Direction - Direction of shot (normalized)
+	 * @param TraceDistance - Distance to first impact (max trace distance if nothing was hit)
 	 */
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Ballistics")
-	void HandleShotFired(FVector_NetQuantize MuzzleLocation, FVector_NetQuantizeNormal Direction);
-	virtual void HandleShotFired_Implementation(FVector_NetQuantize MuzzleLocation, FVector_NetQuantizeNormal Direction) {}
+	void HandleShotFired(FVector_NetQuantize MuzzleLocation, FVector_NetQuantizeNormal Direction, float TraceDistance);
+	virtual void HandleShotFired_Implementation(FVector_NetQuantize MuzzleLocation, FVector_NetQuantizeNormal Direction, float TraceDistance) {}
 
 	/**
 	 * Handle impact detected event (SERVER ONLY)
@@ -49,10 +51,11 @@ public:
 	 * Typical usage: Spawn impact effects via Multicast RPC
 	 *
 	 * @param ImpactVFX - Niagara system to spawn (surface-specific from AmmoTypeDataAsset)
+	 * @param ImpactDecal - Bullet hole decal (null = surface doesn't take decals: skeletal, movable, unmapped)
 	 * @param Location - Impact location
 	 * @param Normal - Impact surface normal
 	 */
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Ballistics")
-	void HandleImpactDetected(const TSoftObjectPtr<UNiagaraSystem>& ImpactVFX, FVector_NetQuantize Location, FVector_NetQuantizeNormal Normal);
-	virtual void HandleImpactDetected_Implementation(const TSoftObjectPtr<UNiagaraSystem>& ImpactVFX, FVector_NetQuantize Location, FVector_NetQuantizeNormal Normal) {}
+	void HandleImpactDetected(const TSoftObjectPtr<UNiagaraSystem>& ImpactVFX, const TSoftObjectPtr<UMaterialInterface>& ImpactDecal, FVector_NetQuantize Location, FVector_NetQuantizeNormal Normal);
+	virtual void HandleImpactDetected_Implementation(const TSoftObjectPtr<UNiagaraSystem>& ImpactVFX, const TSoftObjectPtr<UMaterialInterface>& ImpactDecal, FVector_NetQuantize Location, FVector_NetQuantizeNormal Normal) {}
 };
@@ -71,6 +71,7 @@ public:
 	/**
 	 * Get legs mesh component (first-person, visible only to owner)
 	 * Used for first-person leg animations (walking, crouching, jumping)
+	 * AFPSCharacter returns nullptr on machines that don't control it (Legs follow Body pose there)
 	 *
 	 * @return Legs skeletal mesh component or nullptr if not available
 	 */
@@ -168,6 +168,16 @@ public:
 	UAnimMontage* GetUnequipMontage() const;
 	virtual UAnimMontage* GetUnequipMontage_Implementation() const { return nullptr; }
 
+	/**
+	 * Collect item-specific assets needed once equipped (shoot/reload montages, VFX, data assets)
+	 * Anim layer + equip/unequip montages are gathered by UFPSAssetPreloadSubsystem itself
+	 * Called again after the first batch loads (soft references inside loaded data assets)
+	 * @param OutAssets - Append asset paths here
+	 */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Holdable")
+	void GetPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const;
+	virtual void GetPreloadAssets_Implementation(TArray<FSoftObjectPath>& OutAssets) const { }
+
 	/**
 	 * Check if item is currently in equipping state (montage playing)
 	 * Used to block actions during equip animation
@@ -7,6 +7,8 @@
 #include "Blueprint/UserWidget.h"
 #include "PlayerHUDInterface.generated.h"
 
+class UMaterialParameterCollection;
+
 // This class does not need to be modified.
 UINTERFACE(MinimalAPI, Blueprintable)
 class UPlayerHUDInterface : public UInterface
@@ -18,6 +20,10 @@ class UPlayerHUDInterface : public UInterface
  * PlayerHUD Interface
  * Communication interface between game logic and player's HUD widget
  * Implemented by player HUD widget blueprints
+ *
+ * AFPSPlayerController batches state updates (Update*) in UHUDViewModel and
+ * flushes them to the HUD once per frame, only when values changed
+ * Events (AddDamageEffect, SetCrossHair, SetHUDVisibility) are forwarded immediately
  */
 class FPSCORE_API IPlayerHUDInterface
 {
@@ -68,6 +74,10 @@ public:
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "PlayerHUD|Crosshair")
 	void SetCrossHair(TSubclassOf<UUserWidget> CrossHairWidgetClass, TSubclassOf<UUserWidget> AimCrossHairWidgetClass = nullptr);
 
+	// Update weapon sway shader offset (Collection vector "OffsetDirection", -1..1 per axis)
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "PlayerHUD|Crosshair")
+	void UpdateAimOffset(UMaterialParameterCollection* Collection, FVector Offset);
+
 	// ============================================
 	// UI VISIBILITY
 	// ============================================
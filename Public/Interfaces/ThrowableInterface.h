@@ -15,6 +15,7 @@
  *
  * Used by: AnimNotify_ThrowRelease to trigger throw release
  * via interface call instead of direct Cast<ABaseGrenade>
+ * Used by: UThrowArcPreviewComponent to read the launch it predicts
  */
 UINTERFACE(MinimalAPI, BlueprintType)
 class UThrowableInterface : public UInterface
@@ -55,4 +56,16 @@ public:
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Throwable")
 	bool HasBeenThrown() const;
 	virtual bool HasBeenThrown_Implementation() const { return false; }
+
+	/**
+	 * Where and in which direction a throw released now would launch
+	 * Same values OnThrowRelease sends to the server
+	 *
+	 * @param OutLocation - Projectile spawn location
+	 * @param OutDirection - Normalized throw direction
+	 * @return false if fallbacks were used (no hand socket / no view point)
+	 */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Throwable")
+	bool GetThrowLaunch(FVector& OutLocation, FVector& OutDirection) const;
+	virtual bool GetThrowLaunch_Implementation(FVector& OutLocation, FVector& OutDirection) const { return false; }
 };
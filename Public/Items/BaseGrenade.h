@@ -11,6 +11,9 @@
 #include "Interfaces/ThrowableInterface.h"
 #include "BaseGrenade.generated.h"
 
+class UDroppedItemComponent;
+class UThrowArcPreviewComponent;
+
 /**
  * ABaseGrenade
  *
@@ -33,6 +36,10 @@
  * 3. Server_ExecuteThrow → Spawn projectile, set bHasThrown
  * 4. Server destroys grenade actor after successful throw
  *
+ * THROW PREVIEW:
+ * - ThrowArcPreview shows the predicted arc while a local owner holds the grenade
+ * - Hidden once the throw starts, on unequip and on drop
+ *
  * MULTIPLAYER:
  * - bHasThrown replicated for state sync
  * - Projectile spawn is SERVER ONLY
@@ -75,6 +82,14 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
 	TObjectPtr<USkeletalMeshComponent> TPSMesh;
 
+	/** World drop lifecycle (rest freeze, dormancy, proxy mesh) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	TObjectPtr<UDroppedItemComponent> DroppedItemComponent;
+
+	/** Predicted throw arc (owning client only, needs marker mesh in Blueprint) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	TObjectPtr<UThrowArcPreviewComponent> ThrowArcPreview;
+
 	// ============================================
 	// CONFIGURATION - General
 	// ============================================
@@ -252,6 +267,7 @@ public:
 	virtual void OnThrowRelease_Implementation() override;
 	virtual bool CanThrow_Implementation() const override;
 	virtual bool HasBeenThrown_Implementation() const override { return bHasThrown; }
+	virtual bool GetThrowLaunch_Implementation(FVector& OutLocation, FVector& OutDirection) const override;
 
 	// ============================================
 	// IHoldableInterface Implementation
@@ -12,6 +12,42 @@ class USphereComponent;
 class UStaticMeshComponent;
 class UNiagaraSystem;
 
+/**
+ * Replicated launch state of one flight segment
+ * Clients simulate flight locally from this alone - server re-sends only on bounce / rest
+ */
+USTRUCT()
+struct FGrenadeLaunchState
+{
+	GENERATED_BODY()
+
+	// Segment start location
+	UPROPERTY()
+	FVector_NetQuantize10 Origin = FVector::ZeroVector;
+
+	// Velocity at segment start (zero = at rest)
+	UPROPERTY()
+	FVector_NetQuantize10 Velocity = FVector::ZeroVector;
+
+	// Server world time the segment started
+	UPROPERTY()
+	float ServerTime = 0.0f;
+
+	// Movement tuning the server simulates with
+	UPROPERTY()
+	float Bounciness = 0.3f;
+
+	UPROPERTY()
+	float Friction = 0.5f;
+
+	UPROPERTY()
+	float GravityScale = 1.0f;
+
+	// Segment counter (0 = not launched yet)
+	UPROPERTY()
+	uint8 Segment = 0;
+};
+
 /**
  * AGrenadeProjectile
  *
@@ -33,8 +69,11 @@ class UNiagaraSystem;
  * 6. DestroyDelay timer → Destroy() (SERVER)
  *
  * MULTIPLAYER:
- * - Actor replicates to all clients (bReplicates = true)
- * - Physics replicated via UProjectileMovementComponent
+ * - Actor replicates to all clients (bReplicates = true), movement is NOT replicated
+ * - LaunchState replicated once per flight segment (launch, significant bounce, rest)
+ * - Clients simulate flight locally (same fixed-step integrator), snap only when
+ *   a new segment shows divergence beyond CorrectionTolerance
+ * - Explosion multicast carries detonation location (final correction)
  * - bHasExploded replicated for late-joiner state sync
  * - Damage is SERVER ONLY
  * - VFX is MULTICAST
@@ -131,6 +170,18 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Grenade|Physics")
 	float GravityScale = 1.0f;
 
+	// ============================================
+	// CONFIGURATION - Network
+	// ============================================
+
+	/** Client snaps to server segment only beyond this error (cm) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Grenade|Network")
+	float CorrectionTolerance = 25.0f;
+
+	/** Bounces leaving slower than this are not re-sent (rolling) - rest state corrects them (cm/s) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Grenade|Network")
+	float MinBounceCorrectionSpeed = 150.0f;
+
 	// ============================================
 	// REPLICATED STATE
 	// ============================================
@@ -143,6 +194,14 @@ protected:
 	UFUNCTION()
 	void OnRep_HasExploded();
 
+	/** Current flight segment - clients simulate from it */
+	UPROPERTY(ReplicatedUsing = OnRep_LaunchState)
+	FGrenadeLaunchState LaunchState;
+
+	/** OnRep callback for LaunchState */
+	UFUNCTION()
+	void OnRep_LaunchState();
+
 	// ============================================
 	// LOCAL STATE
 	// ============================================
@@ -157,6 +216,33 @@ protected:
 	/** Destroy timer handle */
 	FTimerHandle DestroyTimerHandle;
 
+	// ============================================
+	// FLIGHT REPLICATION
+	// ============================================
+
+	/**
+	 * Start a new flight segment and push it to clients
+	 * SERVER ONLY
+	 */
+	void SetLaunchState(const FVector& Origin, const FVector& Velocity);
+
+	/** Server: significant bounce starts a new segment */
+	UFUNCTION()
+	void OnProjectileBounce(const FHitResult& ImpactResult, const FVector& ImpactVelocity);
+
+	/** Server: came to rest - final segment */
+	UFUNCTION()
+	void OnProjectileStop(const FHitResult& ImpactResult);
+
+	/**
+	 * Rebase local simulation on LaunchState if it diverged
+	 * CLIENT ONLY
+	 */
+	void ApplyLaunchState();
+
+	/** Ballistic location Elapsed seconds into the current segment (no collision) */
+	FVector PredictSegmentLocation(float Elapsed) const;
+
 	// ============================================
 	// EXPLOSION METHODS (Server Only)
 	// ============================================
@@ -193,10 +279,10 @@ protected:
 
 	/**
 	 * Play explosion effects on all clients
-	 * Spawns VFX and plays sound
+	 * Snaps to detonation location, spawns VFX and plays sound
 	 */
 	UFUNCTION(NetMulticast, Unreliable)
-	void Multicast_PlayExplosionEffects();
+	void Multicast_PlayExplosionEffects(FVector_NetQuantize ExplosionLocation);
 
 public:
 	// ============================================
@@ -222,4 +308,13 @@ public:
 	 */
 	UFUNCTION(BlueprintPure, Category = "Grenade")
 	float GetFuseTimeRemaining() const;
+
+	/**
+	 * Launch state this projectile would fly with from Origin along Direction
+	 * Uses InitialSpeed and physics tuning - valid on the CDO (throw preview)
+	 */
+	FGrenadeLaunchState MakeLaunchState(const FVector& Origin, const FVector& Direction) const;
+
+	/** Configured fuse time (seconds) */
+	float GetFuseTime() const { return FuseTime; }
 };
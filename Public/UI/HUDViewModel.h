@@ -0,0 +1,136 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "HUDViewModel.generated.h"
+
+class APlayerController;
+class UMaterialParameterCollection;
+
+/**
+ * HUD View-Model
+ * Collects HUD state pushed by gameplay and flushes it to the HUD once per frame
+ *
+ * SINGLE RESPONSIBILITY: HUD state batching ONLY
+ *
+ * DOES:
+ * - Cache last pushed value per HUD field (health, active item, inventory, crosshair, item info, aim offset)
+ * - Mark fields dirty only on real change (float fields use change thresholds)
+ * - Flush dirty fields once per frame after all actor ticks (IPlayerHUDInterface on AHUD, MPC_Aim)
+ *
+ * DOES NOT:
+ * - Compute HUD values (→ AFPSCharacter: crosshair alpha, aim offset, interaction text)
+ * - Draw or own widgets (→ HUD Blueprint)
+ * - Forward one-shot events (AddDamageEffect, SetCrossHair, SetHUDVisibility → AFPSPlayerController, immediate)
+ *
+ * ARCHITECTURE:
+ * - Owned by AFPSPlayerController (IPlayerHUDInterface setters write here)
+ * - Flush bound to FWorldDelegates::OnWorldPostActorTick while a local controller owns it
+ * - Idle frames: no dirty fields → no widget or MPC writes
+ *
+ * MULTIPLAYER:
+ * - Local only, never replicated
+ */
+UCLASS(BlueprintType)
+class FPSCORE_API UHUDViewModel : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================
+	// CHANGE THRESHOLDS
+	// ============================================
+
+	// Min crosshair LeanAlpha change pushed to HUD (0 / 1 always pushed)
+	float CrossHairAlphaThreshold = 0.01f;
+
+	// Min per-axis aim offset change written to MPC (zero always written)
+	float AimOffsetThreshold = 0.002f;
+
+	// ============================================
+	// SETTERS (cheap - called every frame by gameplay)
+	// ============================================
+
+	void SetHealth(float InHealth);
+	void SetActiveItem(AActor* InActiveItem);
+	void SetInventory(const TArray<AActor*>& InItems);
+	void SetCrossHair(bool bInIsAim, float InLeanAlpha);
+	void SetItemInfo(const FString& InInfo);
+	void SetAimOffset(UMaterialParameterCollection* InCollection, const FVector& InOffset);
+
+	/** Re-push every known field on next flush (HUD shown again, crosshair widgets replaced) */
+	void MarkAllDirty();
+
+	/** Re-push crosshair state on next flush (crosshair widget classes replaced) */
+	void MarkCrossHairDirty() { bCrossHairDirty = true; }
+
+	// ============================================
+	// GETTERS
+	// ============================================
+
+	UFUNCTION(BlueprintPure, Category = "HUD")
+	float GetHealth() const { return Health; }
+
+	UFUNCTION(BlueprintPure, Category = "HUD")
+	bool HasHealth() const { return bHasHealth; }
+
+	UFUNCTION(BlueprintPure, Category = "HUD")
+	AActor* GetActiveItem() const { return ActiveItem.Get(); }
+
+	UFUNCTION(BlueprintPure, Category = "HUD")
+	const FString& GetItemInfo() const { return ItemInfo; }
+
+	// ============================================
+	// FLUSH
+	// ============================================
+
+	/** Start flushing after every world actor tick (local controllers only) */
+	void BindToWorld(UWorld* World, APlayerController* InOwner);
+
+	/** Stop flushing (EndPlay) */
+	void UnbindFromWorld();
+
+	/** Push dirty fields to HUD + MPC, clear flags */
+	void Flush();
+
+	virtual void BeginDestroy() override;
+
+private:
+	void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	// Cached state (last value set by gameplay)
+	float Health = 0.0f;
+	TWeakObjectPtr<AActor> ActiveItem;
+	TArray<TWeakObjectPtr<AActor>> Inventory;
+	bool bIsAim = false;
+	float LeanAlpha = 0.0f;
+	FString ItemInfo;
+	TWeakObjectPtr<UMaterialParameterCollection> AimCollection;
+	FVector AimOffset = FVector::ZeroVector;
+
+	// Last values actually pushed (threshold reference)
+	float FlushedLeanAlpha = 0.0f;
+	bool bFlushedIsAim = false;
+	FVector FlushedAimOffset = FVector::ZeroVector;
+
+	// Known-value flags (never pushed defaults the gameplay did not set)
+	bool bHasHealth = false;
+	bool bHasActiveItem = false;
+	bool bHasInventory = false;
+	bool bHasCrossHair = false;
+	bool bHasAimOffset = false;
+
+	// Dirty flags
+	bool bHealthDirty = false;
+	bool bActiveItemDirty = false;
+	bool bInventoryDirty = false;
+	bool bCrossHairDirty = false;
+	bool bItemInfoDirty = false;
+	bool bAimOffsetDirty = false;
+
+	TWeakObjectPtr<APlayerController> OwnerController;
+	TWeakObjectPtr<UWorld> BoundWorld;
+	FDelegateHandle PostActorTickHandle;
+};
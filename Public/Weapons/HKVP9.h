@@ -41,7 +41,7 @@ class UBoxMagazineReloadComponent;
  * 2. Set DefaultMagazineClass (BP_Magazine_VP9)
  * 3. Set DefaultSightClass (iron sights)
  * 4. Set SlideShootMontage
- * 5. Configure character animations (AnimLayer, ShootMontage, ReloadMontage)
+ * 5. Assign WeaponDefinition asset (AnimLayer, ShootMontage, ReloadMontage, tuning)
  */
 UCLASS()
 class FPSCORE_API AHKVP9 : public ABaseWeapon
@@ -70,6 +70,13 @@ public:
 	bool bSlideLockedBack = false;
 
 protected:
+	// ============================================
+	// WEAPON DEFINITION
+	// ============================================
+
+	/** Code tuning defaults - one static record shared by every instance */
+	virtual const FWeaponDefinition& GetBuiltInDefinition() const override;
+
 	// ============================================
 	// ONREP CALLBACKS
 	// ============================================
@@ -104,7 +111,11 @@ public:
 	 * - Plays SlideShootMontage on BOTH weapon meshes (FPS + TPS)
 	 * Visibility handled by mesh settings (OnlyOwnerSee/OwnerNoSee)
 	 */
-	virtual void Multicast_PlayShootEffects_Implementation() override;
+	virtual void Multicast_PlayShootEffects_Implementation(
+		FVector_NetQuantize TracerOrigin,
+		FVector_NetQuantizeNormal TracerDirection,
+		float TracerDistance
+	) override;
 
 	/**
 	 * Handle shot fired - VP9 specific behavior (SERVER ONLY)
@@ -112,7 +123,8 @@ public:
 	 */
 	virtual void HandleShotFired_Implementation(
 		FVector_NetQuantize MuzzleLocation,
-		FVector_NetQuantizeNormal Direction
+		FVector_NetQuantizeNormal Direction,
+		float TraceDistance
 	) override;
 
 	/**
@@ -43,7 +43,7 @@ class UBoxMagazineReloadComponent;
  * 2. Set DefaultMagazineClass (BP_Magazine_STANAG)
  * 3. Set DefaultSightClass (iron sights or optic)
  * 4. Set BoltCarrierShootMontage
- * 5. Configure character animations (AnimLayer, ShootMontage, ReloadMontage)
+ * 5. Assign WeaponDefinition asset (AnimLayer, ShootMontage, ReloadMontage, tuning)
  */
 UCLASS()
 class FPSCORE_API AM4A1 : public ABaseWeapon
@@ -83,6 +83,13 @@ public:
 	bool bBoltCarrierOpen = false;
 
 protected:
+	// ============================================
+	// WEAPON DEFINITION
+	// ============================================
+
+	/** Code tuning defaults - one static record shared by every instance */
+	virtual const FWeaponDefinition& GetBuiltInDefinition() const override;
+
 	// ============================================
 	// ONREP CALLBACKS
 	// ============================================
@@ -120,7 +127,11 @@ public:
 	 * - Calls base implementation (muzzle VFX + character anims)
 	 * - Plays BoltCarrierShootMontage on weapon meshes (runs on ALL clients)
 	 */
-	virtual void Multicast_PlayShootEffects_Implementation() override;
+	virtual void Multicast_PlayShootEffects_Implementation(
+		FVector_NetQuantize TracerOrigin,
+		FVector_NetQuantizeNormal TracerDirection,
+		float TracerDistance
+	) override;
 
 	/**
 	 * Handle shot fired - M4A1 specific behavior (SERVER ONLY)
@@ -130,7 +141,8 @@ public:
 	 */
 	virtual void HandleShotFired_Implementation(
 		FVector_NetQuantize MuzzleLocation,
-		FVector_NetQuantizeNormal Direction
+		FVector_NetQuantizeNormal Direction,
+		float TraceDistance
 	) override;
 
 	/**
@@ -46,7 +46,7 @@ class UDisposableComponent;
  * BLUEPRINT SETUP:
  * 1. Set skeletal meshes (FPSMesh, TPSMesh)
  * 2. Set ProjectileClass (BP_Rocket or similar)
- * 3. Set ShootMontage (character firing animation with AnimNotify_StartDropSequence at end)
+ * 3. Set WeaponDefinition ShootMontage (character firing animation with AnimNotify_StartDropSequence at end)
  * 4. Set DisposableComponent->DropMontage (with AnimNotify_DropWeapon at end)
  * 5. Configure AnimLayer for weapon-specific poses
  */
@@ -87,6 +87,13 @@ public:
 	bool bIsExpanded = false;
 
 protected:
+	// ============================================
+	// WEAPON DEFINITION
+	// ============================================
+
+	/** Code tuning defaults - one static record shared by every instance */
+	virtual const FWeaponDefinition& GetBuiltInDefinition() const override;
+
 	// ============================================
 	// ONREP CALLBACKS
 	// ============================================
@@ -267,11 +274,9 @@ protected:
 	// ============================================
 
 	/**
-	 * Override Multicast_PlayShootEffects for M72A7-specific behavior
-	 * Spawns muzzle VFX, plays ShootMontage
-	 * NOTE: No UFUNCTION - inherited from BaseWeapon
+	 * Muzzle flash emitters attach to ProjectileSpawnSocket (launcher tube) instead of MuzzleFlashSocket
 	 */
-	virtual void Multicast_PlayShootEffects_Implementation() override;
+	virtual FName GetMuzzleFlashSocket() const override { return ProjectileSpawnSocket; }
 
 	// ============================================
 	// HELPERS
@@ -45,8 +45,8 @@ class UBoltActionReloadComponent;
  * 2. Set DefaultMagazineClass (BP_Magazine_308)
  * 3. Set DefaultSightClass (scope or iron sights)
  * 4. Set BoltActionMontage (character) and WeaponBoltActionMontage (weapon)
- * 5. Configure character animations (AnimLayer, ShootMontage, ReloadMontage)
- * 6. Set ReloadAttachSocket = "weapon_l" for proper hand positioning
+ * 5. Assign WeaponDefinition asset (AnimLayer, ShootMontage, ReloadMontage, tuning)
+ * 6. Definition ReloadAttachSocket = "weapon_l" for proper hand positioning
  */
 UCLASS()
 class FPSCORE_API ASako85 : public ABaseWeapon
@@ -106,6 +106,13 @@ public:
 	virtual void OnWeaponReloadComplete_Implementation() override;
 
 protected:
+	// ============================================
+	// WEAPON DEFINITION
+	// ============================================
+
+	/** Code tuning defaults - one static record shared by every instance */
+	virtual const FWeaponDefinition& GetBuiltInDefinition() const override;
+
 	// ============================================
 	// COMPONENTS
 	// ============================================
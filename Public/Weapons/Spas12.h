@@ -48,9 +48,9 @@ class UPumpActionReloadComponent;
  * 2. Set DefaultMagazineClass (BP_Magazine_12GaugeShell)
  * 3. Set DefaultSightClass (iron sights)
  * 4. Set BoltCarrierShootMontage for weapon mesh animation
- * 5. Set ReloadMontage on PumpActionReloadComponent
- * 6. Configure character animations (AnimLayer, ShootMontage, ReloadMontage)
- * 7. Set ReloadAttachSocket = "weapon_l" for proper hand positioning during reload
+ * 5. Set ReloadMontage in WeaponDefinition asset (played by PumpActionReloadComponent)
+ * 6. Assign WeaponDefinition asset (AnimLayer, ShootMontage, ReloadMontage, tuning)
+ * 7. Definition ReloadAttachSocket = "weapon_l" for proper hand positioning during reload
  */
 UCLASS()
 class FPSCORE_API ASpas12 : public ABaseWeapon
@@ -79,6 +79,13 @@ public:
 	bool BoltCarrierOpen = false;
 
 protected:
+	// ============================================
+	// WEAPON DEFINITION
+	// ============================================
+
+	/** Code tuning defaults - one static record shared by every instance */
+	virtual const FWeaponDefinition& GetBuiltInDefinition() const override;
+
 	// ============================================
 	// ONREP CALLBACKS
 	// ============================================
@@ -111,7 +118,11 @@ public:
 	 * - Calls base implementation (muzzle VFX + character anims)
 	 * - Plays BoltCarrierShootMontage on weapon meshes (runs on ALL clients)
 	 */
-	virtual void Multicast_PlayShootEffects_Implementation() override;
+	virtual void Multicast_PlayShootEffects_Implementation(
+		FVector_NetQuantize TracerOrigin,
+		FVector_NetQuantizeNormal TracerDirection,
+		float TracerDistance
+	) override;
 
 	/**
 	 * Handle shot fired - SPAS-12 specific behavior (SERVER ONLY)
@@ -120,7 +131,8 @@ public:
 	 */
 	virtual void HandleShotFired_Implementation(
 		FVector_NetQuantize MuzzleLocation,
-		FVector_NetQuantizeNormal Direction
+		FVector_NetQuantizeNormal Direction,
+		float TraceDistance
 	) override;
 
 	/**